@@ -0,0 +1,158 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Helpers shared by the UpdateCheckApi benchmarks.
+//==============================================================================
+
+#ifndef UPDATECHECKAPI_BENCHMARKS_BENCHMARK_UTILS_H_
+#define UPDATECHECKAPI_BENCHMARKS_BENCHMARK_UTILS_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef UPDATECHECKAPI_CURL
+#include "third_party/json-3.9.1/json.hpp"
+#include "update_check_api_curl_transport.h"
+#endif
+
+namespace UpdateCheckBenchmarks
+{
+    /// @brief Measures the time since it was started.
+    class Stopwatch
+    {
+    public:
+        /// @brief Constructor that starts the stopwatch.
+        Stopwatch()
+            : start_(std::chrono::steady_clock::now())
+        {
+        }
+
+        /// @brief Start the stopwatch again.
+        void Restart()
+        {
+            start_ = std::chrono::steady_clock::now();
+        }
+
+        /// @brief Get the time since the stopwatch was started.
+        ///
+        /// @return The time in milliseconds.
+        double ElapsedMs() const
+        {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_).count();
+        }
+
+    private:
+        /// The time that the stopwatch was started.
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    /// @brief Make a synthetic Schema 1.6 manifest, formatted like the manifests that are published.
+    ///
+    /// Each release has 1 to 4 tags, 1 to 2 platforms, an info page link, two download
+    /// links, and a custom field; its title contains characters that must be escaped.
+    ///
+    /// @param [in] release_count The number of releases.
+    ///
+    /// @return The JSON text of the manifest.
+    inline std::string MakeManifest(size_t release_count)
+    {
+        static const char* const kReleaseTypes[] = {"GA", "Beta", "Alpha", "Patch"};
+        static const char* const kPlatforms[]    = {"\"Windows\"", "\"Ubuntu\", \"RHEL\"", "\"Windows\", \"Ubuntu\""};
+        static const char* const kTags[]         = {"\"Windows\"", "\"Ubuntu\"", "\"GA\"", "\"Vulkan\""};
+
+        std::string manifest = "{\n    \"SchemaVersion\": \"1.6\",\n    \"Releases\": [";
+        char        release[2048];
+
+        for (size_t i = 1; i <= release_count; ++i)
+        {
+            std::string tags = kTags[0];
+            for (size_t tag = 1; tag <= i % 4; ++tag)
+            {
+                tags += std::string(", ") + kTags[tag];
+            }
+
+            snprintf(release,
+                     sizeof(release),
+                     "%s\n        {\n"
+                     "            \"ReleaseVersion\": {\"Major\": 2, \"Minor\": %zu, \"Patch\": %zu, \"Build\": %zu},\n"
+                     "            \"ReleaseDate\": \"2024-0%zu-1%zu\",\n"
+                     "            \"ReleaseTitle\": \"Radeon GPU Profiler v2.%zu \\u2013 fixes for Vulkan capture \\\"crash\\\" \\\\ path\",\n"
+                     "            \"ReleaseType\": \"%s\",\n"
+                     "            \"ReleasePlatforms\": [%s],\n"
+                     "            \"ReleaseTags\": [%s],\n"
+                     "            \"InfoPageLinks\": [{\"URL\": \"https://gpuopen.com/rgp/%zu\", \"Description\": \"RGP Product Page\"}],\n"
+                     "            \"DownloadLinks\": [\n"
+                     "                {\"URL\": \"https://github.com/GPUOpen-Tools/radeon_gpu_profiler/releases/download/v2.%zu/RGP_2_%zu.zip\", "
+                     "\"PackageType\": \"ZIP\", \"PackageName\": \"Zip archive\"},\n"
+                     "                {\"URL\": \"https://github.com/GPUOpen-Tools/radeon_gpu_profiler/releases/download/v2.%zu/RGP_2_%zu.tgz\", "
+                     "\"PackageType\": \"TAR\"}\n"
+                     "            ],\n"
+                     "            \"CustomField\": {\"MinDriver\": \"23.1.1\", \"GpuFamilies\": [\"RDNA2\", \"RDNA3\"]}\n"
+                     "        }",
+                     (i > 1) ? "," : "",
+                     i % 50,
+                     i % 7,
+                     1000 + i,
+                     1 + i % 9,
+                     i % 10,
+                     i,
+                     kReleaseTypes[i % 4],
+                     kPlatforms[i % 3],
+                     tags.c_str(),
+                     i,
+                     i,
+                     i,
+                     i,
+                     i);
+            manifest += release;
+        }
+
+        manifest += "\n    ]\n}\n";
+        return manifest;
+    }
+
+    /// @brief Get a percentile of some measurements.
+    ///
+    /// @param [in] values     The measurements; must not be empty.
+    /// @param [in] percentile The percentile, from 0 to 1.
+    ///
+    /// @return The measurement at the percentile.
+    inline double Percentile(std::vector<double> values, double percentile)
+    {
+        std::sort(values.begin(), values.end());
+        size_t index = static_cast<size_t>(percentile * values.size());
+        return values[(index < values.size()) ? index : values.size() - 1];
+    }
+
+#ifdef UPDATECHECKAPI_CURL
+    /// @brief Get the counters of a stand-in server.
+    ///
+    /// @param [in] server_url The URL of the stand-in server.
+    /// @param [in] ca_file    The certificate authority of an HTTPS stand-in; empty for HTTP.
+    ///
+    /// @return The counters, as a JSON object; empty if they could not be downloaded.
+    inline nlohmann::json GetServerCounters(const std::string& server_url, const std::string& ca_file = std::string())
+    {
+        UpdateCheck::TransportOptions options;
+        options.ca_file = ca_file;
+
+        UpdateCheck::CurlTransport   transport(options);
+        UpdateCheck::TransferRequest request;
+        UpdateCheck::TransferResult  result;
+        request.url = server_url + "/stats";
+
+        if (!transport.Fetch(request, result))
+        {
+            return nlohmann::json::object();
+        }
+
+        return nlohmann::json::parse(result.body.Data(), result.body.Data() + result.body.Size());
+    }
+#endif
+}  // namespace UpdateCheckBenchmarks
+
+#endif  // UPDATECHECKAPI_BENCHMARKS_BENCHMARK_UTILS_H_
@@ -0,0 +1,203 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Measures the fair queueing of transfers per group, and the reuse of idle connections by periodic checks.
+///
+/// Usage: connection_pool_benchmark <server URL> <CA file> [checks per scenario]
+///
+/// Runs against benchmarks/standin/latency_server.py with TLS:
+///
+///   python3 tests/standin/run_standin_test.py benchmarks/standin/latency_server.py --rtt 20
+///           --tls tests/data/standin_cert.pem tests/data/standin_key.pem --
+///           ./connection_pool_benchmark https://127.0.0.1:{port} tests/data/standin_cert.pem
+///
+/// The first part downloads the files of five products over HTTP/1.1 with 4
+/// connections, where the first product has 40 slow files and the others 3
+/// each, with and without grouping the transfers by product. The second part
+/// runs periodic checks of 4 files on one transport, with different idle limits
+/// of the client and the server, and reports how many connections were reused.
+//==============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "update_check_api_curl_transport.h"
+
+/// The products of the fairness benchmark, and their number of files; the first one has many.
+static const char* const kProducts[]     = {"RGP", "RGA", "RMV", "RRA", "RGD"};
+static const size_t      kProductFiles[] = {40, 3, 3, 3, 3};
+
+/// How long the server takes to answer for each file of the fairness benchmark, in milliseconds.
+static const int kFileServiceTimeMs = 100;
+
+/// The number of connections of the fairness benchmark.
+static const long kFairnessHostConnections = 4;
+
+/// The number of files of each periodic check.
+static const size_t kFilesPerCheck = 4;
+
+/// @brief A scenario of periodic checks.
+struct PeriodicScenario
+{
+    /// How long the client keeps idle connections, in seconds.
+    long max_idle_time_s;
+
+    /// How long the server keeps idle connections, in milliseconds; 0 for ever.
+    int server_idle_timeout_ms;
+
+    /// The time between checks, in milliseconds.
+    int interval_ms;
+};
+
+static const PeriodicScenario kPeriodicScenarios[] = {
+    {60, 0, 3500},
+    {2, 0, 3500},
+    {60, 1000, 1500},
+    {60, 1000, 500},
+};
+
+/// @brief Download the files of all products in one batch, and report when the files of each product were complete.
+///
+/// @param [in] server_url The URL of the stand-in server.
+/// @param [in] ca_file    The certificate authority of the stand-in server.
+/// @param [in] is_grouped True to group the transfers by product.
+static void FetchProducts(const std::string& server_url, const std::string& ca_file, bool is_grouped)
+{
+    UpdateCheck::TransportOptions options;
+    options.ca_file              = ca_file;
+    options.use_http2            = false;
+    options.max_host_connections = kFairnessHostConnections;
+
+    std::vector<UpdateCheck::TransferRequest> requests;
+    std::vector<size_t>                       products;
+    for (size_t product = 0; product < sizeof(kProducts) / sizeof(kProducts[0]); ++product)
+    {
+        for (size_t file = 0; file < kProductFiles[product]; ++file)
+        {
+            UpdateCheck::TransferRequest request;
+            request.url   = server_url + "/" + kProducts[product] + "/" + std::to_string(file) + ".json?ms=" + std::to_string(kFileServiceTimeMs);
+            request.group = is_grouped ? kProducts[product] : "";
+            requests.push_back(request);
+            products.push_back(product);
+        }
+    }
+
+    UpdateCheck::CurlTransport               transport(options);
+    std::vector<UpdateCheck::TransferResult> results;
+    std::vector<double>                      done_ms(requests.size());
+    UpdateCheckBenchmarks::Stopwatch         stopwatch;
+    transport.Fetch(requests, results, [&](size_t index, const UpdateCheck::TransferResult&) { done_ms[index] = stopwatch.ElapsedMs(); });
+    const double total_ms = stopwatch.ElapsedMs();
+
+    std::vector<double> small_product_done_ms;
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        if (products[i] != 0)
+        {
+            small_product_done_ms.push_back(done_ms[i]);
+        }
+    }
+
+    printf("%-10s %7.0f ms %7.0f ms %7.0f ms %14.0f ms %10.0f ms\n",
+           is_grouped ? "grouped" : "ungrouped",
+           total_ms,
+           UpdateCheckBenchmarks::Percentile(done_ms, 0.5),
+           UpdateCheckBenchmarks::Percentile(done_ms, 0.99),
+           UpdateCheckBenchmarks::Percentile(small_product_done_ms, 0.5),
+           UpdateCheckBenchmarks::Percentile(small_product_done_ms, 1.0));
+}
+
+/// @brief Run periodic checks on one transport, and report how many of their transfers reused a connection.
+///
+/// @param [in] server_url  The URL of the stand-in server.
+/// @param [in] ca_file     The certificate authority of the stand-in server.
+/// @param [in] scenario    The idle limits and the time between checks.
+/// @param [in] check_count The number of checks.
+static void RunPeriodicChecks(const std::string& server_url, const std::string& ca_file, const PeriodicScenario& scenario, int check_count)
+{
+    UpdateCheck::TransportOptions options;
+    options.ca_file         = ca_file;
+    options.use_http2       = false;
+    options.max_idle_time_s = scenario.max_idle_time_s;
+
+    // Set the idle timeout of the server.
+    {
+        UpdateCheck::CurlTransport   transport(options);
+        UpdateCheck::TransferRequest request;
+        UpdateCheck::TransferResult  result;
+        request.url = server_url + "/idle/" + std::to_string(scenario.server_idle_timeout_ms);
+        transport.Fetch(request, result);
+    }
+
+    UpdateCheck::CurlTransport transport(options);
+    std::vector<double>        check_ms;
+    long                       connections = 0;
+    int                        failures    = 0;
+
+    for (int check = 0; check < check_count; ++check)
+    {
+        if (check > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(scenario.interval_ms));
+        }
+
+        std::vector<UpdateCheck::TransferRequest> requests(kFilesPerCheck);
+        for (size_t i = 0; i < kFilesPerCheck; ++i)
+        {
+            requests[i].url = server_url + "/check/" + std::to_string(i) + ".json";
+        }
+
+        std::vector<UpdateCheck::TransferResult> results;
+        UpdateCheckBenchmarks::Stopwatch         stopwatch;
+        transport.Fetch(requests, results, nullptr);
+        check_ms.push_back(stopwatch.ElapsedMs());
+
+        for (const UpdateCheck::TransferResult& result : results)
+        {
+            connections += result.new_connections;
+            failures += result.was_successful ? 0 : 1;
+        }
+    }
+
+    const double transfer_count = static_cast<double>(check_count * kFilesPerCheck);
+    printf("%12ld s %12d ms %10d ms %9.0f%% %9.1f ms %9d\n",
+           scenario.max_idle_time_s,
+           scenario.server_idle_timeout_ms,
+           scenario.interval_ms,
+           100.0 * (1.0 - connections / transfer_count),
+           UpdateCheckBenchmarks::Percentile(check_ms, 0.5),
+           failures);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s <server URL> <CA file> [checks per scenario]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string server_url  = argv[1];
+    const std::string ca_file     = argv[2];
+    const int         check_count = (argc > 3) ? atoi(argv[3]) : 6;
+
+    printf("Five products over HTTP/1.1 with %ld connections; the first has %zu files of %d ms.\n", kFairnessHostConnections, kProductFiles[0], kFileServiceTimeMs);
+    printf("%-10s %10s %10s %10s %17s %13s\n", "", "total", "p50", "p99", "small p50", "small last");
+    FetchProducts(server_url, ca_file, false);
+    FetchProducts(server_url, ca_file, true);
+
+    printf("\nPeriodic checks of %zu files on one transport, %d checks each.\n", kFilesPerCheck, check_count);
+    printf("%14s %15s %13s %10s %12s %9s\n", "client idle", "server idle", "interval", "reuse", "check p50", "failures");
+    for (const PeriodicScenario& scenario : kPeriodicScenarios)
+    {
+        RunPeriodicChecks(server_url, ca_file, scenario, check_count);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,183 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Measures a batch of requests multiplexed over HTTP/2, and the cancellation of single streams.
+///
+/// Usage: http2_benchmark <server URL> <CA file> [request count]
+///
+/// Runs against benchmarks/standin/latency_server.py with TLS and HTTP/2:
+///
+///   python3 tests/standin/run_standin_test.py benchmarks/standin/latency_server.py --rtt 30
+///           --tls tests/data/standin_cert.pem tests/data/standin_key.pem --http2 --
+///           ./http2_benchmark https://127.0.0.1:{port} tests/data/standin_cert.pem
+///
+/// The batch is downloaded with one Fetch() call over HTTP/2 and over HTTP/1.1,
+/// and with one curl process per request, the way rtda is launched for each
+/// download. In the last batch, every other request is held open by the server,
+/// and is cancelled as soon as the request before it completes.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "update_check_api_curl_transport.h"
+#include "update_check_api_utils.h"
+
+/// @brief Measures the batches against one stand-in server.
+class Http2Benchmark
+{
+public:
+    /// @brief Constructor.
+    ///
+    /// @param [in] server_url    The URL of the stand-in server.
+    /// @param [in] ca_file       The certificate authority of the stand-in server.
+    /// @param [in] request_count The number of requests of each batch.
+    Http2Benchmark(const std::string& server_url, const std::string& ca_file, size_t request_count)
+        : server_url_(server_url)
+        , ca_file_(ca_file)
+        , request_count_(request_count)
+        , server_connections_(0)
+        , server_resets_(0)
+    {
+        UpdateServerCounters();
+    }
+
+    /// @brief Download the batch with one Fetch() call.
+    ///
+    /// @param [in] mode        A description of the batch.
+    /// @param [in] use_http2   True to negotiate HTTP/2.
+    /// @param [in] cancel_slow True to hold every other request open on the server, and to cancel it.
+    void FetchBatch(const char* mode, bool use_http2, bool cancel_slow)
+    {
+        UpdateCheck::TransportOptions options;
+        options.ca_file   = ca_file_;
+        options.use_http2 = use_http2;
+
+        std::vector<UpdateCheck::TransferRequest> requests(request_count_);
+        for (size_t i = 0; i < request_count_; ++i)
+        {
+            const bool is_slow = cancel_slow && (i % 2 != 0);
+            requests[i].url    = server_url_ + (is_slow ? "/slow" : "") + "/repos/product" + std::to_string(i) + "/releases/latest";
+        }
+
+        UpdateCheck::CurlTransport               transport(options);
+        std::vector<UpdateCheck::TransferResult> results;
+        UpdateCheckBenchmarks::Stopwatch         stopwatch;
+        transport.Fetch(requests, results, [&](size_t index, const UpdateCheck::TransferResult&) {
+            if (cancel_slow && index % 2 == 0 && index + 1 < requests.size())
+            {
+                transport.CancelTransfer(index + 1);
+            }
+        });
+
+        const double wall_ms          = stopwatch.ElapsedMs();
+        int          successful_count = 0;
+        int          cancelled_count  = 0;
+        int          http2_count      = 0;
+        long         connections      = 0;
+        for (const UpdateCheck::TransferResult& result : results)
+        {
+            successful_count += result.was_successful ? 1 : 0;
+            cancelled_count += result.was_cancelled ? 1 : 0;
+            http2_count += (result.http_version == 20) ? 1 : 0;
+            connections += result.new_connections;
+        }
+
+        PrintRow(mode, wall_ms, connections, successful_count, cancelled_count, http2_count);
+    }
+
+    /// @brief Download the batch with one curl process per request.
+    void FetchWithProcesses()
+    {
+        int                              successful_count = 0;
+        UpdateCheckBenchmarks::Stopwatch stopwatch;
+        for (size_t i = 0; i < request_count_; ++i)
+        {
+            const bool        cancel_signal = false;
+            const std::string url           = server_url_ + "/repos/product" + std::to_string(i) + "/releases/latest";
+            const std::string command       = "curl -s --cacert \"" + ca_file_ + "\" \"" + url + "\"";
+            std::string       output;
+            UpdateCheckApiUtils::ExecAndGrabOutput(command.c_str(), cancel_signal, output);
+            successful_count += output.empty() ? 0 : 1;
+        }
+
+        PrintRow("one curl process per request", stopwatch.ElapsedMs(), static_cast<long>(request_count_), successful_count, 0, -1);
+    }
+
+    /// @brief Print the header of the table of measurements.
+    static void PrintHeader()
+    {
+        printf("%-30s %10s %12s %10s %10s %8s %14s %8s\n", "mode", "wall", "connections", "succeeded", "cancelled", "HTTP/2", "server conns", "resets");
+    }
+
+private:
+    /// @brief Print a line of measurements, with the counters of the server since the previous line.
+    ///
+    /// @param [in] mode             A description of the batch.
+    /// @param [in] wall_ms          How long the batch took, in milliseconds.
+    /// @param [in] connections      The number of connections that the client opened.
+    /// @param [in] successful_count The number of requests that succeeded.
+    /// @param [in] cancelled_count  The number of requests that were cancelled.
+    /// @param [in] http2_count      The number of requests that used HTTP/2, or -1 if unknown.
+    void PrintRow(const char* mode, double wall_ms, long connections, int successful_count, int cancelled_count, int http2_count)
+    {
+        const int connections_before = server_connections_;
+        const int resets_before      = server_resets_;
+        UpdateServerCounters();
+
+        // The request for the counters opens a connection of its own.
+        printf("%-30s %7.0f ms %12ld %10d %10d %8s %14d %8d\n",
+               mode,
+               wall_ms,
+               connections,
+               successful_count,
+               cancelled_count,
+               (http2_count < 0) ? "-" : std::to_string(http2_count).c_str(),
+               server_connections_ - connections_before - 1,
+               server_resets_ - resets_before);
+    }
+
+    /// @brief Remember the counters of the server.
+    void UpdateServerCounters()
+    {
+        nlohmann::json counters = UpdateCheckBenchmarks::GetServerCounters(server_url_, ca_file_);
+        server_connections_     = counters.value("connections", 0);
+        server_resets_          = counters.value("resets", 0);
+    }
+
+    /// The URL of the stand-in server.
+    std::string server_url_;
+
+    /// The certificate authority of the stand-in server.
+    std::string ca_file_;
+
+    /// The number of requests of each batch.
+    size_t request_count_;
+
+    /// The counters of the server at the previous row.
+    int server_connections_;
+    int server_resets_;
+};
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s <server URL> <CA file> [request count]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Http2Benchmark benchmark(argv[1], argv[2], (argc > 3) ? strtoul(argv[3], nullptr, 10) : 20);
+
+    Http2Benchmark::PrintHeader();
+    benchmark.FetchBatch("HTTP/2, one Fetch() batch", true, false);
+    benchmark.FetchBatch("HTTP/1.1, one Fetch() batch", false, false);
+    benchmark.FetchWithProcesses();
+    benchmark.FetchBatch("HTTP/2, half cancelled", true, true);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Measures how long parsing Schema 1.6 manifests of different sizes takes.
+///
+/// Usage: manifest_parse_benchmark [release count...]
+///
+/// For each size, the time of a check of a local manifest with CheckForUpdates()
+/// is compared with the stage that dominates it, JsonTape::Parse(), and with a
+/// DOM parse of the same text by nlohmann::json, which the manifests were parsed
+/// with before the tape. The DOM parse alone does not build an UpdateInfo, so it
+/// understates what the previous parser cost. The manifest is written to the
+/// current directory.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "third_party/json-3.9.1/json.hpp"
+#include "update_check_api.h"
+#include "update_check_api_json_tape.h"
+
+/// The name of the manifest that the benchmark writes.
+static const char* kManifestFilename = "manifest_parse_benchmark.json";
+
+/// How many bytes of JSON each measurement parses in total, so that small manifests are parsed often enough to be timed.
+static const size_t kBytesPerMeasurement = 64 * 1024 * 1024;
+
+/// @brief Get the number of times to parse a manifest.
+///
+/// @param [in] size The size of the manifest in bytes.
+///
+/// @return The number of iterations.
+static int GetIterationCount(size_t size)
+{
+    size_t iterations = kBytesPerMeasurement / size;
+    return static_cast<int>((iterations < 3) ? 3 : (iterations > 100000) ? 100000 : iterations);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<size_t> release_counts;
+    for (int i = 1; i < argc; ++i)
+    {
+        release_counts.push_back(strtoul(argv[i], nullptr, 10));
+    }
+
+    if (release_counts.empty())
+    {
+        release_counts = {1, 70, 1000, 10000, 50000};
+    }
+
+    printf("%10s %10s %12s %12s %12s %10s\n", "releases", "size", "nlohmann", "tape", "check", "check MB/s");
+
+    for (size_t release_count : release_counts)
+    {
+        const std::string manifest = UpdateCheckBenchmarks::MakeManifest(release_count);
+        std::ofstream(kManifestFilename, std::ios::binary) << manifest;
+
+        const int iterations = GetIterationCount(manifest.size());
+
+        UpdateCheckBenchmarks::Stopwatch stopwatch;
+        size_t                           element_count = 0;
+        for (int i = 0; i < iterations; ++i)
+        {
+            nlohmann::json document = nlohmann::json::parse(manifest);
+            element_count += document["Releases"].size();
+        }
+
+        const double dom_ms = stopwatch.ElapsedMs() / iterations;
+
+        UpdateCheckApiJson::JsonTape tape;
+        std::string                  error_message;
+        bool                         is_parsed = true;
+        stopwatch.Restart();
+        for (int i = 0; i < iterations; ++i)
+        {
+            is_parsed = tape.Parse(manifest.data(), manifest.size(), false, error_message) && is_parsed;
+        }
+
+        const double tape_ms = stopwatch.ElapsedMs() / iterations;
+
+        UpdateCheck::VersionInfo current_version = {};
+        UpdateCheck::UpdateInfo  update_info;
+        stopwatch.Restart();
+        for (int i = 0; i < iterations; ++i)
+        {
+            is_parsed = UpdateCheck::CheckForUpdates(current_version, ".", kManifestFilename, update_info, error_message) && is_parsed;
+        }
+
+        const double check_ms = stopwatch.ElapsedMs() / iterations;
+
+        if (!is_parsed || element_count != release_count * iterations)
+        {
+            fprintf(stderr, "Parsing %zu releases failed: %s\n", release_count, error_message.c_str());
+            return EXIT_FAILURE;
+        }
+
+        printf("%10zu %8.1f KB %9.3f ms %9.3f ms %9.3f ms %10.0f\n",
+               release_count,
+               manifest.size() / 1024.0,
+               dom_ms,
+               tape_ms,
+               check_ms,
+               manifest.size() / check_ms / 1000.0);
+    }
+
+    remove(kManifestFilename);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,122 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Measures the heap allocations of parsing a manifest into a new UpdateInfo.
+///
+/// Usage: release_allocation_benchmark [release count]
+///
+/// The tags, links and platforms of each release are stored inline, so the
+/// number of allocations per parse and the heap that the parsed UpdateInfo
+/// keeps are reported along with the parse time and sizeof(ReleaseInfo). The
+/// manifest is written to the current directory.
+//==============================================================================
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#include "benchmark_utils.h"
+#include "update_check_api.h"
+
+/// The name of the manifest that the benchmark writes.
+static const char* kManifestFilename = "release_allocation_benchmark.json";
+
+/// The number of checks that the parse time is the best of.
+static const int kTimedCheckCount = 20;
+
+/// The size of the header in front of each block that holds its size; keeps the blocks aligned.
+static const size_t kBlockHeaderSize = alignof(std::max_align_t);
+
+/// The number of calls of operator new.
+static size_t allocation_count = 0;
+
+/// The number of bytes that are currently allocated.
+static size_t live_bytes = 0;
+
+void* operator new(size_t size)
+{
+    char* block = static_cast<char*>(malloc(kBlockHeaderSize + size));
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast<size_t*>(block) = size;
+    ++allocation_count;
+    live_bytes += size;
+    return block + kBlockHeaderSize;
+}
+
+void operator delete(void* memory) noexcept
+{
+    if (memory != nullptr)
+    {
+        char* block = static_cast<char*>(memory) - kBlockHeaderSize;
+        live_bytes -= *reinterpret_cast<size_t*>(block);
+        free(block);
+    }
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    operator delete(memory);
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t release_count = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 500;
+    std::ofstream(kManifestFilename, std::ios::binary) << UpdateCheckBenchmarks::MakeManifest(release_count);
+
+    UpdateCheck::VersionInfo current_version = {};
+    std::string              error_message;
+
+    // Check once so that anything that is set up on the first check is not counted.
+    {
+        UpdateCheck::UpdateInfo update_info;
+        if (!UpdateCheck::CheckForUpdates(current_version, ".", kManifestFilename, update_info, error_message))
+        {
+            fprintf(stderr, "Checking the manifest failed: %s\n", error_message.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+
+    size_t parsed_release_count = 0;
+    size_t allocations          = 0;
+    size_t retained_bytes       = 0;
+    {
+        const size_t allocation_count_before = allocation_count;
+        const size_t live_bytes_before       = live_bytes;
+
+        UpdateCheck::UpdateInfo update_info;
+        UpdateCheck::CheckForUpdates(current_version, ".", kManifestFilename, update_info, error_message);
+
+        allocations          = allocation_count - allocation_count_before;
+        retained_bytes       = live_bytes - live_bytes_before;
+        parsed_release_count = update_info.releases.size();
+    }
+
+    double best_ms = 0;
+    for (int i = 0; i < kTimedCheckCount; ++i)
+    {
+        UpdateCheckBenchmarks::Stopwatch stopwatch;
+        UpdateCheck::UpdateInfo          update_info;
+        UpdateCheck::CheckForUpdates(current_version, ".", kManifestFilename, update_info, error_message);
+
+        const double elapsed_ms = stopwatch.ElapsedMs();
+        best_ms                 = (i == 0 || elapsed_ms < best_ms) ? elapsed_ms : best_ms;
+    }
+
+    remove(kManifestFilename);
+
+    printf("Releases parsed:                  %zu of %zu\n", parsed_release_count, release_count);
+    printf("Allocations per check:            %zu\n", allocations);
+    printf("Heap retained by the UpdateInfo:  %.0f KB\n", retained_bytes / 1024.0);
+    printf("sizeof(ReleaseInfo):              %zu bytes\n", sizeof(UpdateCheck::ReleaseInfo));
+    printf("Check time, best of %d:           %.2f ms\n", kTimedCheckCount, best_ms);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,235 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Measures the filter and aggregate kernels of ReleaseTable against loops over ReleaseInfo.
+///
+/// Usage: release_table_benchmark [release count]
+///
+/// The query selects the releases that are newer than a version and target
+/// Ubuntu or RHEL, and counts them by type, platform and month. It runs over
+/// std::vector<ReleaseInfo> and over a ReleaseTable of the same synthetic
+/// releases, and the results of both must match.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "update_check_api_release_table.h"
+
+/// The number of times that each query runs.
+static const int kQueryIterations = 50;
+
+/// The first month that the month counts start at.
+static const int32_t kFirstYear = 2015;
+
+/// The number of months that are counted.
+static const size_t kMonthCount = 120;
+
+/// The number of release types and platforms, including kUnknown.
+static const size_t kReleaseTypeCount = 6;
+static const size_t kPlatformCount    = 5;
+
+/// @brief Make synthetic releases with random versions, types, platforms and dates.
+///
+/// @param [in]  release_count The number of releases.
+/// @param [out] update_info   The releases.
+static void MakeReleases(size_t release_count, UpdateCheck::UpdateInfo& update_info)
+{
+    std::mt19937 random(1);
+
+    update_info.releases.resize(release_count);
+    for (size_t i = 0; i < release_count; ++i)
+    {
+        UpdateCheck::ReleaseInfo& release = update_info.releases[i];
+        release.version.major             = random() % 5;
+        release.version.minor             = random() % 20;
+        release.version.patch             = random() % 10;
+        release.version.build             = random() % 1000;
+        release.type                      = static_cast<UpdateCheck::ReleaseType>(random() % kReleaseTypeCount);
+
+        const size_t platform_count = 1 + random() % 3;
+        for (size_t platform = 0; platform < platform_count; ++platform)
+        {
+            release.target_platforms.push_back(static_cast<UpdateCheck::TargetPlatform>(1 + random() % (kPlatformCount - 1)));
+        }
+
+        char date[16];
+        snprintf(date, sizeof(date), "%04d-%02d-%02d", static_cast<int>(kFirstYear + random() % 10), static_cast<int>(1 + random() % 12), static_cast<int>(1 + random() % 28));
+        release.date  = (i % 1000 == 0) ? "unknown" : date;
+        release.title = "Release title number " + std::to_string(i);
+        release.tags.push_back("tag");
+        release.tags.push_back("x" + std::to_string(i % 7));
+    }
+}
+
+/// @brief Counts of the releases that a query selected.
+struct QueryCounts
+{
+    size_t                selected_count;
+    std::vector<uint32_t> type_counts;
+    std::vector<uint32_t> platform_counts;
+    std::vector<uint32_t> month_counts;
+
+    bool operator==(const QueryCounts& other) const
+    {
+        return selected_count == other.selected_count && type_counts == other.type_counts && platform_counts == other.platform_counts &&
+               month_counts == other.month_counts;
+    }
+};
+
+/// @brief Run the query with a loop over the releases.
+///
+/// @param [in]  update_info The releases.
+/// @param [in]  version     The version that the releases must be newer than.
+/// @param [out] counts      The counts of the selected releases.
+static void QueryReleases(const UpdateCheck::UpdateInfo& update_info, const UpdateCheck::VersionInfo& version, QueryCounts& counts)
+{
+    const int32_t first_month = UpdateCheck::ReleaseTable::ToMonthIndex(kFirstYear, 1);
+
+    counts.selected_count = 0;
+    counts.type_counts.assign(kReleaseTypeCount, 0);
+    counts.platform_counts.assign(kPlatformCount, 0);
+    counts.month_counts.assign(kMonthCount, 0);
+
+    for (const UpdateCheck::ReleaseInfo& release : update_info.releases)
+    {
+        if (release.version.Compare(version) <= 0)
+        {
+            continue;
+        }
+
+        uint8_t platform_mask = 0;
+        for (UpdateCheck::TargetPlatform platform : release.target_platforms)
+        {
+            platform_mask |= UpdateCheck::ReleaseTable::ToPlatformMask(platform);
+        }
+
+        if ((platform_mask & (UpdateCheck::ReleaseTable::ToPlatformMask(UpdateCheck::TargetPlatform::kUbuntu) |
+                              UpdateCheck::ReleaseTable::ToPlatformMask(UpdateCheck::TargetPlatform::kRhel))) == 0)
+        {
+            continue;
+        }
+
+        ++counts.selected_count;
+        ++counts.type_counts[static_cast<size_t>(release.type)];
+
+        for (size_t platform = 0; platform < kPlatformCount; ++platform)
+        {
+            if ((platform_mask & UpdateCheck::ReleaseTable::ToPlatformMask(static_cast<UpdateCheck::TargetPlatform>(platform))) != 0)
+            {
+                ++counts.platform_counts[platform];
+            }
+        }
+
+        if (UpdateCheck::ReleaseTable::DateToDays(release.date) != UpdateCheck::ReleaseTable::kInvalidDate)
+        {
+            const int32_t month = UpdateCheck::ReleaseTable::ToMonthIndex(atoi(release.date.c_str()), atoi(release.date.c_str() + 5)) - first_month;
+            if (month >= 0 && static_cast<size_t>(month) < kMonthCount)
+            {
+                ++counts.month_counts[month];
+            }
+        }
+    }
+}
+
+/// @brief Run the query with the kernels of a release table.
+///
+/// @param [in]  table     The release table.
+/// @param [in]  version   The version that the releases must be newer than.
+/// @param [in]  selection The selection to reuse between queries.
+/// @param [out] counts    The counts of the selected releases.
+static void QueryTable(const UpdateCheck::ReleaseTable& table, const UpdateCheck::VersionInfo& version, std::vector<uint8_t>& selection, QueryCounts& counts)
+{
+    table.SelectAll(selection);
+    table.FilterNewerThan(version, selection);
+    table.FilterByPlatform(UpdateCheck::ReleaseTable::ToPlatformMask(UpdateCheck::TargetPlatform::kUbuntu) |
+                               UpdateCheck::ReleaseTable::ToPlatformMask(UpdateCheck::TargetPlatform::kRhel),
+                           selection);
+
+    counts.selected_count = UpdateCheck::ReleaseTable::CountSelected(selection);
+    table.CountByType(selection, counts.type_counts);
+    table.CountByPlatform(selection, counts.platform_counts);
+    table.CountByMonth(selection, UpdateCheck::ReleaseTable::ToMonthIndex(kFirstYear, 1), kMonthCount, counts.month_counts);
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t release_count = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 100000;
+
+    UpdateCheck::UpdateInfo update_info;
+    MakeReleases(release_count, update_info);
+
+    UpdateCheck::VersionInfo version = {};
+    version.major                    = 2;
+    version.minor                    = 10;
+    version.patch                    = 5;
+    version.build                    = 500;
+
+    UpdateCheckBenchmarks::Stopwatch stopwatch;
+    UpdateCheck::ReleaseTable        table;
+    table.Assign(update_info);
+    printf("Building the table of %zu releases: %.2f ms\n", release_count, stopwatch.ElapsedMs());
+
+    QueryCounts release_counts;
+    stopwatch.Restart();
+    for (int i = 0; i < kQueryIterations; ++i)
+    {
+        QueryReleases(update_info, version, release_counts);
+    }
+
+    const double releases_ms = stopwatch.ElapsedMs() / kQueryIterations;
+
+    QueryCounts          table_counts;
+    std::vector<uint8_t> selection;
+    stopwatch.Restart();
+    for (int i = 0; i < kQueryIterations; ++i)
+    {
+        QueryTable(table, version, selection, table_counts);
+    }
+
+    const double table_ms = stopwatch.ElapsedMs() / kQueryIterations;
+
+    printf("Newer than and platform filter, counts by type, platform and month (%zu selected):\n", table_counts.selected_count);
+    printf("  std::vector<ReleaseInfo> %8.3f ms\n  ReleaseTable             %8.3f ms\n", releases_ms, table_ms);
+
+    // The newer-than filter alone.
+    size_t newer_count = 0;
+    stopwatch.Restart();
+    for (int i = 0; i < kQueryIterations; ++i)
+    {
+        newer_count = 0;
+        for (const UpdateCheck::ReleaseInfo& release : update_info.releases)
+        {
+            newer_count += (release.version.Compare(version) > 0) ? 1 : 0;
+        }
+    }
+
+    const double newer_releases_ms = stopwatch.ElapsedMs() / kQueryIterations;
+
+    size_t table_newer_count = 0;
+    stopwatch.Restart();
+    for (int i = 0; i < kQueryIterations; ++i)
+    {
+        table.SelectAll(selection);
+        table.FilterNewerThan(version, selection);
+        table_newer_count = UpdateCheck::ReleaseTable::CountSelected(selection);
+    }
+
+    const double newer_table_ms = stopwatch.ElapsedMs() / kQueryIterations;
+
+    printf("Newer than count alone (%zu selected):\n", table_newer_count);
+    printf("  std::vector<ReleaseInfo> %8.3f ms\n  ReleaseTable             %8.3f ms\n", newer_releases_ms, newer_table_ms);
+
+    if (!(release_counts == table_counts) || newer_count != table_newer_count)
+    {
+        fprintf(stderr, "The results of the release table do not match those of the loops.\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,164 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Measures building, querying and updating the full-text search index of releases.
+///
+/// Usage: search_index_benchmark [release count]
+///
+/// The synthetic releases are spread over manifests of 2000 releases each, and
+/// every title has a unique build number. Each query is compared with a linear
+/// scan that looks for each query word in the lower-cased titles and tags. The
+/// scan matches substrings rather than word prefixes, so it finds more hits.
+//==============================================================================
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "update_check_api_search_index.h"
+
+/// The number of releases of each manifest.
+static const size_t kReleasesPerManifest = 2000;
+
+/// The number of times that each query runs on the index.
+static const int kQueryIterations = 5;
+
+static const char* const kProducts[] = {"RGP", "RGA", "RGD", "RMV", "RRA", "RDP", "RDNA", "GPA", "CodeXL", "Compressonator"};
+static const char* const kVerbs[]    = {"Fixed", "Improved", "Added", "Removed", "Updated", "Optimized", "Refactored", "Restored"};
+static const char* const kNouns[]    = {"Vulkan",   "DirectX", "OpenCL",  "HIP",   "capture", "crash",   "memory", "profiler",
+                                     "timeline", "shader",  "barrier", "queue", "event",   "overlay", "trace",  "driver",
+                                     "wavefront", "occupancy", "counter", "export", "import", "layout", "render", "pipeline"};
+
+static const char* const kQueries[] = {"vulkan capture crash", "vulk capt", "rgp shader", "build 123456", "wavefront occupancy rmv", "d"};
+
+/// @brief Count the releases whose lower-cased title or tags contain every word of a query.
+///
+/// @param [in] manifests The manifests to scan.
+/// @param [in] query     The query, in lower case.
+///
+/// @return The number of matching releases.
+static size_t ScanReleases(const std::vector<UpdateCheck::UpdateInfo>& manifests, const std::string& query)
+{
+    std::vector<std::string> words;
+    size_t                   start = 0;
+    while (start < query.size())
+    {
+        size_t end = query.find(' ', start);
+        end        = (end == std::string::npos) ? query.size() : end;
+        if (end > start)
+        {
+            words.push_back(query.substr(start, end - start));
+        }
+
+        start = end + 1;
+    }
+
+    size_t      match_count = 0;
+    std::string text;
+    for (const UpdateCheck::UpdateInfo& manifest : manifests)
+    {
+        for (const UpdateCheck::ReleaseInfo& release : manifest.releases)
+        {
+            text = release.title;
+            for (const std::string& tag : release.tags)
+            {
+                text += ' ';
+                text += tag;
+            }
+
+            for (char& c : text)
+            {
+                c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+            }
+
+            bool is_match = true;
+            for (size_t i = 0; i < words.size() && is_match; ++i)
+            {
+                is_match = text.find(words[i]) != std::string::npos;
+            }
+
+            match_count += is_match ? 1 : 0;
+        }
+    }
+
+    return match_count;
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t release_count = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+
+    std::mt19937                         random(1);
+    std::vector<UpdateCheck::UpdateInfo> manifests((release_count + kReleasesPerManifest - 1) / kReleasesPerManifest);
+    size_t                               build = 0;
+
+    for (UpdateCheck::UpdateInfo& manifest : manifests)
+    {
+        manifest.releases.resize(kReleasesPerManifest);
+        for (UpdateCheck::ReleaseInfo& release : manifest.releases)
+        {
+            release.title = std::string(kVerbs[random() % 8]) + " a " + kNouns[random() % 24] + " " + kNouns[random() % 24] + " issue in " + kProducts[random() % 10] +
+                            " build " + std::to_string(build++);
+            release.tags.push_back(kProducts[random() % 10]);
+            release.tags.push_back((random() % 2 != 0) ? "GA" : "Beta");
+        }
+    }
+
+    UpdateCheck::ReleaseSearchIndex  index;
+    UpdateCheckBenchmarks::Stopwatch stopwatch;
+    for (size_t i = 0; i < manifests.size(); ++i)
+    {
+        index.SetManifest("manifest" + std::to_string(i), manifests[i]);
+    }
+
+    printf("Indexing %zu releases: %.0f ms, %zu words, %.1f MB of posting lists\n",
+           build,
+           stopwatch.ElapsedMs(),
+           index.GetWordCount(),
+           index.GetPostingSize() / 1e6);
+
+    printf("%-26s %8s %12s %10s %12s\n", "query", "hits", "index", "scan hits", "linear scan");
+    for (const char* query : kQueries)
+    {
+        std::vector<UpdateCheck::ReleaseSearchIndex::SearchHit> hits;
+        stopwatch.Restart();
+        for (int i = 0; i < kQueryIterations; ++i)
+        {
+            index.Search(query, hits);
+        }
+
+        const double index_ms = stopwatch.ElapsedMs() / kQueryIterations;
+
+        stopwatch.Restart();
+        const size_t scan_hit_count = ScanReleases(manifests, query);
+        const double scan_ms        = stopwatch.ElapsedMs();
+
+        printf("%-26s %8zu %9.3f ms %10zu %9.1f ms\n", query, hits.size(), index_ms, scan_hit_count, scan_ms);
+    }
+
+    // Replace one manifest, as a periodic check that found a changed manifest does.
+    manifests[3].releases[5].title = "Fixed the Vulkan capture crash on Navi";
+    stopwatch.Restart();
+    index.SetManifest("manifest3", manifests[3]);
+    printf("Replacing a manifest of %zu releases: %.2f ms\n", kReleasesPerManifest, stopwatch.ElapsedMs());
+
+    std::vector<UpdateCheck::ReleaseSearchIndex::SearchHit> hits;
+    index.Search("navi", hits);
+    if (hits.size() != 1)
+    {
+        fprintf(stderr, "The replaced manifest was not indexed.\n");
+        return EXIT_FAILURE;
+    }
+
+    index.RemoveManifest("manifest3");
+    stopwatch.Restart();
+    index.Compact();
+    printf("Compacting %zu documents: %.0f ms\n", index.GetDocumentCount(), stopwatch.ElapsedMs());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,185 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""A stand-in server that emulates the round trips of a remote server, for the transport benchmarks.
+
+Usage: latency_server.py [--rtt <ms>] [--tls <certificate> <key>] [--http2]
+
+Each new connection waits one round trip before it is served, two with TLS,
+and each response one more. GET /<anything>?ms=<n> answers with a small JSON
+file after another n milliseconds. With --http2, TLS connections offer h2,
+and GET /slow/<anything> sends its body but holds the stream open for 5
+seconds unless the client resets it. GET /idle/<ms> makes the server close
+HTTP/1.1 connections that are idle for longer than that; 0 never closes them.
+GET /stats reports the counters "connections", "requests" and "resets". Run
+it with tests/standin/run_standin_test.py, which passes its port to the
+benchmark.
+
+Unlike the stand-ins of the tests, this one serves connections with asyncio
+instead of a thread each, so that it can hold thousands of them, and speaks
+HTTP/2. HTTP/2 needs the h2 package; without it, the server prints "SKIP".
+"""
+
+import argparse
+import asyncio
+import json
+import ssl
+import urllib.parse
+
+# The body of each response.
+BODY = json.dumps({"SchemaVersion": "1.6", "Releases": []}).encode("utf-8")
+
+# How long /slow/ streams are held open, in seconds.
+SLOW_STREAM_TIME_S = 5.0
+
+
+class LatencyServer:
+    def __init__(self, rtt_s, is_tls):
+        self.rtt_s = rtt_s
+        self.is_tls = is_tls
+        self.idle_timeout_s = None
+        self.counters = {"connections": 0, "requests": 0, "resets": 0}
+
+    async def respond(self, path):
+        """Wait like a remote server would, and get the status and body of the response to a request."""
+        url = urllib.parse.urlsplit(path)
+        if url.path == "/stats":
+            return 200, json.dumps(self.counters).encode("utf-8")
+
+        if url.path.startswith("/idle/"):
+            idle_timeout_ms = int(url.path[len("/idle/"):])
+            self.idle_timeout_s = idle_timeout_ms / 1000.0 if idle_timeout_ms > 0 else None
+            return 200, b"{}"
+
+        self.counters["requests"] += 1
+        service_time_ms = int(urllib.parse.parse_qs(url.query).get("ms", ["0"])[0])
+        await asyncio.sleep(self.rtt_s + service_time_ms / 1000.0)
+        return 200, BODY
+
+    async def serve_connection(self, reader, writer):
+        self.counters["connections"] += 1
+        await asyncio.sleep(self.rtt_s * (2 if self.is_tls else 1))
+
+        try:
+            ssl_object = writer.get_extra_info("ssl_object")
+            if ssl_object is not None and ssl_object.selected_alpn_protocol() == "h2":
+                await self.serve_http2(reader, writer)
+            else:
+                await self.serve_http1(reader, writer)
+        except (ConnectionError, asyncio.IncompleteReadError, ssl.SSLError):
+            pass
+        finally:
+            writer.close()
+
+    async def serve_http1(self, reader, writer):
+        while True:
+            try:
+                request_line = await asyncio.wait_for(reader.readline(), self.idle_timeout_s)
+            except asyncio.TimeoutError:
+                return
+            if not request_line:
+                return
+
+            content_length = 0
+            while True:
+                header = await reader.readline()
+                if header in (b"\r\n", b""):
+                    break
+                name, _, value = header.decode("latin-1").partition(":")
+                if name.strip().lower() == "content-length":
+                    content_length = int(value)
+            await reader.readexactly(content_length)
+
+            status, body = await self.respond(request_line.decode("latin-1").split(" ")[1])
+            writer.write(b"HTTP/1.1 %d OK\r\nContent-Type: application/json\r\nContent-Length: %d\r\n\r\n" % (status, len(body)) + body)
+            await writer.drain()
+
+    async def serve_http2(self, reader, writer):
+        import h2.config
+        import h2.connection
+        import h2.events
+
+        connection = h2.connection.H2Connection(h2.config.H2Configuration(client_side=False, header_encoding="utf-8"))
+        connection.initiate_connection()
+        writer.write(connection.data_to_send())
+
+        streams = {}
+        try:
+            while True:
+                data = await reader.read(65536)
+                if not data:
+                    return
+
+                for event in connection.receive_data(data):
+                    if isinstance(event, h2.events.RequestReceived):
+                        path = dict(event.headers)[":path"]
+                        streams[event.stream_id] = asyncio.ensure_future(self.serve_stream(connection, writer, event.stream_id, path))
+                    elif isinstance(event, h2.events.StreamReset):
+                        self.counters["resets"] += 1
+                        stream = streams.pop(event.stream_id, None)
+                        if stream is not None:
+                            stream.cancel()
+                    elif isinstance(event, h2.events.ConnectionTerminated):
+                        return
+
+                writer.write(connection.data_to_send())
+                await writer.drain()
+        finally:
+            for stream in streams.values():
+                stream.cancel()
+
+    async def serve_stream(self, connection, writer, stream_id, path):
+        import h2.exceptions
+
+        try:
+            status, body = await self.respond(path)
+            is_slow = urllib.parse.urlsplit(path).path.startswith("/slow/")
+            headers = [(":status", str(status)), ("content-type", "application/json")]
+            if not is_slow:
+                headers.append(("content-length", str(len(body))))
+
+            connection.send_headers(stream_id, headers)
+            connection.send_data(stream_id, body, end_stream=not is_slow)
+            writer.write(connection.data_to_send())
+
+            if is_slow:
+                await asyncio.sleep(SLOW_STREAM_TIME_S)
+                connection.end_stream(stream_id)
+                writer.write(connection.data_to_send())
+        except h2.exceptions.H2Error:
+            pass
+
+
+async def main():
+    parser = argparse.ArgumentParser(description="A stand-in server that emulates the round trips of a remote server.")
+    parser.add_argument("--rtt", type=float, default=20.0, help="the emulated round trip time in milliseconds")
+    parser.add_argument("--tls", nargs=2, metavar=("CERTIFICATE", "KEY"), help="serve HTTPS with this certificate")
+    parser.add_argument("--http2", action="store_true", help="offer HTTP/2 to TLS connections")
+    arguments = parser.parse_args()
+
+    context = None
+    if arguments.tls:
+        context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        context.load_cert_chain(*arguments.tls)
+        protocols = ["http/1.1"]
+        if arguments.http2:
+            try:
+                import h2  # noqa: F401
+            except ImportError:
+                print("SKIP The h2 package is not installed.", flush=True)
+                return
+            protocols.insert(0, "h2")
+        context.set_alpn_protocols(protocols)
+
+    latency_server = LatencyServer(arguments.rtt / 1000.0, context is not None)
+    server = await asyncio.start_server(latency_server.serve_connection, "127.0.0.1", 0, ssl=context, backlog=4096)
+    print("PORT %d" % server.sockets[0].getsockname()[1], flush=True)
+    async with server:
+        await server.serve_forever()
+
+
+if __name__ == "__main__":
+    try:
+        asyncio.run(main())
+    except KeyboardInterrupt:
+        pass
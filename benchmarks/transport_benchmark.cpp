@@ -0,0 +1,169 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Measures batches of downloads with CurlTransport against one download at a time.
+///
+/// Usage: transport_benchmark <server URL> [fetch count...]
+///
+/// Runs against benchmarks/standin/latency_server.py, which emulates a round
+/// trip per connection and per response:
+///
+///   python3 tests/standin/run_standin_test.py benchmarks/standin/latency_server.py --rtt 20 --
+///           ./transport_benchmark http://127.0.0.1:{port}
+///
+/// Each batch is downloaded with one Fetch() call, with and without a limit on
+/// the connections per host. Up to 100 files are also downloaded one at a time
+/// over a reused connection, and with one curl process per file, the way rtda
+/// is launched for each download.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "update_check_api_curl_transport.h"
+#include "update_check_api_utils.h"
+
+/// The largest number of files that are downloaded one at a time.
+static const size_t kMaxSequentialCount = 100;
+
+/// @brief Print a line of measurements.
+///
+/// @param [in] mode        A description of how the files were downloaded.
+/// @param [in] count       The number of files.
+/// @param [in] wall_ms     How long downloading all files took, in milliseconds.
+/// @param [in] connections The number of connections that were opened.
+/// @param [in] latencies   How long each download took, in milliseconds.
+/// @param [in] failures    The number of downloads that failed.
+static void PrintRow(const char* mode, size_t count, double wall_ms, long connections, const std::vector<double>& latencies, int failures)
+{
+    printf("%-28s %6zu %10.0f ms %12ld %8.1f ms %8.1f ms %9d\n",
+           mode,
+           count,
+           wall_ms,
+           connections,
+           UpdateCheckBenchmarks::Percentile(latencies, 0.5),
+           UpdateCheckBenchmarks::Percentile(latencies, 0.99),
+           failures);
+}
+
+/// @brief Download files with one Fetch() call.
+///
+/// @param [in] mode     A description of the transport.
+/// @param [in] requests The files to download.
+/// @param [in] options  The options of the transport.
+static void FetchBatch(const char* mode, const std::vector<UpdateCheck::TransferRequest>& requests, const UpdateCheck::TransportOptions& options)
+{
+    UpdateCheck::CurlTransport transport(options);
+
+    // The second batch runs on the connections that the first one left open.
+    for (int batch = 0; batch < 2; ++batch)
+    {
+        std::vector<UpdateCheck::TransferResult> results;
+        UpdateCheckBenchmarks::Stopwatch         stopwatch;
+        transport.Fetch(requests, results, nullptr);
+        const double wall_ms = stopwatch.ElapsedMs();
+
+        std::vector<double> latencies;
+        long                connections = 0;
+        int                 failures    = 0;
+        for (const UpdateCheck::TransferResult& result : results)
+        {
+            latencies.push_back(result.timing.total);
+            connections += result.new_connections;
+            failures += result.was_successful ? 0 : 1;
+        }
+
+        PrintRow((batch == 0) ? mode : "  same transport again", requests.size(), wall_ms, connections, latencies, failures);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <server URL> [fetch count...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string   server_url = argv[1];
+    std::vector<size_t> counts;
+    for (int i = 2; i < argc; ++i)
+    {
+        counts.push_back(strtoul(argv[i], nullptr, 10));
+    }
+
+    if (counts.empty())
+    {
+        counts = {10, 100, 1000};
+    }
+
+    printf("%-28s %6s %13s %12s %11s %11s %9s\n", "mode", "files", "wall", "connections", "p50", "p99", "failures");
+
+    for (size_t count : counts)
+    {
+        std::vector<UpdateCheck::TransferRequest> requests(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            requests[i].url = server_url + "/file" + std::to_string(i) + ".json";
+        }
+
+        UpdateCheck::TransportOptions unlimited_options;
+        unlimited_options.max_connections      = 0;
+        unlimited_options.max_host_connections = 0;
+        FetchBatch("CurlTransport batch", requests, unlimited_options);
+
+        UpdateCheck::TransportOptions default_options;
+        FetchBatch("CurlTransport batch, 8/host", requests, default_options);
+
+        if (count > kMaxSequentialCount)
+        {
+            continue;
+        }
+
+        // One file at a time over a reused connection.
+        {
+            UpdateCheck::CurlTransport       transport(default_options);
+            std::vector<double>              latencies;
+            long                             connections = 0;
+            int                              failures    = 0;
+            UpdateCheckBenchmarks::Stopwatch stopwatch;
+            for (const UpdateCheck::TransferRequest& request : requests)
+            {
+                UpdateCheck::TransferResult result;
+                failures += transport.Fetch(request, result) ? 0 : 1;
+                latencies.push_back(result.timing.total);
+                connections += result.new_connections;
+            }
+
+            PrintRow("sequential, reused", count, stopwatch.ElapsedMs(), connections, latencies, failures);
+        }
+
+        // One curl process per file, like rtda.
+        {
+            std::vector<double>              latencies;
+            int                              failures = 0;
+            UpdateCheckBenchmarks::Stopwatch stopwatch;
+            for (const UpdateCheck::TransferRequest& request : requests)
+            {
+                const bool                       cancel_signal = false;
+                const std::string                command       = "curl -s \"" + request.url + "\"";
+                std::string                      output;
+                UpdateCheckBenchmarks::Stopwatch download_stopwatch;
+                UpdateCheckApiUtils::ExecAndGrabOutput(command.c_str(), cancel_signal, output);
+                latencies.push_back(download_stopwatch.ElapsedMs());
+                failures += output.empty() ? 1 : 0;
+            }
+
+            PrintRow("process per file", count, stopwatch.ElapsedMs(), static_cast<long>(count), latencies, failures);
+        }
+    }
+
+    nlohmann::json counters = UpdateCheckBenchmarks::GetServerCounters(server_url);
+    printf("The server accepted %d connections for %d requests.\n", counters.value("connections", 0), counters.value("requests", 0));
+
+    return EXIT_SUCCESS;
+}
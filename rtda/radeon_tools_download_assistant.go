@@ -8,8 +8,8 @@ import (
     "os"
 )
 
-var rtda_version = "1.0.1"
-var update_check_api_version = "2.1.1"
+var rtda_version = "1.1.0"
+var update_check_api_version = "3.0.0"
 
 func main() {
 
@@ -24,31 +24,30 @@ func main() {
     if (argCount != 2) {
         fmt.Printf("Usage: rtda url local_path\n")
         fmt.Printf("\turl - The url to the file to download\n")
-        fmt.Printf("\tlocal_path - The path and filename to save the downloaded file\n")
+        fmt.Printf("\tlocal_path - The path and filename to save the downloaded file, or - to write it to standard output\n")
         os.Exit(1)
     }
 
     fileUrl := os.Args[1]
     localPath := os.Args[2]
 
+    // Exit with a non-zero status on failure, so that the caller does not mistake an
+    // incomplete download, or the body of an error page, for the file.
     err := DownloadFile(localPath, fileUrl)
     if (err != nil) {
-        panic(err)
+        fmt.Fprintf(os.Stderr, "Error: %v\n", err)
+        os.Exit(1)
     }
 }
 
 
 // DownloadFile will download a url to a local file. It's efficient because it will
-// write as it downloads and not load the whole file into memory.
+// write as it downloads and not load the whole file into memory. If filepath is "-",
+// the file is written to standard output so that the caller can consume it while it
+// is still being downloaded. A response with an HTTP error status is an error, and its
+// body is not written.
 func DownloadFile(filepath string, url string) error {
 
-    // Create the file
-    out, err := os.Create(filepath)
-    if err != nil {
-        return err
-    }
-    defer out.Close()
-
     // Get the data
     resp, err := http.Get(url)
     if err != nil {
@@ -56,6 +55,21 @@ func DownloadFile(filepath string, url string) error {
     }
     defer resp.Body.Close()
 
+    if resp.StatusCode >= 400 {
+        return fmt.Errorf("the server responded with HTTP status %d", resp.StatusCode)
+    }
+
+    // Create the file
+    var out io.Writer = os.Stdout
+    if filepath != "-" {
+        file, err := os.Create(filepath)
+        if err != nil {
+            return err
+        }
+        defer file.Close()
+        out = file
+    }
+
     // Write the body to file
     _, err = io.Copy(out, resp.Body)
     if err != nil {
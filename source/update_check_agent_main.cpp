@@ -0,0 +1,92 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief The update check agent executable.
+///
+/// Run one agent per user, for example from a user service or a login item.
+/// It serves all tools of the user until it receives SIGINT, SIGTERM or SIGHUP.
+///
+/// Usage: update_check_agent [--socket <path>] [--cache-timeout <seconds>] [--refresh-interval <seconds>]
+//==============================================================================
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <signal.h>
+#endif
+
+#include "update_check_api_agent.h"
+
+/// @brief Print how to run the agent.
+///
+/// @param [in] program_name The name that the agent was run with.
+static void PrintUsage(const char* program_name)
+{
+    fprintf(stderr, "Usage: %s [--socket <path>] [--cache-timeout <seconds>] [--refresh-interval <seconds>]\n", program_name);
+}
+
+int main(int argc, char* argv[])
+{
+    UpdateCheck::AgentOptions options;
+    bool                      is_valid = true;
+
+    for (int i = 1; is_valid && i < argc; ++i)
+    {
+        const bool has_value = (i + 1 < argc);
+
+        if (strcmp(argv[i], "--socket") == 0 && has_value)
+        {
+            options.socket_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cache-timeout") == 0 && has_value)
+        {
+            options.cache_timeout_s = strtol(argv[++i], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "--refresh-interval") == 0 && has_value)
+        {
+            options.refresh_interval_s = strtol(argv[++i], nullptr, 10);
+        }
+        else
+        {
+            is_valid = false;
+        }
+    }
+
+    if (!is_valid || options.cache_timeout_s < 0 || options.refresh_interval_s <= 0)
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+#ifndef _WIN32
+    // Block the signals before any thread starts, so that only sigwait() below receives them.
+    sigset_t stop_signals;
+    sigemptyset(&stop_signals);
+    sigaddset(&stop_signals, SIGINT);
+    sigaddset(&stop_signals, SIGTERM);
+    sigaddset(&stop_signals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &stop_signals, nullptr);
+#endif
+
+    UpdateCheck::Agent agent(options);
+    std::string        error_message;
+
+    if (!agent.Start(error_message))
+    {
+        fprintf(stderr, "%s\n", error_message.c_str());
+        return EXIT_FAILURE;
+    }
+
+#ifndef _WIN32
+    int stop_signal = 0;
+    sigwait(&stop_signals, &stop_signal);
+#endif
+
+    agent.Stop();
+
+    return EXIT_SUCCESS;
+}
@@ -5,8 +5,19 @@
 /// @brief An API for checking for updates to an application.
 //==============================================================================
 #include "update_check_api.h"
+#include "update_check_api_agent.h"
 #include "update_check_api_strings.h"
 #include "update_check_api_utils.h"
+#include "update_check_api_json_tape.h"
+#include "update_check_api_network_watcher.h"
+#include "update_check_api_shared_buffer.h"
+#include "update_check_api_utf8.h"
+
+#ifdef UPDATECHECKAPI_CURL
+#include "update_check_api_curl_transport.h"
+#include "update_check_api_github_graphql.h"
+#include "update_check_api_github_releases.h"
+#endif
 
 #ifdef _WIN32
 #pragma warning(push)
@@ -19,10 +30,17 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
 #include <assert.h>
 #include <sstream>
 #include <fstream>
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 #ifdef WIN32
 #define updater_sscanf sscanf_s
@@ -39,11 +57,20 @@
 
 using namespace UpdateCheck;
 using json = nlohmann::json;
+using UpdateCheckApiJson::JsonSpan;
+using UpdateCheckApiJson::JsonStreamScanner;
+using UpdateCheckApiJson::JsonTape;
+using UpdateCheckApiJson::JsonValue;
+using UpdateCheckApiUtils::SharedBuffer;
+using UpdateCheckApiUtils::SharedBufferWriter;
 
 const int kNewer = 1;
 const int kOlder = -1;
 const int kEqual = 0;
 
+// The size of the chunks in which a local version file is streamed to the parser.
+const size_t kStreamChunkSize = 65536;
+
 VersionInfo UpdateCheck::GetApiVersionInfo()
 {
     VersionInfo version;
@@ -55,6 +82,46 @@ VersionInfo UpdateCheck::GetApiVersionInfo()
     return version;
 }
 
+/// @brief Helper function to append an error message to the error messages of a call.
+///
+/// A call can fail for several reasons that are reported one after the other, so the message
+/// is separated by a space from any message that was appended before it.
+///
+/// @param [in]     message       The error message to append.
+/// @param [in,out] error_message The error messages of the call.
+static void AppendErrorMessage(const std::string& message, std::string& error_message)
+{
+    if (!error_message.empty() && !message.empty() && !std::isspace(static_cast<unsigned char>(error_message.back())))
+    {
+        error_message.push_back(' ');
+    }
+
+    error_message.append(message);
+}
+
+/// @brief Helper function to check that a URL has no characters that a URL never contains unencoded.
+///
+/// URLs can come from a downloaded version file. Spaces, quotes, backslashes and control characters
+/// are rejected, so that such a URL cannot be mistaken for more than one argument of a command.
+///
+/// @param [in] url The URL to check.
+///
+/// @return true if the URL has only characters that may appear in a URL; false otherwise.
+static bool IsValidUrl(const std::string& url)
+{
+    static const char* const kInvalidUrlCharacters = "\"'<>\\^`{|}";
+
+    bool is_valid = !url.empty();
+    for (size_t i = 0; i < url.size() && is_valid; ++i)
+    {
+        const unsigned char c = static_cast<unsigned char>(url[i]);
+        is_valid              = (c > ' ' && c < 0x7f && std::strchr(kInvalidUrlCharacters, c) == nullptr);
+    }
+
+    return is_valid;
+}
+
+#ifndef UPDATECHECKAPI_CURL
 /// @brief Helper function to execute the Radeon Tools Download Assistant.
 ///
 /// @param [in]  remote_url    The URL of the file to download.
@@ -68,71 +135,387 @@ static bool ExecDownloader(const std::string& remote_url, const std::string& loc
 
     try
     {
-        bool        cancel_signal = false;
-        std::string command_output;
+        bool              cancel_signal = false;
+        std::string       command_error_message;
+        std::vector<char> command_output;
+
+        // rtda is started without a shell, so the URL reaches it as a single argument whatever it contains.
+        std::vector<std::string> args;
+        args.push_back(kStringDownloaderApplication);
+        args.push_back(remote_url);
+        args.push_back(local_file);
+
+        if (!IsValidUrl(remote_url))
+        {
+            error_message.append(kStringErrorUrlContainsInvalidCharacters);
+            error_message.append(remote_url);
+        }
+        else
+        {
+            // Download the file. Anything that rtda prints is discarded.
+            was_launched = UpdateCheckApiUtils::ExecAndStreamOutput(
+                args,
+                cancel_signal,
+                [&command_output](size_t size) {
+                    command_output.resize(size);
+                    return command_output.data();
+                },
+                [](const char*, size_t) { return true; },
+                command_error_message);
+
+            if (!was_launched)
+            {
+                AppendErrorMessage(kStringErrorFailedToLaunchVersionFileDownloader, error_message);
+                AppendErrorMessage(command_error_message, error_message);
+            }
+        }
+    }
+    catch (std::exception& e)
+    {
+        was_launched = false;
+        AppendErrorMessage(kStringErrorFailedToLaunchVersionFileDownloaderUnknownError, error_message);
+        error_message.append(e.what());
+    }
+
+    return was_launched;
+}
+#endif  // !UPDATECHECKAPI_CURL
+
+/// @brief Helper function to get the request headers that tell the server which version files the client understands.
+///
+/// A server, like a caching proxy, can use them to serve the newest schema, which is parsed on the
+/// fast path, in the most compact encoding, instead of the oldest schema as JSON that every client
+/// understands. A server that ignores them still serves JSON.
+///
+/// @param [in] accepts_binary_encodings True if the version file may be sent as CBOR or MessagePack; false if it must be JSON, because it is parsed while it arrives.
+///
+/// @return The request headers.
+static std::vector<std::string> GetVersionFileRequestHeaders(bool accepts_binary_encodings)
+{
+    std::vector<std::string> request_headers;
+    request_headers.push_back(accepts_binary_encodings ? kStringHeaderAcceptVersionFile : kStringHeaderAcceptJson);
+    request_headers.push_back(kStringHeaderMaxSchemaVersion);
+    return request_headers;
+}
+
+/// @brief Helper function to execute the Radeon Tools Download Assistant and stream the downloaded file.
+///
+/// @param [in]  remote_url      The URL of the file to download.
+/// @param [in]  request_headers Additional request headers; only the in-process transport sends them, because rtda cannot.
+/// @param [in]  buffer_callback The function that provides the memory that each chunk of the file is received into.
+/// @param [in]  output_callback The function that receives the contents of the file as they arrive.
+/// @param [out] error_message   Any error messages that occurred.
+///
+/// @return true if the file was downloaded, or the callback stopped the download; false otherwise.
+static bool ExecDownloaderToStream(const std::string&                             remote_url,
+                                   const std::vector<std::string>&                  request_headers,
+                                   const UpdateCheckApiUtils::OutputBufferCallback& buffer_callback,
+                                   const UpdateCheckApiUtils::OutputCallback&       output_callback,
+                                   std::string&                                     error_message)
+{
+    bool was_launched = false;
+
+    try
+    {
+#ifdef UPDATECHECKAPI_CURL
+        // Download in-process. Each chunk arrives in libcurl's buffer, and is copied to the memory that the caller provides.
+        bool            was_stopped = false;
+        TransferRequest request;
+        TransferResult  result;
 
-        // Setup the cmd line.
-        std::string cmd_line = kStringDownloaderApplication;
-        cmd_line += " \"";
-        cmd_line += remote_url;
-        cmd_line += "\" ";
-        cmd_line += local_file;
+        request.url           = remote_url;
+        request.headers       = request_headers;
+        request.data_callback = [&buffer_callback, &output_callback, &was_stopped](const char* data, size_t size) {
+            char* chunk = buffer_callback(size);
+            std::memcpy(chunk, data, size);
+            was_stopped = !output_callback(chunk, size);
+            return !was_stopped;
+        };
 
-        // Download the file.
-        was_launched = UpdateCheckApiUtils::ExecAndGrabOutput(cmd_line.c_str(), cancel_signal, command_output);
+        was_launched = CurlTransport::GetDefault().Fetch(request, result) || was_stopped;
 
         if (!was_launched)
         {
-            error_message.append(kStringErrorFailedToLaunchVersionFileDownloader);
+            AppendErrorMessage(result.error_message, error_message);
+        }
+#else
+        UNREFERENCED_PARAMETER(request_headers);
+        bool        cancel_signal = false;
+        std::string command_error_message;
+
+        // rtda is started without a shell, so the URL reaches it as a single argument whatever it contains.
+        std::vector<std::string> args;
+        args.push_back(kStringDownloaderApplication);
+        args.push_back(remote_url);
+        args.push_back(kStringDownloaderStandardOutput);
+
+        if (!IsValidUrl(remote_url))
+        {
+            AppendErrorMessage(kStringErrorUrlContainsInvalidCharacters, error_message);
+            error_message.append(remote_url);
+        }
+        else
+        {
+            // Download the file. rtda exits with a non-zero code if the download failed, even after part of it was received.
+            was_launched = UpdateCheckApiUtils::ExecAndStreamOutput(args, cancel_signal, buffer_callback, output_callback, command_error_message);
+
+            if (!was_launched)
+            {
+                AppendErrorMessage(kStringErrorTransferFailed, error_message);
+                error_message.append(remote_url);
+                error_message.append(": ");
+                error_message.append(command_error_message);
+            }
         }
+#endif  // UPDATECHECKAPI_CURL
     }
     catch (std::exception& e)
     {
         was_launched = false;
-        error_message.append(kStringErrorFailedToLaunchVersionFileDownloaderUnknownError);
+        AppendErrorMessage(kStringErrorFailedToLaunchVersionFileDownloaderUnknownError, error_message);
         error_message.append(e.what());
     }
 
     return was_launched;
 }
 
+#ifdef UPDATECHECKAPI_CURL
+/// @brief Helper function to get the media type of a Content-Type header, without its parameters.
+///
+/// @param [in] content_type The Content-Type header, like "application/json; charset=utf-8".
+///
+/// @return The media type in lower case, like "application/json".
+static std::string GetMediaType(const std::string& content_type)
+{
+    std::string media_type = content_type.substr(0, content_type.find(';'));
+    size_t      type_start = media_type.find_first_not_of(" \t");
+    size_t      type_end   = media_type.find_last_not_of(" \t");
+    media_type             = (type_start == std::string::npos) ? std::string() : media_type.substr(type_start, type_end - type_start + 1);
+    std::transform(media_type.begin(), media_type.end(), media_type.begin(), ::tolower);
+    return media_type;
+}
+
+/// @brief Helper function to decode a version file that the server sent as CBOR or MessagePack.
+///
+/// The document is written back out as JSON text, so that it is parsed by the same code,
+/// and its releases can refer to the same buffer, as a version file that was sent as JSON.
+///
+/// @param [in]  encoded_buffer The encoded version file.
+/// @param [in]  is_cbor        True if the version file is CBOR; false if it is MessagePack.
+/// @param [out] json_buffer    The version file as JSON text.
+/// @param [out] error_message  Any error messages that occurred.
+///
+/// @return true if the version file was decoded; false otherwise.
+static bool DecodeBinaryJson(const SharedBuffer& encoded_buffer, bool is_cbor, SharedBuffer& json_buffer, std::string& error_message)
+{
+    bool is_decoded = false;
+
+    try
+    {
+        const uint8_t* data     = reinterpret_cast<const uint8_t*>(encoded_buffer.Data());
+        json           document = is_cbor ? json::from_cbor(data, data + encoded_buffer.Size()) : json::from_msgpack(data, data + encoded_buffer.Size());
+
+        json_buffer = SharedBuffer(std::make_shared<const std::string>(document.dump()));
+        is_decoded  = true;
+    }
+    catch (json::exception& e)
+    {
+        error_message.append(kStringErrorFailedToDecodeVersionFile);
+        error_message.append(e.what());
+    }
+
+    return is_decoded;
+}
+
+/// @brief Helper function to take the contents of a json file that the in-process transport downloaded.
+///
+/// The contents are validated as UTF-8, the same as a file that is loaded from disk, unless the
+/// server sent them as CBOR or MessagePack, in which case they are decoded to JSON text.
+///
+/// @param [in]  result        The outcome of the download.
+/// @param [out] json_buffer   The contents of the JSON file.
+/// @param [out] error_message Any error messages that occurred.
+///
+/// @return true if the file was downloaded, and is not empty and valid UTF-8 or could be decoded; false otherwise.
+static bool TakeDownloadedJson(const TransferResult& result, SharedBuffer& json_buffer, std::string& error_message)
+{
+    bool              is_loaded  = false;
+    const std::string media_type = GetMediaType(result.content_type);
+
+    if (!result.was_successful)
+    {
+        error_message.append(result.error_message);
+    }
+    else if (result.body.Empty())
+    {
+        error_message.append(kStringErrorDownloadedAnEmptyVersionFile);
+    }
+    else if (media_type == kStringMediaTypeCbor || media_type == kStringMediaTypeMessagePack || media_type == kStringMediaTypeMessagePackLegacy)
+    {
+        is_loaded = DecodeBinaryJson(result.body, media_type == kStringMediaTypeCbor, json_buffer, error_message);
+    }
+    else if (!UpdateCheckApiUtils::IsValidUtf8(result.body.Data(), result.body.Size()))
+    {
+        error_message.append(kStringErrorDownloadedFileIsNotValidUtf8);
+    }
+    else
+    {
+        is_loaded   = true;
+        json_buffer = result.body;
+    }
+
+    return is_loaded;
+}
+
+/// @brief Helper function to download a json file into memory with the in-process transport.
+///
+/// The contents are validated as UTF-8, the same as a file that is loaded from disk.
+///
+/// @param [in]  json_file_url   URL of the JSON file to download.
+/// @param [in]  request_headers Additional request headers.
+/// @param [out] json_buffer     The contents of the JSON file.
+/// @param [out] error_message   Any error messages that occurred.
+///
+/// @retval true on success; json_buffer will have the contents of the file at json_file_url.
+/// @retval false on failure; json_buffer will be empty.
+static bool DownloadJsonToBuffer(const std::string&              json_file_url,
+                                 const std::vector<std::string>& request_headers,
+                                 SharedBuffer&                   json_buffer,
+                                 std::string&                    error_message)
+{
+    bool is_loaded = false;
+    json_buffer    = SharedBuffer();
+
+    try
+    {
+        TransferRequest request;
+        TransferResult  result;
+        request.url     = json_file_url;
+        request.headers = request_headers;
+
+        CurlTransport::GetDefault().Fetch(request, result);
+        is_loaded = TakeDownloadedJson(result, json_buffer, error_message);
+    }
+    catch (std::exception& e)
+    {
+        is_loaded = false;
+        error_message.append(kStringErrorUnknownErrorOccurred);
+        error_message.append(e.what());
+    }
+
+    return is_loaded;
+}
+#endif  // UPDATECHECKAPI_CURL
+
 /// @brief Helper function to load a json file from disk.
 ///
+/// The contents are validated as UTF-8 so that binary data, such as a page served by
+/// a captive portal, is rejected before any parsing is attempted.
+///
 /// @param [in]  json_file_path Path to the local JSON file.
-/// @param [out] json_string    The contents of the JSON file.
+/// @param [out] json_buffer    The contents of the JSON file, read directly into a shared block.
 /// @param [out] error_message  Any error messages that occurred.
 ///
-/// @retval true on success; json_string will have the contents of the file at json_file_url.
-/// @retval false on failure; json_string will be unchanged.
-static bool LoadJsonFile(const std::string& json_file_path, std::string& json_string, std::string& error_message)
+/// @retval true on success; json_buffer will have the contents of the file at json_file_url.
+/// @retval false on failure; json_buffer will be empty.
+static bool LoadJsonFile(const std::string& json_file_path, SharedBuffer& json_buffer, std::string& error_message)
 {
     bool is_loaded = true;
-    json_string.clear();
+    json_buffer    = SharedBuffer();
 
     // Open the file.
-    std::ifstream read_file(json_file_path.c_str());
+    std::ifstream read_file(json_file_path.c_str(), std::ios::binary);
     if (!read_file.good())
     {
         is_loaded = false;
-        error_message.append(kStringErrorFailedToLoadVersionFile);
+        AppendErrorMessage(kStringErrorFailedToLoadVersionFile, error_message);
     }
     else
     {
-        // Copy the file contents into the string.
-        json_string.assign((std::istreambuf_iterator<char>(read_file)), std::istreambuf_iterator<char>());
+        // Read the file straight into the block that the parser and the releases will share.
+        // The size is only a hint, in case the file is still being written.
+        SharedBufferWriter writer;
+        read_file.seekg(0, std::ios::end);
+        std::streamoff file_size = read_file.tellg();
+        read_file.seekg(0, std::ios::beg);
+
+        size_t read_size = (file_size > 0) ? static_cast<size_t>(file_size) + 1 : kStreamChunkSize;
+        while (read_file.good())
+        {
+            read_file.read(writer.Prepare(read_size), read_size);
+            writer.Commit(static_cast<size_t>(read_file.gcount()));
+            read_size = kStreamChunkSize;
+        }
 
         read_file.close();
 
         // Consider it loaded if the JSON string is not empty.
-        if (json_string.empty())
+        if (writer.Size() == 0)
         {
             is_loaded = false;
             error_message.append(kStringErrorDownloadedAnEmptyVersionFile);
         }
+        else if (!UpdateCheckApiUtils::IsValidUtf8(writer.Data(), writer.Size()))
+        {
+            is_loaded = false;
+            error_message.append(kStringErrorDownloadedFileIsNotValidUtf8);
+        }
         else
         {
-            is_loaded = true;
+            is_loaded   = true;
+            json_buffer = writer.Publish();
+        }
+    }
+
+    return is_loaded;
+}
+
+/// @brief Helper function to stream a json file from disk into a push parser.
+///
+/// @param [in]  json_file_path Path to the local JSON file.
+/// @param [in]  parser         The parser that receives the contents of the file.
+/// @param [out] error_message  Any error messages that occurred.
+///
+/// @return true if the file was opened; false otherwise.
+static bool StreamJsonFile(const std::string& json_file_path, ManifestPushParser& parser, std::string& error_message)
+{
+    bool is_loaded = true;
+
+    // Open the file.
+    std::ifstream read_file(json_file_path.c_str(), std::ios::binary);
+    if (!read_file.good())
+    {
+        is_loaded = false;
+        AppendErrorMessage(kStringErrorFailedToLoadVersionFile, error_message);
+    }
+    else
+    {
+        // Make room for the whole file up front, so the parser's buffer does not have to grow.
+        read_file.seekg(0, std::ios::end);
+        std::streamoff file_size = read_file.tellg();
+        read_file.seekg(0, std::ios::beg);
+
+        if (file_size > 0)
+        {
+            parser.PrepareFeed(static_cast<size_t>(file_size) + kStreamChunkSize);
+        }
+
+        bool wants_more = true;
+
+        while (wants_more && read_file.good())
+        {
+            // Read each chunk directly into the parser's buffer.
+            char* chunk = parser.PrepareFeed(kStreamChunkSize);
+            read_file.read(chunk, kStreamChunkSize);
+
+            std::streamsize bytes_read = read_file.gcount();
+            if (bytes_read > 0)
+            {
+                wants_more = parser.Feed(chunk, static_cast<size_t>(bytes_read));
+            }
         }
+
+        read_file.close();
     }
 
     return is_loaded;
@@ -141,16 +524,20 @@ static bool LoadJsonFile(const std::string& json_file_path, std::string& json_st
 /// @brief Helper function to download JSON file.
 ///
 /// @param [in]  json_file_url  URL of the JSON file to download.
-/// @param [out] json_string    The contents of the JSON file.
+/// @param [out] json_buffer    The contents of the JSON file.
 /// @param [out] error_message  Any error messages that occurred.
 ///
-/// @retval true on success; json_string will have the contents of the file at json_file_url.
-/// @retval false on failure; json_string will be unchanged.
-static bool DownloadJsonFile(const std::string json_file_url, std::string& json_string, std::string& error_message)
+/// @retval true on success; json_buffer will have the contents of the file at json_file_url.
+/// @retval false on failure; json_buffer will be empty.
+static bool DownloadJsonFile(const std::string json_file_url, SharedBuffer& json_buffer, std::string& error_message)
 {
     bool is_loaded = true;
-    json_string.clear();
+    json_buffer    = SharedBuffer();
 
+#ifdef UPDATECHECKAPI_CURL
+    // Download straight into memory, without a temporary file, in the newest schema and most compact encoding that the server offers.
+    is_loaded = DownloadJsonToBuffer(json_file_url, GetVersionFileRequestHeaders(true), json_buffer, error_message);
+#else
     std::string local_file;
     if (!UpdateCheckApiUtils::GetTempDirectory(local_file))
     {
@@ -189,17 +576,84 @@ static bool DownloadJsonFile(const std::string json_file_url, std::string& json_
         if (!ExecDownloader(json_file_url, local_file, error_message))
         {
             is_loaded = false;
-            error_message.append(kStringErrorFailedToLaunchVersionFileDownloader);
+            AppendErrorMessage(kStringErrorFailedToLaunchVersionFileDownloader, error_message);
         }
         else
         {
-            is_loaded = LoadJsonFile(local_file, json_string, error_message);
+            is_loaded = LoadJsonFile(local_file, json_buffer, error_message);
         }
     }
+#endif  // UPDATECHECKAPI_CURL
 
     return is_loaded;
 }
 
+/// @brief Helper function to download several JSON files concurrently.
+///
+/// @param [in]  json_file_urls URLs of the JSON files to download.
+/// @param [out] json_buffers   The contents of each JSON file; empty for files that could not be downloaded.
+/// @param [out] error_messages Any error messages of each file.
+static void DownloadJsonFiles(const std::vector<std::string>& json_file_urls, std::vector<SharedBuffer>& json_buffers, std::vector<std::string>& error_messages)
+{
+    json_buffers.assign(json_file_urls.size(), SharedBuffer());
+    error_messages.assign(json_file_urls.size(), std::string());
+
+#ifdef UPDATECHECKAPI_CURL
+    // The transport runs the downloads concurrently on this thread; over HTTP/2 they share one connection.
+    std::vector<TransferRequest>   requests(json_file_urls.size());
+    std::vector<TransferResult>    results;
+    const std::vector<std::string> request_headers = GetVersionFileRequestHeaders(true);
+
+    for (size_t i = 0; i < json_file_urls.size(); ++i)
+    {
+        requests[i].url     = json_file_urls[i];
+        requests[i].headers = request_headers;
+    }
+
+    CurlTransport::GetDefault().Fetch(requests, results, nullptr);
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        TakeDownloadedJson(results[i], json_buffers[i], error_messages[i]);
+    }
+#else
+    // Each download launches rtda and waits for it, so each runs on a thread of its own.
+    auto download = [&json_file_urls, &json_buffers, &error_messages](size_t i) {
+        try
+        {
+            DownloadJsonFile(json_file_urls[i], json_buffers[i], error_messages[i]);
+        }
+        catch (std::exception& e)
+        {
+            json_buffers[i] = SharedBuffer();
+            error_messages[i].append(kStringErrorUnknownErrorOccurred);
+            error_messages[i].append(e.what());
+        }
+    };
+
+    std::vector<std::thread> downloads;
+    downloads.reserve(json_file_urls.size());
+
+    for (size_t i = 0; i < json_file_urls.size(); ++i)
+    {
+        try
+        {
+            downloads.push_back(std::thread(download, i));
+        }
+        catch (std::exception&)
+        {
+            // Without another thread, download the file on this one.
+            download(i);
+        }
+    }
+
+    for (std::thread& thread : downloads)
+    {
+        thread.join();
+    }
+#endif  // UPDATECHECKAPI_CURL
+}
+
 /// @brief Given a JSON list of release assets, finds the named asset and returns the associated JSON element.
 ///
 /// @param [in]  asset_list    The "assets" element from a JSON file.
@@ -207,18 +661,18 @@ static bool DownloadJsonFile(const std::string json_file_url, std::string& json_
 /// @param [out] asset_element The associated asset element if the asset name is found.
 ///
 /// @return true if the asset name was found in the asset list, false otherwise.
-static bool FindAssetByName(json& asset_list, const std::string& asset_name, json& asset_element)
+static bool FindAssetByName(const JsonValue& asset_list, const std::string& asset_name, JsonValue& asset_element)
 {
     bool was_asset_found = false;
 
     // Check each asset for the desired asset name.
-    for (json::iterator asset_iter = asset_list.begin(); asset_iter != asset_list.end(); ++asset_iter)
+    for (JsonValue::Iterator asset_iter = asset_list.begin(); asset_iter != asset_list.end(); ++asset_iter)
     {
-        auto asset_name_element = asset_iter->find(kStringTagAssetName);
+        JsonValue asset_name_element = (*asset_iter).Find(kStringTagAssetName);
 
-        if (asset_name_element != asset_iter->end())
+        if (asset_name_element.IsValid())
         {
-            was_asset_found = (0 == asset_name_element->get<std::string>().compare(asset_name));
+            was_asset_found = asset_name_element.Equals(asset_name.c_str());
             if (was_asset_found)
             {
                 asset_element = *asset_iter;
@@ -238,21 +692,20 @@ static bool FindAssetByName(json& asset_list, const std::string& asset_name, jso
 /// @param [out] error_message      Any error messages that occurred.
 ///
 /// @return true if the asset and download URL could be found; false otherwise.
-static bool FindAssetDownloadUrl(json& latest_release, const std::string& asset_name, std::string& asset_download_url, std::string& error_message)
+static bool FindAssetDownloadUrl(const JsonValue& latest_release, const std::string& asset_name, std::string& asset_download_url, std::string& error_message)
 {
     bool has_asset_download_url = false;
 
-    auto assets_element = latest_release.find(kStringTagAssets);
+    JsonValue assets_element = latest_release.Find(kStringTagAssets);
 
-    if (assets_element == latest_release.end())
+    if (!assets_element.IsValid())
     {
         error_message.append(kStringErrorMissingAssetsTags);
     }
     else
     {
-        json& assets_list = *assets_element;
-        json  asset_element;
-        bool  does_asset_exist = FindAssetByName(assets_list, asset_name, asset_element);
+        JsonValue asset_element;
+        bool      does_asset_exist = FindAssetByName(assets_element, asset_name, asset_element);
 
         if (!does_asset_exist)
         {
@@ -260,14 +713,13 @@ static bool FindAssetDownloadUrl(json& latest_release, const std::string& asset_
         }
         else
         {
-            auto asset_url = asset_element.find(kStringTagAssetBrowserDownloadUrl);
-            if (asset_url == asset_element.end())
+            JsonValue asset_url = asset_element.Find(kStringTagAssetBrowserDownloadUrl);
+            if (!asset_url.GetString(asset_download_url))
             {
                 error_message.append(kStringErrorDownloadUrlNotFoundInAsset);
             }
             else
             {
-                asset_download_url     = asset_url->get<std::string>().c_str();
                 has_asset_download_url = true;
             }
         }
@@ -276,19 +728,20 @@ static bool FindAssetDownloadUrl(json& latest_release, const std::string& asset_
     return has_asset_download_url;
 }
 
-/// @brief Helper function to load JSON file from the latest release of a GitHub Repository.
+/// @brief Helper function to download the latest release information from the GitHub Release API.
 ///
-/// @param [in]  json_file_url  URL of the JSON file to download.
-/// @param [in]  json_file_name The local filename to save the downloaded JSON file.
-/// @param [out] json_string    The contents of the downloaded JSON file.
-/// @param [out] error_message  Any error messages that occurred.
+/// @param [in]  json_file_url       URL of the latest release API.
+/// @param [out] latest_release_json The contents of the latest release information.
+/// @param [out] error_message       Any error messages that occurred.
 ///
-/// @retval true on success; json_string will have the contents of the file at json_file_url.
-/// @retval false on failure; json_string will be unchanged.
-static bool LoadJsonFromLatestRelease(const std::string json_file_url, const std::string json_file_name, std::string& json_string, std::string& error_message)
+/// @return true if the latest release information was downloaded; false otherwise.
+static bool DownloadLatestReleaseJson(const std::string& json_file_url, SharedBuffer& latest_release_json, std::string& error_message)
 {
-    bool was_loaded = false;
+    bool is_downloaded = false;
 
+#ifdef UPDATECHECKAPI_CURL
+    is_downloaded = DownloadJsonToBuffer(json_file_url, std::vector<std::string>(), latest_release_json, error_message);
+#else
     // Build a path to a temporary file.
     std::string latest_release_api_temp_file;
     if (!UpdateCheckApiUtils::GetTempDirectory(latest_release_api_temp_file))
@@ -300,68 +753,398 @@ static bool LoadJsonFromLatestRelease(const std::string json_file_url, const std
         latest_release_api_temp_file += "/";
         latest_release_api_temp_file += kStringLatestJsonFilename;
 
+        // Attempt to delete the file of a previous check, so that it is not mistaken for the response when rtda fails.
+        std::remove(latest_release_api_temp_file.c_str());
+
         if (!ExecDownloader(json_file_url, latest_release_api_temp_file, error_message))
         {
-            error_message.append(kStringErrorFailedToLaunchVersionFileDownloader);
+            AppendErrorMessage(kStringErrorFailedToLaunchVersionFileDownloader, error_message);
         }
         else
         {
-            try
+            is_downloaded = LoadJsonFile(latest_release_api_temp_file, latest_release_json, error_message);
+        }
+    }
+#endif  // UPDATECHECKAPI_CURL
+
+    return is_downloaded;
+}
+
+/// @brief Helper function to load JSON file from the latest release of a GitHub Repository.
+///
+/// @param [in]  json_file_url  URL of the JSON file to download.
+/// @param [in]  json_file_name The local filename to save the downloaded JSON file.
+/// @param [out] json_buffer    The contents of the downloaded JSON file.
+/// @param [out] error_message  Any error messages that occurred.
+///
+/// @retval true on success; json_buffer will have the contents of the file at json_file_url.
+/// @retval false on failure; json_buffer will be empty.
+static bool LoadJsonFromLatestRelease(const std::string json_file_url, const std::string json_file_name, SharedBuffer& json_buffer, std::string& error_message)
+{
+    bool was_loaded = false;
+
+    try
+    {
+#ifdef UPDATECHECKAPI_CURL
+        // A batched GraphQL query may have resolved the JSON file already, which saves the request to the REST API.
+        std::string resolved_url;
+        if (FindResolvedLatestReleaseAsset(json_file_url, json_file_name, resolved_url))
+        {
+            std::string resolved_error_message;
+            was_loaded = DownloadJsonFile(resolved_url, json_buffer, resolved_error_message);
+
+            if (!was_loaded)
+            {
+                ForgetResolvedLatestReleaseAsset(json_file_url, json_file_name);
+            }
+        }
+#endif  // UPDATECHECKAPI_CURL
+
+        SharedBuffer latest_release_json;
+        if (!was_loaded && DownloadLatestReleaseJson(json_file_url, latest_release_json, error_message))
+        {
+            // The response may not be valid json. This can happen in networks
+            // that limit internet access, and result in downloading an html page.
+            JsonTape    latest_release_tape;
+            std::string parse_error_message;
+
+            if (!latest_release_tape.Parse(latest_release_json.Data(), latest_release_json.Size(), true, parse_error_message))
+            {
+                AppendErrorMessage(kStringErrorFailedToLoadLatestReleaseInformation, error_message);
+                AppendErrorMessage(parse_error_message, error_message);
+            }
+            else
             {
-                std::string latest_release_json;
-                if (LoadJsonFile(latest_release_api_temp_file, latest_release_json, error_message))
+                JsonValue   latest_release_json_doc = latest_release_tape.Root();
+                std::string version_file_url;
+
+                if (FindAssetDownloadUrl(latest_release_json_doc, json_file_name, version_file_url, error_message))
+                {
+                    was_loaded = DownloadJsonFile(version_file_url, json_buffer, error_message);
+                }
+                else
                 {
-                    // Parsing the json can throw an exception if the string is
-                    // not valid json. This can happen in networks that limit
-                    // internet access, and result in downloading an html page.
-                    json latest_release_json_doc = json::parse(latest_release_json);
+                    // Failed to find the Asset, so check for a "message" tag which may indicate an error from the GitHub Release API.
+                    std::string message;
 
-                    std::string version_file_url;
-                    if (FindAssetDownloadUrl(latest_release_json_doc, json_file_name, version_file_url, error_message))
+                    if (latest_release_json_doc.Find(kStringTagMessage).GetString(message))
                     {
-                        was_loaded = DownloadJsonFile(version_file_url, json_string, error_message);
-                    }
-                    else
-                    {
-                        // Failed to find the Asset, so check for a "message" tag which may indicate an error from the GitHub Release API.
-                        auto message_element = latest_release_json_doc.find(kStringTagMessage);
-
-                        if (message_element != latest_release_json_doc.end())
-                        {
-                            error_message.append(message_element->get<std::string>().c_str());
-                        }
+                        error_message.append(message);
                     }
                 }
             }
-            catch (std::exception& e)
-            {
-                was_loaded = false;
-                error_message.append(kStringErrorFailedToLoadLatestReleaseInformation);
-                error_message.append(e.what());
-            }
         }
     }
+    catch (std::exception& e)
+    {
+        was_loaded = false;
+        AppendErrorMessage(kStringErrorFailedToLoadLatestReleaseInformation, error_message);
+        error_message.append(e.what());
+    }
 
     return was_loaded;
 }
 
-/// @brief Convert VersionInfo to a string.
+#ifdef UPDATECHECKAPI_CURL
+/// @brief Helper function to split a channel URL into the releases URL and the channel.
 ///
-/// @return The stringified version information.
-std::string VersionInfo::ToString() const
+/// @param [in]  channel_url  The releases URL of the repository, followed by #channel= and the channel.
+/// @param [out] releases_url The releases URL of the repository.
+/// @param [out] channel      The channel.
+static void SplitChannelUrl(const std::string& channel_url, std::string& releases_url, std::string& channel)
 {
-    std::stringstream version_string;
-    version_string << major << VERSION_DELIMITER << minor << VERSION_DELIMITER << patch << VERSION_DELIMITER << build;
-    return version_string.str();
+    const size_t channel_position = channel_url.find(kStringGithubReleasesChannel);
+    releases_url                  = channel_url.substr(0, channel_url.find('#', channel_position));
+    channel                       = channel_url.substr(channel_position + strlen(kStringGithubReleasesChannel));
 }
+#endif  // UPDATECHECKAPI_CURL
 
-/// @brief Compare 'this' version to the supplied version.
+/// @brief Helper function to load JSON file from the newest release of a channel of a GitHub Repository.
 ///
-/// @param [in] other_version The version to compare against.
+/// @param [in]  channel_url    The releases URL of the repository, followed by #channel= and the channel, like
+///                             https://api.github.com/repos/OWNER/REPOSITORY/releases#channel=beta.
+/// @param [in]  json_file_name The name of the asset that holds the JSON file.
+/// @param [out] json_buffer    The contents of the downloaded JSON file.
+/// @param [out] error_message  Any error messages that occurred.
 ///
-/// @retval NEWER if 'this' version is newer than the other_version.
-/// @retval OLDER if 'this' version is older than the other_version.
-/// @retval EQUAL if 'this' version is equal to the other_version.
+/// @retval true on success; json_buffer will have the contents of the JSON file of the newest release of the channel.
+/// @retval false on failure; json_buffer will be empty.
+static bool LoadJsonFromChannelRelease(const std::string& channel_url, const std::string& json_file_name, SharedBuffer& json_buffer, std::string& error_message)
+{
+    bool was_loaded = false;
+
+#ifdef UPDATECHECKAPI_CURL
+    try
+    {
+        std::string                 releases_url;
+        std::string                 channel;
+        std::vector<ChannelRelease> releases;
+        std::string                 list_error_message;
+
+        SplitChannelUrl(channel_url, releases_url, channel);
+        FindChannelReleases(releases_url, json_file_name, std::vector<std::string>(1, channel), GithubReleasesOptions(), releases, list_error_message);
+
+        if (releases[0].was_found)
+        {
+            was_loaded = DownloadJsonFile(releases[0].download_url, json_buffer, error_message);
+        }
+        else
+        {
+            error_message.append(releases[0].error_message);
+        }
+    }
+    catch (std::exception& e)
+    {
+        was_loaded = false;
+        AppendErrorMessage(kStringErrorFailedToLoadLatestReleaseInformation, error_message);
+        error_message.append(e.what());
+    }
+#else
+    UNREFERENCED_PARAMETER(channel_url);
+    UNREFERENCED_PARAMETER(json_file_name);
+    UNREFERENCED_PARAMETER(json_buffer);
+    error_message.append(kStringErrorChannelReleasesNotSupported);
+#endif  // UPDATECHECKAPI_CURL
+
+    return was_loaded;
+}
+
+/// @brief Helper function to find the download URLs of several JSON files of a channel of a GitHub Repository.
+///
+/// The newest release of the channel that carries each file is found in one listing of the releases.
+///
+/// @param [in]  channel_url           The releases URL of the repository, followed by #channel= and the channel.
+/// @param [in]  asset_names           The names of the assets that hold the JSON files.
+/// @param [out] download_urls         The download URL of each asset; empty for assets that no release of the channel has.
+/// @param [out] asset_error_messages  Why each asset that has no download URL was not found.
+/// @param [out] error_message         Any error messages that occurred.
+///
+/// @return true if the releases were listed; false otherwise.
+static bool ResolveChannelReleaseAssetUrls(const std::string&              channel_url,
+                                           const std::vector<std::string>& asset_names,
+                                           std::vector<std::string>&       download_urls,
+                                           std::vector<std::string>&       asset_error_messages,
+                                           std::string&                    error_message)
+{
+    bool is_listed = false;
+    download_urls.assign(asset_names.size(), std::string());
+    asset_error_messages.assign(asset_names.size(), std::string());
+
+#ifdef UPDATECHECKAPI_CURL
+    std::string                 releases_url;
+    std::string                 channel;
+    std::vector<ChannelRelease> releases;
+
+    SplitChannelUrl(channel_url, releases_url, channel);
+    is_listed = FindChannelReleaseAssets(releases_url, channel, asset_names, GithubReleasesOptions(), releases, error_message);
+
+    for (size_t i = 0; i < releases.size(); ++i)
+    {
+        if (releases[i].was_found)
+        {
+            download_urls[i] = releases[i].download_url;
+        }
+        else
+        {
+            asset_error_messages[i] = releases[i].error_message;
+        }
+    }
+#else
+    UNREFERENCED_PARAMETER(channel_url);
+    asset_error_messages.assign(asset_names.size(), kStringErrorChannelReleasesNotSupported);
+    error_message.append(kStringErrorChannelReleasesNotSupported);
+#endif  // UPDATECHECKAPI_CURL
+
+    return is_listed;
+}
+
+/// @brief The download URLs of several assets of a release, which are resolved while the release information is being received.
+struct ReleaseAssetResolution
+{
+    /// @brief Constructor.
+    ///
+    /// @param [in] asset_names The names of the assets to resolve; each name only once.
+    explicit ReleaseAssetResolution(const std::vector<std::string>& asset_names)
+        : download_urls(asset_names.size())
+        , scanner(kStringTagAssets)
+        , searched_assets(0)
+    {
+        for (size_t i = 0; i < asset_names.size(); ++i)
+        {
+            unresolved_assets[asset_names[i]] = i;
+        }
+    }
+
+    /// The names of the assets that have not been resolved yet, and their index in download_urls.
+    std::unordered_map<std::string, size_t> unresolved_assets;
+
+    /// The download URL of each asset, in the order of the asset names; empty until it is resolved.
+    std::vector<std::string> download_urls;
+
+    /// The release information received so far.
+    SharedBufferWriter buffer;
+
+    /// Locates the elements of the assets list in the buffer.
+    JsonStreamScanner scanner;
+
+    /// The number of elements of the assets list that have been looked up.
+    size_t searched_assets;
+};
+
+/// @brief Look up the assets of the release information that were received since the previous call.
+///
+/// Each asset is parsed once, and its name is looked up among all the names
+/// that are still unresolved, instead of searching the list once per name.
+///
+/// @param [in,out] resolution The resolution.
+///
+/// @return true while some assets are unresolved; false once all of them have been resolved.
+static bool ResolveReceivedAssets(ReleaseAssetResolution& resolution)
+{
+    resolution.scanner.Scan(resolution.buffer.Data(), resolution.buffer.Size());
+
+    for (; !resolution.unresolved_assets.empty() && resolution.searched_assets < resolution.scanner.GetElementCount(); ++resolution.searched_assets)
+    {
+        const JsonSpan& span = resolution.scanner.GetElement(resolution.searched_assets);
+        JsonTape        asset_tape;
+        std::string     parse_error_message;
+        std::string     asset_name;
+
+        if (asset_tape.Parse(resolution.buffer.Data() + span.offset, span.length, false, parse_error_message) &&
+            asset_tape.Root().Find(kStringTagAssetName).GetString(asset_name))
+        {
+            auto unresolved_asset = resolution.unresolved_assets.find(asset_name);
+
+            if (unresolved_asset != resolution.unresolved_assets.end() &&
+                asset_tape.Root().Find(kStringTagAssetBrowserDownloadUrl).GetString(resolution.download_urls[unresolved_asset->second]))
+            {
+                resolution.unresolved_assets.erase(unresolved_asset);
+            }
+        }
+    }
+
+    return !resolution.unresolved_assets.empty();
+}
+
+/// @brief Helper function to find the download URLs of several assets of the latest release of a GitHub Repository in one pass.
+///
+/// The latest release information is looked at while it is being received,
+/// and the download stops as soon as all assets have been found, which is
+/// usually before the release notes that follow the assets.
+///
+/// @param [in]  latest_releases_url URL of the latest release API.
+/// @param [in]  asset_names         The names of the assets; each name only once.
+/// @param [out] download_urls       The download URL of each asset; empty for assets that the release does not have.
+/// @param [out] error_message       Any error messages that occurred.
+///
+/// @return true if the latest release information was received; false otherwise.
+static bool ResolveLatestReleaseAssetUrls(const std::string&              latest_releases_url,
+                                          const std::vector<std::string>& asset_names,
+                                          std::vector<std::string>&       download_urls,
+                                          std::string&                    error_message)
+{
+    ReleaseAssetResolution resolution(asset_names);
+
+    bool is_received = asset_names.empty() ||
+                       ExecDownloaderToStream(
+                           latest_releases_url,
+                           std::vector<std::string>(),
+                           [&resolution](size_t size) { return resolution.buffer.Prepare(size); },
+                           [&resolution](const char*, size_t size) {
+                               resolution.buffer.Commit(size);
+                               return ResolveReceivedAssets(resolution);
+                           },
+                           error_message);
+
+    JsonSpan assets_span;
+
+    if (is_received && !resolution.unresolved_assets.empty() && !resolution.scanner.FindMember(kStringTagAssets, assets_span))
+    {
+        // Without an assets list, check for a "message" tag which may indicate an error from the GitHub Release API.
+        JsonSpan    message_span;
+        JsonTape    message_tape;
+        std::string message;
+        std::string parse_error_message;
+
+        if (resolution.scanner.FindMember(kStringTagMessage, message_span) &&
+            message_tape.Parse(resolution.buffer.Data() + message_span.offset, message_span.length, false, parse_error_message) &&
+            message_tape.Root().GetString(message))
+        {
+            error_message.append(message);
+        }
+        else
+        {
+            error_message.append(kStringErrorMissingAssetsTags);
+        }
+
+        is_received = false;
+    }
+
+    download_urls.swap(resolution.download_urls);
+
+    return is_received;
+}
+
+/// @brief Load the JSON file of a remote check directly, without asking the agent.
+///
+/// @param [in]  latest_releases_url The latest releases url.
+/// @param [in]  json_filename       The json file name.
+/// @param [out] json_buffer         The contents of the JSON file.
+/// @param [out] error_message       Any error messages that occurred.
+///
+/// @return true if the file was loaded; false otherwise.
+bool UpdateCheck::LoadRemoteJson(const std::string& latest_releases_url, const std::string& json_filename, SharedBuffer& json_buffer, std::string& error_message)
+{
+    bool is_loaded = false;
+
+    if (latest_releases_url.find(kStringGithubReleasesLatest) != std::string::npos)
+    {
+        // Get JSON file from the latest release (using GitHub Release API).
+        is_loaded = LoadJsonFromLatestRelease(latest_releases_url, json_filename, json_buffer, error_message);
+    }
+    else if (latest_releases_url.find(kStringGithubReleasesChannel) != std::string::npos)
+    {
+        // Get JSON file from the newest release of a channel, which may be a prerelease.
+        is_loaded = LoadJsonFromChannelRelease(latest_releases_url, json_filename, json_buffer, error_message);
+    }
+    else
+    {
+        // Attempt to download JSON file contents.
+        std::string full_url;
+
+        // If a filename was included in the parameters, append that to the URL.
+        if (json_filename.empty())
+        {
+            full_url = latest_releases_url;
+        }
+        else
+        {
+            full_url = latest_releases_url + "/" + json_filename;
+        }
+
+        is_loaded = DownloadJsonFile(full_url, json_buffer, error_message);
+    }
+
+    return is_loaded;
+}
+
+/// @brief Convert VersionInfo to a string.
+///
+/// @return The stringified version information.
+std::string VersionInfo::ToString() const
+{
+    std::stringstream version_string;
+    version_string << major << VERSION_DELIMITER << minor << VERSION_DELIMITER << patch << VERSION_DELIMITER << build;
+    return version_string.str();
+}
+
+/// @brief Compare 'this' version to the supplied version.
+///
+/// @param [in] other_version The version to compare against.
+///
+/// @retval NEWER if 'this' version is newer than the other_version.
+/// @retval OLDER if 'this' version is older than the other_version.
+/// @retval EQUAL if 'this' version is equal to the other_version.
 int VersionInfo::Compare(const VersionInfo& other_version) const
 {
     int comparison = 0;
@@ -420,6 +1203,134 @@ int VersionInfo::Compare(const VersionInfo& other_version) const
     return comparison;
 }
 
+/// @brief Index the raw JSON text of an extension field onto a tape.
+///
+/// @param [in]  release_info The release.
+/// @param [in]  key          The name of the field.
+/// @param [out] json_tape    The tape to index the field onto.
+///
+/// @return true if the release has the field; false otherwise.
+static bool ParseExtensionField(const ReleaseInfo& release_info, const std::string& key, JsonTape& json_tape)
+{
+    const char* data = nullptr;
+    size_t      size = 0;
+    std::string parse_error_message;
+
+    // The version file was validated as UTF-8 before it was parsed.
+    return release_info.GetExtensionFieldJson(key, data, size) && json_tape.Parse(data, size, true, parse_error_message);
+}
+
+bool ReleaseInfo::GetExtensionFieldJson(const std::string& key, const char*& data, size_t& size) const
+{
+    bool is_found   = false;
+    auto field_iter = extension_fields.find(key);
+
+    if (field_iter != extension_fields.end() && manifest_buffer != nullptr &&
+        field_iter->second.offset + field_iter->second.length <= manifest_buffer->size())
+    {
+        data     = manifest_buffer->data() + field_iter->second.offset;
+        size     = field_iter->second.length;
+        is_found = true;
+    }
+
+    return is_found;
+}
+
+bool ReleaseInfo::GetExtensionFieldString(const std::string& key, std::string& value) const
+{
+    JsonTape json_tape;
+    return ParseExtensionField(*this, key, json_tape) && json_tape.Root().GetString(value);
+}
+
+bool ReleaseInfo::GetExtensionFieldStringList(const std::string& key, std::vector<std::string>& values) const
+{
+    JsonTape json_tape;
+    bool     is_decoded = ParseExtensionField(*this, key, json_tape) && json_tape.Root().IsArray();
+
+    if (is_decoded)
+    {
+        std::string value;
+        JsonValue   json_values = json_tape.Root();
+
+        values.clear();
+        for (JsonValue::Iterator value_iter = json_values.begin(); value_iter != json_values.end() && is_decoded; ++value_iter)
+        {
+            is_decoded = (*value_iter).GetString(value);
+            if (is_decoded)
+            {
+                values.push_back(value);
+            }
+        }
+    }
+
+    return is_decoded;
+}
+
+bool ReleaseInfo::GetExtensionFieldUint32(const std::string& key, uint32_t& value) const
+{
+    JsonTape json_tape;
+    return ParseExtensionField(*this, key, json_tape) && json_tape.Root().GetUint32(value);
+}
+
+/// @brief Keep a release for the next parse to reuse its memory.
+///
+/// The release no longer refers to the version file that it was parsed from, so
+/// recycled releases do not keep the version files of previous checks alive.
+///
+/// @param [in,out] release_info      The release; its contents are moved out.
+/// @param [in,out] recycled_releases The releases to reuse.
+static void RecycleRelease(ReleaseInfo& release_info, std::vector<ReleaseInfo>& recycled_releases)
+{
+    release_info.manifest_buffer.reset();
+    release_info.extension_fields.clear();
+    recycled_releases.push_back(std::move(release_info));
+}
+
+void UpdateInfo::Reset()
+{
+    is_update_available = false;
+
+    // Recycle in reverse, so that the next parse takes back the first release first and
+    // each release tends to get the memory of the release at the same position.
+    recycled_releases.reserve(recycled_releases.size() + releases.size());
+    for (auto release_iter = releases.rbegin(); release_iter != releases.rend(); ++release_iter)
+    {
+        RecycleRelease(*release_iter, recycled_releases);
+    }
+
+    releases.clear();
+}
+
+/// @brief Take a release recycled by UpdateInfo::Reset(), or create a new one if there are none.
+///
+/// @param [in,out] update_info The update info struct.
+///
+/// @return The release, whose contents are stale.
+static ReleaseInfo AcquireRelease(UpdateInfo& update_info)
+{
+    ReleaseInfo release_info = {};
+
+    if (!update_info.recycled_releases.empty())
+    {
+        release_info = std::move(update_info.recycled_releases.back());
+        update_info.recycled_releases.pop_back();
+    }
+
+    return release_info;
+}
+
+/// @brief Discard the recycled releases that a parse did not take back.
+///
+/// The next check of the same version file does not need them either, so this caps the
+/// recycled releases at the number of releases that the last parse produced, instead of
+/// letting them grow with every check.
+///
+/// @param [in,out] update_info The update info struct.
+static void DiscardUnusedReleases(UpdateInfo& update_info)
+{
+    update_info.recycled_releases.clear();
+}
+
 /// @brief Split the version string from Schema 1.3 into Major, Minor, Patch, and Build numbers.
 ///
 /// @param [in]  version       The version string.
@@ -510,6 +1421,40 @@ static bool SplitVersionString_1_5(json& json_doc, VersionInfo& version_info, st
     return is_valid;
 }
 
+/// @brief Read the Major, Minor, Patch, and Build numbers of a Schema 1.5 version object from a JSON tape.
+///
+/// @param [in]  json_doc      The version object.
+/// @param [out] version_info  The version information.
+/// @param [out] error_message Any error messages that occurred.
+///
+/// @retval true on success
+/// @retval false on error, and error_message will be appended to.
+static bool SplitVersionString_1_5(const JsonValue& json_doc, VersionInfo& version_info, std::string& error_message)
+{
+    bool is_valid = true;
+
+    JsonValue json_major_version = json_doc.Find(RELEASEVERSION_MAJOR);
+    JsonValue json_minor_version = json_doc.Find(RELEASEVERSION_MINOR);
+    JsonValue json_patch_version = json_doc.Find(RELEASEVERSION_PATCH);
+    JsonValue json_build_version = json_doc.Find(RELEASEVERSION_BUILD);
+
+    if (!json_major_version.IsValid() && !json_minor_version.IsValid() && !json_patch_version.IsValid() && !json_build_version.IsValid())
+    {
+        is_valid = false;
+        error_message.append(kStringErrorInvalidVersionNumberProvided);
+    }
+    else if ((json_major_version.IsValid() && !json_major_version.GetUint32(version_info.major)) ||
+             (json_minor_version.IsValid() && !json_minor_version.GetUint32(version_info.minor)) ||
+             (json_patch_version.IsValid() && !json_patch_version.GetUint32(version_info.patch)) ||
+             (json_build_version.IsValid() && !json_build_version.GetUint32(version_info.build)))
+    {
+        is_valid = false;
+        error_message.append(kStringErrorInvalidVersionNumberProvided);
+    }
+
+    return is_valid;
+}
+
 /// @brief Translate the package string to the corresponding UpdatePackageType.
 ///
 /// @param [in]  package_string The package string.
@@ -571,7 +1516,7 @@ struct UpdatePackage_1_5
     ReleaseType release_type;
 
     /// The target platforms to which the packge referenced by this link is relevant.
-    std::vector<TargetPlatform> target_platforms;
+    SmallVector<TargetPlatform, 4> target_platforms;
 };
 
 /// This structure contains the information received checking the
@@ -826,7 +1771,7 @@ static bool GetReleaseType_1_5(const std::string& release_type_string, ReleaseTy
 ///
 /// @retval true if all the platforms are recognized.
 /// @retval false if any platform is not recognized.
-static bool GetTargetPlatform_1_5(json& target_platforms_json, std::vector<TargetPlatform>& platforms, std::string& error_message)
+static bool GetTargetPlatform_1_5(json& target_platforms_json, SmallVector<TargetPlatform, 4>& platforms, std::string& error_message)
 {
     bool is_known_type = false;
 
@@ -1070,11 +2015,17 @@ static bool ConvertJsonSchema_1_5_To_1_6(const UpdateInfo_1_5& update_info_1_5,
         // with the target platforms and release type.
         if (existing_release_info == nullptr)
         {
-            ReleaseInfo transfer_release_info;
+            // Every field of the recycled release is overwritten or cleared.
+            ReleaseInfo transfer_release_info = AcquireRelease(update_info);
 
             transfer_release_info.version = update_info_1_5.release_version;
             transfer_release_info.title   = update_info_1_5.release_description;
             transfer_release_info.date    = update_info_1_5.release_date;
+            transfer_release_info.release_notes_url.clear();
+            transfer_release_info.tags.clear();
+            transfer_release_info.info_links.clear();
+            transfer_release_info.download_links.clear();
+            transfer_release_info.target_platforms.clear();
 
             for (auto info_link_iter = update_info_1_5.info_links.cbegin(); info_link_iter != update_info_1_5.info_links.cend(); ++info_link_iter)
             {
@@ -1092,7 +2043,7 @@ static bool ConvertJsonSchema_1_5_To_1_6(const UpdateInfo_1_5& update_info_1_5,
             transfer_release_info.tags.push_back(ReleaseTypeToString(package_iter->release_type));
 
             // Push this releaseInfo into the list, and set the release pointer.
-            update_info.releases.push_back(transfer_release_info);
+            update_info.releases.push_back(std::move(transfer_release_info));
             existing_release_info = &(update_info.releases[update_info.releases.size() - 1]);
         }
 
@@ -1125,7 +2076,7 @@ static bool GetReleaseType_1_6(const std::string& release_type_string, ReleaseTy
     return GetReleaseType_1_5(release_type_string, release_type);
 }
 
-/// @brief Translate the target platforms JSON object to the corresponding TargetPlatforms list.
+/// @brief Translate the target platforms JSON array to the corresponding TargetPlatforms list.
 ///
 /// @param [in]  target_platforms_json The target platforms json.
 /// @param [out] platforms             The target platforms list.
@@ -1133,36 +2084,34 @@ static bool GetReleaseType_1_6(const std::string& release_type_string, ReleaseTy
 ///
 /// @retval true if all the platforms are recognized.
 /// @retval false if any platform is not recognized.
-static bool GetReleasePlatform_1_6(json& target_platforms_json, std::vector<TargetPlatform>& platforms, std::string& error_message)
+static bool GetReleasePlatform_1_6(const JsonValue& target_platforms_json, SmallVector<TargetPlatform, 4>& platforms, std::string& error_message)
 {
     bool is_known_type = false;
 
-    if (target_platforms_json.empty())
+    if (target_platforms_json.Empty())
     {
         error_message.append(kStringErrorVersionFileContainsAnEmptyReleasePlatformsList);
     }
     else
     {
-        for (json::iterator platform = target_platforms_json.begin(); platform != target_platforms_json.end(); ++platform)
+        for (JsonValue::Iterator platform = target_platforms_json.begin(); platform != target_platforms_json.end(); ++platform)
         {
-            std::string platform_string = platform->get<std::string>();
-
-            if (platform_string.compare(kStringPlatformTypeWindows) == 0)
+            if ((*platform).Equals(kStringPlatformTypeWindows))
             {
                 platforms.push_back(TargetPlatform::kWindows);
                 is_known_type = true;
             }
-            else if (platform_string.compare(kStringPlatformTypeUbuntu) == 0)
+            else if ((*platform).Equals(kStringPlatformTypeUbuntu))
             {
                 platforms.push_back(TargetPlatform::kUbuntu);
                 is_known_type = true;
             }
-            else if (platform_string.compare(kStringPlatformTypeRhel) == 0)
+            else if ((*platform).Equals(kStringPlatformTypeRhel))
             {
                 platforms.push_back(TargetPlatform::kRhel);
                 is_known_type = true;
             }
-            else if (platform_string.compare(kStringPlatformTypeDarwin) == 0)
+            else if ((*platform).Equals(kStringPlatformTypeDarwin))
             {
                 platforms.push_back(TargetPlatform::kDarwin);
                 is_known_type = true;
@@ -1192,221 +2141,373 @@ static bool GetPackageType_1_6(const std::string& package_string, PackageType& p
     return GetPackageType_1_5(package_string, package_type);
 }
 
-/// @brief Parse a JSON string that should should be formatted as Schema 1.6.
+/// The members of a release defined by Schema 1.6, along with the lengths of their keys.
+static const struct
+{
+    const char* key;
+    size_t      length;
+} kReleaseKeys_1_6[] = {{RELEASEVERSION, sizeof(RELEASEVERSION) - 1},
+                        {RELEASEDATE, sizeof(RELEASEDATE) - 1},
+                        {RELEASETITLE, sizeof(RELEASETITLE) - 1},
+                        {RELEASENOTESURL, sizeof(RELEASENOTESURL) - 1},
+                        {RELEASETYPE, sizeof(RELEASETYPE) - 1},
+                        {RELEASEPLATFORMS, sizeof(RELEASEPLATFORMS) - 1},
+                        {RELEASETAGS, sizeof(RELEASETAGS) - 1},
+                        {INFOPAGELINKS, sizeof(INFOPAGELINKS) - 1},
+                        {DOWNLOADLINKS, sizeof(DOWNLOADLINKS) - 1}};
+
+/// @brief Check whether a key is one of the members of a release defined by Schema 1.6.
 ///
-/// @param [in]  json_doc      The json document.
-/// @param [out] update_info   The update information structure.
-/// @param [out] error_message Any error messsages that occurred.
+/// @param [in] key      The characters of the key.
+/// @param [in] key_size The number of characters.
 ///
-/// @return true if json string is parsed successfully; false otherwise.
-static bool ParseJsonSchema_1_6(json& json_doc, UpdateInfo& update_info, std::string& error_message)
+/// @return true if the key is part of the schema; false otherwise.
+static bool IsReleaseKey_1_6(const char* key, size_t key_size)
 {
-    bool is_parsed = true;
+    bool is_release_key = false;
 
-    // Extract Releases.
-    auto json_releases_iter = json_doc.find(RELEASES);
-    if (json_releases_iter == json_doc.end())
+    for (size_t i = 0; i < sizeof(kReleaseKeys_1_6) / sizeof(kReleaseKeys_1_6[0]) && !is_release_key; ++i)
     {
-        is_parsed = false;
-        error_message.append(kStringErrorVersionFileIsMissingTheReleasesEntry);
+        is_release_key = (key_size == kReleaseKeys_1_6[i].length && memcmp(key, kReleaseKeys_1_6[i].key, key_size) == 0);
+    }
+
+    return is_release_key;
+}
+
+/// @brief Get the element at the end of the used part of a list, adding one if the list has no spare elements.
+///
+/// Spare elements are left over from a recycled release, and overwriting them reuses their memory.
+///
+/// @param [in,out] list       The list.
+/// @param [in]     used_count The number of elements in use.
+///
+/// @return The element at used_count.
+template <typename List>
+static typename List::value_type& GetSpareElement(List& list, size_t used_count)
+{
+    if (list.size() == used_count)
+    {
+        list.emplace_back();
+    }
+
+    return list[used_count];
+}
+
+/// @brief Remove the spare elements at the end of a list.
+///
+/// @param [in,out] list       The list.
+/// @param [in]     used_count The number of elements in use.
+template <typename List>
+static void TrimSpareElements(List& list, size_t used_count)
+{
+    while (list.size() > used_count)
+    {
+        list.pop_back();
+    }
+}
+
+/// @brief Parse a single element of the Releases list of a Schema 1.6 document.
+///
+/// Members that are not part of the schema are kept as extension fields, which refer to
+/// their raw JSON text by its offset from buffer_base. The release may have been recycled
+/// from a previous parse; every field is overwritten, reusing the memory it already has.
+///
+/// @param [in]     json_release  The release element.
+/// @param [in]     buffer_base   The start of the version file that the release was parsed from.
+/// @param [in,out] is_parsed     Cleared if the release is malformed. DownloadLinks are only extracted while it is set.
+/// @param [out]    release_info  The release information.
+/// @param [out]    error_message Any error messsages that occurred.
+static void ParseJsonRelease_1_6(const JsonValue& json_release, const char* buffer_base, bool& is_parsed, ReleaseInfo& release_info, std::string& error_message)
+{
+    std::string value;
+    size_t      tag_count           = 0;
+    size_t      info_link_count     = 0;
+    size_t      download_link_count = 0;
+
+    release_info.version.major = 0;
+    release_info.version.minor = 0;
+    release_info.version.patch = 0;
+    release_info.version.build = 0;
+    release_info.type          = ReleaseType::kUnknown;
+    release_info.date.clear();
+    release_info.title.clear();
+    release_info.release_notes_url.clear();
+    release_info.target_platforms.clear();
+    release_info.extension_fields.clear();
+    release_info.manifest_buffer.reset();
+
+    // Keep the members that are not part of the schema without decoding them.
+    for (JsonValue::Iterator member_iter = json_release.begin(); member_iter != json_release.end(); ++member_iter)
+    {
+        // Schema keys are matched on their raw text first, so they never need to be decoded.
+        JsonValue json_key = member_iter.Key();
+        if (!IsReleaseKey_1_6(json_key.RawData(), json_key.RawSize()) && json_key.GetString(value) && !IsReleaseKey_1_6(value.data(), value.size()))
+        {
+            ExtensionFieldSpan span = {static_cast<size_t>((*member_iter).JsonData() - buffer_base), (*member_iter).JsonSize()};
+            release_info.extension_fields[value] = span;
+        }
     }
-    else if (json_releases_iter->empty())
+
+    // Extract ReleaseVersion.
+    JsonValue json_version = json_release.Find(RELEASEVERSION);
+    if (!json_version.IsValid())
     {
         is_parsed = false;
-        error_message.append(kStringErrorVersionFileContainsAnEmptyReleasesList);
+        error_message.append(kStringErrorVersionFileIsMissingTheReleaseVersionEntry);
     }
     else
     {
-        for (json::iterator release_iter = json_releases_iter->begin(); release_iter != json_releases_iter->end(); ++release_iter)
+        if (!SplitVersionString_1_5(json_version, release_info.version, error_message))
         {
-            ReleaseInfo release_info;
+            is_parsed = false;
+        }
+    }
 
-            // Extract ReleaseVersion.
-            auto json_version_iter = release_iter->find(RELEASEVERSION);
-            if (json_version_iter == release_iter->end())
-            {
-                is_parsed = false;
-                error_message.append(kStringErrorVersionFileIsMissingTheReleaseVersionEntry);
-            }
-            else
-            {
-                if (!SplitVersionString_1_5(*json_version_iter, release_info.version, error_message))
-                {
-                    is_parsed = false;
-                }
-            }
+    // Extract ReleaseDate.
+    JsonValue json_date = json_release.Find(RELEASEDATE);
+    if (!json_date.IsValid())
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileIsMissingTheReleaseDateEntry);
+    }
+    else if (!json_date.GetString(release_info.date))
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileContainsAnInvalidValueType);
+    }
 
-            // Extract ReleaseDate.
-            auto json_date_iter = release_iter->find(RELEASEDATE);
-            if (json_date_iter == release_iter->end())
-            {
-                is_parsed = false;
-                error_message.append(kStringErrorVersionFileIsMissingTheReleaseDateEntry);
-            }
-            else
-            {
-                release_info.date = json_date_iter->get<std::string>();
-            }
+    // Extract ReleaseTitle.
+    JsonValue json_title = json_release.Find(RELEASETITLE);
+    if (!json_title.IsValid())
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileIsMissingTheReleaseTitleEntry);
+    }
+    else if (!json_title.GetString(release_info.title))
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileContainsAnInvalidValueType);
+    }
+
+    // Extract the optional ReleaseNotesURL.
+    JsonValue json_release_notes_url = json_release.Find(RELEASENOTESURL);
+    if (json_release_notes_url.IsValid() && !json_release_notes_url.GetString(release_info.release_notes_url))
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileContainsAnInvalidValueType);
+    }
+
+    // Extract ReleaseType.
+    JsonValue json_type = json_release.Find(RELEASETYPE);
+    if (!json_type.IsValid())
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileIsMissingTheReleaseTypeEntry);
+    }
+    else
+    {
+        if (!json_type.GetString(value) || !GetReleaseType_1_6(value, release_info.type))
+        {
+            is_parsed = false;
+            error_message.append(kStringErrorVersionFileContainsAnInvalidReleaseTypeValue);
+        }
+    }
+
+    // Extract ReleasePlatforms.
+    JsonValue json_platforms = json_release.Find(RELEASEPLATFORMS);
+    if (!json_platforms.IsValid())
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileIsMissingTheReleasePlatformsEntry);
+    }
+    else
+    {
+        if (!GetReleasePlatform_1_6(json_platforms, release_info.target_platforms, error_message))
+        {
+            is_parsed = false;
+        }
+    }
 
-            // Extract ReleaseTitle.
-            auto json_title_iter = release_iter->find(RELEASETITLE);
-            if (json_title_iter == release_iter->end())
+    // Extract ReleaseTags.
+    JsonValue json_tags = json_release.Find(RELEASETAGS);
+    if (!json_tags.IsValid())
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileIsMissingTheReleaseTagsEntry);
+    }
+    else
+    {
+        // Extract each individual tag.
+        for (JsonValue::Iterator tag_iter = json_tags.begin(); tag_iter != json_tags.end(); ++tag_iter)
+        {
+            if (!(*tag_iter).GetString(GetSpareElement(release_info.tags, tag_count)))
             {
                 is_parsed = false;
-                error_message.append(kStringErrorVersionFileIsMissingTheReleaseTitleEntry);
+                error_message.append(kStringErrorVersionFileContainsAnInvalidValueType);
             }
             else
             {
-                release_info.title = json_title_iter->get<std::string>();
+                ++tag_count;
             }
+        }
+    }
 
-            // Extract ReleaseType.
-            auto json_type_iter = release_iter->find(RELEASETYPE);
-            if (json_type_iter == release_iter->end())
-            {
-                is_parsed = false;
-                error_message.append(kStringErrorVersionFileIsMissingTheReleaseTypeEntry);
-            }
-            else
+    // Extract InfoPageLinks.
+    JsonValue json_info_links = json_release.Find(INFOPAGELINKS);
+    if (!json_info_links.IsValid())
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileIsMissingTheInfoPageLinksEntry);
+    }
+    else
+    {
+        if (json_info_links.Empty())
+        {
+            is_parsed = false;
+            error_message.append(kStringErrorVersionFileContainsAnEmptyInfoPageLinksList);
+        }
+        else
+        {
+            for (JsonValue::Iterator info_page_iter = json_info_links.begin(); info_page_iter != json_info_links.end(); ++info_page_iter)
             {
-                if (!GetReleaseType_1_6(json_type_iter->get<std::string>(), release_info.type))
+                JsonValue     json_url         = (*info_page_iter).Find(INFOPAGELINKS_URL);
+                JsonValue     json_description = (*info_page_iter).Find(INFOPAGELINKS_DESCRIPTION);
+                InfoPageLink& info_page        = GetSpareElement(release_info.info_links, info_link_count);
+
+                if (!json_url.IsValid() || !json_description.IsValid())
                 {
                     is_parsed = false;
-                    error_message.append(kStringErrorVersionFileContainsAnInvalidReleaseTypeValue);
+                    error_message.append(kStringErrorVersionFileContainsAnIncompleteInfoPageLinksEntry);
                 }
-            }
-
-            // Extract ReleasePlatforms.
-            auto json_platforms_iter = release_iter->find(RELEASEPLATFORMS);
-            if (json_platforms_iter == release_iter->end())
-            {
-                is_parsed = false;
-                error_message.append(kStringErrorVersionFileIsMissingTheReleasePlatformsEntry);
-            }
-            else
-            {
-                if (!GetReleasePlatform_1_6(*json_platforms_iter, release_info.target_platforms, error_message))
+                else if (!json_url.GetString(info_page.url) || !json_description.GetString(info_page.page_description))
                 {
                     is_parsed = false;
+                    error_message.append(kStringErrorVersionFileContainsAnInvalidValueType);
                 }
-            }
-
-            // Extract ReleaseTags.
-            auto json_tags_iter = release_iter->find(RELEASETAGS);
-            if (json_tags_iter == release_iter->end())
-            {
-                is_parsed = false;
-                error_message.append(kStringErrorVersionFileIsMissingTheReleaseTagsEntry);
-            }
-            else
-            {
-                // Extract each individual tag.
-                for (json::iterator tagIter = json_tags_iter->begin(); tagIter != json_tags_iter->end(); ++tagIter)
+                else
                 {
-                    release_info.tags.push_back(tagIter->get<std::string>());
+                    ++info_link_count;
                 }
             }
+        }
+    }
 
-            // Extract InfoPageLinks.
-            auto json_info_links_iter = release_iter->find(INFOPAGELINKS);
-            if (json_info_links_iter == release_iter->end())
+    // Extract DownloadLinks.
+    if (is_parsed)
+    {
+        JsonValue json_download_links = json_release.Find(DOWNLOADLINKS);
+        if (!json_download_links.IsValid())
+        {
+            is_parsed = false;
+            error_message.append(kStringErrorVersionFileIsMissingTheDownloadLinksEntry);
+        }
+        else
+        {
+            if (json_download_links.Empty())
             {
                 is_parsed = false;
-                error_message.append(kStringErrorVersionFileIsMissingTheInfoPageLinksEntry);
+                error_message.append(kStringErrorVersionFileContainsAnEmptyDownloadLinksList);
             }
             else
             {
-                if (json_info_links_iter->empty())
-                {
-                    is_parsed = false;
-                    error_message.append(kStringErrorVersionFileContainsAnEmptyInfoPageLinksList);
-                }
-                else
+                for (JsonValue::Iterator download_link_iter = json_download_links.begin(); download_link_iter != json_download_links.end();
+                     ++download_link_iter)
                 {
-                    for (json::iterator info_page_iter = json_info_links_iter->begin(); info_page_iter != json_info_links_iter->end(); ++info_page_iter)
+                    JsonValue json_url          = (*download_link_iter).Find(DOWNLOADLINKS_URL);
+                    JsonValue json_package_type = (*download_link_iter).Find(DOWNLOADLINKS_PACKAGETYPE);
+                    JsonValue json_package_name = (*download_link_iter).Find(DOWNLOADLINKS_PACKAGENAME);
+                    if (!json_url.IsValid())
                     {
-                        if (info_page_iter->find(INFOPAGELINKS_URL) != info_page_iter->end() &&
-                            info_page_iter->find(INFOPAGELINKS_DESCRIPTION) != info_page_iter->end())
-                        {
-                            InfoPageLink info_page;
-                            info_page.url              = (*info_page_iter)[INFOPAGELINKS_URL].get<std::string>();
-                            info_page.page_description = (*info_page_iter)[INFOPAGELINKS_DESCRIPTION].get<std::string>();
-                            release_info.info_links.push_back(info_page);
-                        }
-                        else
-                        {
-                            is_parsed = false;
-                            error_message.append(kStringErrorVersionFileContainsAnIncompleteInfoPageLinksEntry);
-                        }
+                        is_parsed = false;
+                        error_message.append(kStringErrorVersionFileIsMissingTheDownloadLinksUrlEntry);
                     }
-                }
-            }
-
-            // Extract DownloadLinks.
-            if (is_parsed)
-            {
-                auto json_download_links_iter = release_iter->find(DOWNLOADLINKS);
-                if (json_download_links_iter == release_iter->end())
-                {
-                    is_parsed = false;
-                    error_message.append(kStringErrorVersionFileIsMissingTheDownloadLinksEntry);
-                }
-                else
-                {
-                    if (json_download_links_iter->empty())
+                    else if (!json_package_type.IsValid())
                     {
                         is_parsed = false;
-                        error_message.append(kStringErrorVersionFileContainsAnEmptyDownloadLinksList);
+                        error_message.append(kStringErrorVersionFileIsMissingTheDownloadLinksPackageTypeEntry);
                     }
                     else
                     {
-                        for (json::iterator download_link_iter = json_download_links_iter->begin(); download_link_iter != json_download_links_iter->end();
-                             ++download_link_iter)
+                        DownloadLink& download_link = GetSpareElement(release_info.download_links, download_link_count);
+                        download_link.package_name.clear();
+
+                        // Make sure the targetString is a valid target.
+                        if (!json_package_type.GetString(value) || !GetPackageType_1_6(value, download_link.package_type))
+                        {
+                            is_parsed = false;
+                            error_message.append(kStringErrorVersionFileContainsAnInvalidDownloadLinksPackageTypeValue);
+                        }
+                        else if (!json_url.GetString(download_link.url))
+                        {
+                            is_parsed = false;
+                            error_message.append(kStringErrorVersionFileContainsAnInvalidValueType);
+                        }
+                        else if (json_package_name.IsValid() && !json_package_name.GetString(download_link.package_name))
+                        {
+                            is_parsed = false;
+                            error_message.append(kStringErrorVersionFileContainsAnInvalidValueType);
+                        }
+                        else
                         {
-                            auto url_iter          = download_link_iter->find(DOWNLOADLINKS_URL);
-                            auto package_type_iter = download_link_iter->find(DOWNLOADLINKS_PACKAGETYPE);
-                            auto package_name_iter = download_link_iter->find(DOWNLOADLINKS_PACKAGENAME);
-                            if (url_iter == download_link_iter->end())
-                            {
-                                is_parsed = false;
-                                error_message.append(kStringErrorVersionFileIsMissingTheDownloadLinksUrlEntry);
-                            }
-                            else if (package_type_iter == download_link_iter->end())
-                            {
-                                is_parsed = false;
-                                error_message.append(kStringErrorVersionFileIsMissingTheDownloadLinksPackageTypeEntry);
-                            }
-                            else
-                            {
-                                DownloadLink download_link;
-
-                                // Make sure the targetString is a valid target.
-                                if (!GetPackageType_1_6(package_type_iter->get<std::string>(), download_link.package_type))
-                                {
-                                    is_parsed = false;
-                                    error_message.append(kStringErrorVersionFileContainsAnInvalidDownloadLinksPackageTypeValue);
-                                }
-                                else
-                                {
-                                    // Extract the url.
-                                    download_link.url = (*download_link_iter)[DOWNLOADLINKS_URL].get<std::string>();
-
-                                    // Extract the package name.
-                                    if (package_name_iter != download_link_iter->end())
-                                    {
-                                        download_link.package_name = package_name_iter->get<std::string>();
-                                    }
-
-                                    release_info.download_links.push_back(download_link);
-                                }
-                            }
+                            ++download_link_count;
                         }
                     }
                 }
             }
+        }
+    }
+
+    TrimSpareElements(release_info.tags, tag_count);
+    TrimSpareElements(release_info.info_links, info_link_count);
+    TrimSpareElements(release_info.download_links, download_link_count);
+}
+
+/// @brief Parse a JSON document that should should be formatted as Schema 1.6.
+///
+/// The document is navigated on its JSON tape, so only the values that are
+/// part of the schema get decoded.
+///
+/// @param [in]  json_doc        The root of the json document.
+/// @param [in]  manifest_buffer The version file that json_doc was parsed from; retained by releases with extension fields.
+/// @param [out] update_info     The update information structure.
+/// @param [out] error_message   Any error messsages that occurred.
+///
+/// @return true if json string is parsed successfully; false otherwise.
+static bool ParseJsonSchema_1_6(const JsonValue&                         json_doc,
+                                const SharedBuffer&                       manifest_buffer,
+                                UpdateInfo&                               update_info,
+                                std::string&                              error_message)
+{
+    bool is_parsed = true;
+
+    // Extract Releases.
+    JsonValue json_releases = json_doc.Find(RELEASES);
+    if (!json_releases.IsValid())
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileIsMissingTheReleasesEntry);
+    }
+    else if (json_releases.Empty())
+    {
+        is_parsed = false;
+        error_message.append(kStringErrorVersionFileContainsAnEmptyReleasesList);
+    }
+    else
+    {
+        for (JsonValue::Iterator release_iter = json_releases.begin(); release_iter != json_releases.end(); ++release_iter)
+        {
+            ReleaseInfo release_info = AcquireRelease(update_info);
+
+            // Extension field offsets are relative to the start of the block that the releases retain.
+            ParseJsonRelease_1_6(*release_iter, manifest_buffer.Data() - manifest_buffer.GetBlockOffset(), is_parsed, release_info, error_message);
+
+            if (!release_info.extension_fields.empty())
+            {
+                release_info.manifest_buffer = manifest_buffer.GetBlock();
+            }
 
             // Now add this release to the list.
-            update_info.releases.push_back(release_info);
+            update_info.releases.push_back(std::move(release_info));
         }
     }
 
@@ -1415,26 +2516,43 @@ static bool ParseJsonSchema_1_6(json& json_doc, UpdateInfo& update_info, std::st
 
 /// @brief Updates all of the update_info except the bool to indicate whether it is a newer version.
 ///
-/// @param [in]  json_string   The json string.
+/// @param [in]  json_buffer   The json string. It is retained by releases that have extension fields.
+/// @param [in]  is_valid_utf8 True if json_buffer has already been validated as UTF-8.
 /// @param [out] update_info   The update information structure.
 /// @param [out] error_message Any error messsages that occurred.
 ///
 /// @return true if json string is parsed successfully; false otherwise.
-static bool ParseJsonString(const std::string& json_string, UpdateInfo& update_info, std::string& error_message)
+static bool ParseJsonString(const SharedBuffer& json_buffer, bool is_valid_utf8, UpdateInfo& update_info, std::string& error_message)
 {
     bool is_parsed = true;
 
     try
     {
-        json json_doc = json::parse(json_string);
+        // Index the document onto a tape first. Schema 1.6 is parsed directly from the tape,
+        // while the older schemas are small enough to continue using a full DOM.
+        JsonTape    json_tape;
+        std::string schema_version;
+        std::string parse_error_message;
 
-        if (json_doc.empty() || json_doc.find(SCHEMAVERSION) == json_doc.end())
+        if (!json_tape.Parse(json_buffer.Data(), json_buffer.Size(), is_valid_utf8, parse_error_message))
+        {
+            is_parsed = false;
+            error_message.append(kStringFailedToParseVersionFile);
+            error_message.append(parse_error_message);
+        }
+        else if (!json_tape.Root().Find(SCHEMAVERSION).IsValid())
         {
             is_parsed = false;
             error_message.append(kStringErrorVersionFileIsMissingTheSchemaVersionEntry);
         }
-        else if (json_doc[SCHEMAVERSION].get<std::string>().compare(SCHEMA_VERSION_1_3) == 0)
+        else if (!json_tape.Root().Find(SCHEMAVERSION).GetString(schema_version))
+        {
+            is_parsed = false;
+            error_message.append(kStringErrorUnsupportedSchemaVersion);
+        }
+        else if (schema_version.compare(SCHEMA_VERSION_1_3) == 0)
         {
+            json           json_doc = json::parse(json_buffer.Data(), json_buffer.Data() + json_buffer.Size());
             UpdateInfo_1_5 update_info_1_5;
             if (!ParseJsonSchema_1_3(json_doc, update_info_1_5, error_message))
             {
@@ -1445,12 +2563,13 @@ static bool ParseJsonString(const std::string& json_string, UpdateInfo& update_i
                 if (!ConvertJsonSchema_1_5_To_1_6(update_info_1_5, update_info))
                 {
                     is_parsed = false;
-                    error_message.append(kStringErrorUnableToConvert1_3To1_6);
+                    AppendErrorMessage(kStringErrorUnableToConvert1_3To1_6, error_message);
                 }
             }
         }
-        else if (json_doc[SCHEMAVERSION].get<std::string>().compare(SCHEMA_VERSION_1_5) == 0)
+        else if (schema_version.compare(SCHEMA_VERSION_1_5) == 0)
         {
+            json           json_doc = json::parse(json_buffer.Data(), json_buffer.Data() + json_buffer.Size());
             UpdateInfo_1_5 update_info_1_5;
             if (!ParseJsonSchema_1_5(json_doc, update_info_1_5, error_message))
             {
@@ -1461,13 +2580,13 @@ static bool ParseJsonString(const std::string& json_string, UpdateInfo& update_i
                 if (!ConvertJsonSchema_1_5_To_1_6(update_info_1_5, update_info))
                 {
                     is_parsed = false;
-                    error_message.append(kStringErrorUnableToConvert1_5To1_6);
+                    AppendErrorMessage(kStringErrorUnableToConvert1_5To1_6, error_message);
                 }
             }
         }
-        else if (json_doc[SCHEMAVERSION].get<std::string>().compare(SCHEMA_VERSION_1_6) == 0)
+        else if (schema_version.compare(SCHEMA_VERSION_1_6) == 0)
         {
-            if (!ParseJsonSchema_1_6(json_doc, update_info, error_message))
+            if (!ParseJsonSchema_1_6(json_tape.Root(), json_buffer, update_info, error_message))
             {
                 is_parsed = false;
             }
@@ -1477,6 +2596,8 @@ static bool ParseJsonString(const std::string& json_string, UpdateInfo& update_i
             is_parsed = false;
             error_message.append(kStringErrorUnsupportedSchemaVersion);
         }
+
+        DiscardUnusedReleases(update_info);
     }
     catch (std::exception& e)
     {
@@ -1488,101 +2609,387 @@ static bool ParseJsonString(const std::string& json_string, UpdateInfo& update_i
     return is_parsed;
 }
 
-/// @brief Filter out (remove) the Releases that are not relevant to the current platform.
-///
-/// @param [in] update_info The update info struct.
-///
-/// @return true if there may be updates availble for the current platform; false otherwise.
-static bool FilterToCurrentPlatform(UpdateCheck::UpdateInfo& update_info)
+/// @brief The internal state of a ManifestPushParser.
+struct ManifestPushParser::Impl
 {
-    bool may_have_updates_for_current_platform = true;
+    /// @brief Constructor.
+    ///
+    /// @param [in] callback       The function to call with each complete release.
+    /// @param [in] recycling_info The update info struct whose recycled releases are reused; may be nullptr.
+    Impl(const ReleaseCallback& callback, UpdateInfo* recycling_info)
+        : release_callback(callback)
+        , recycling_update_info(recycling_info)
+        , scanner(RELEASES)
+        , is_schema_known(false)
+        , is_schema_1_6(false)
+        , is_streaming(true)
+        , are_releases_parsed(true)
+        , is_stopped(false)
+    {
+    }
 
-#ifdef WIN32
-    const UpdateCheck::TargetPlatform current_platform = UpdateCheck::TargetPlatform::kWindows;
-#elif __linux__
-    const UpdateCheck::TargetPlatform current_platform = UpdateCheck::TargetPlatform::kUbuntu;
-#elif __APPLE__
-    const UpdateCheck::TargetPlatform current_platform = UpdateCheck::TargetPlatform::kDarwin;
-#else
-    const UpdateCheck::TargetPlatform current_platform = UpdateCheck::TargetPlatform::kUnknown;
-#endif
+    /// @brief Parse and report the releases that have been received in full since the last call.
+    void ParseCompleteReleases();
 
-    if (UpdateCheck::TargetPlatform::kUnknown != current_platform)
-    {
-        // Sort the releases based on platform. Releases that are for the current platform
-        // will be moved to the beginning; releases that don't match will be moved to the end.
-        auto new_end = std::remove_if(update_info.releases.begin(), update_info.releases.end(), [=](UpdateCheck::ReleaseInfo release) {
-            return !std::any_of(release.target_platforms.begin(), release.target_platforms.end(), [=](UpdateCheck::TargetPlatform platform) {
-                return platform == current_platform;
-            });
-        });
+    /// @brief Move the parsed releases into an UpdateInfo.
+    ///
+    /// @param [in]  manifest_buffer The complete contents of the version file, retained by releases with extension fields.
+    /// @param [out] update_info     The update info struct.
+    void MoveReleases(const std::shared_ptr<const std::string>& manifest_buffer, UpdateInfo& update_info);
 
-        // Now actually remove the releases that are not for the current platform.
-        update_info.releases.erase(new_end, update_info.releases.end());
+    /// The function to call with each complete release.
+    ReleaseCallback release_callback;
 
-        // Updates may be available if there are still releases left.
-        may_have_updates_for_current_platform = (update_info.releases.size() > 0);
-    }
+    /// The update info struct whose recycled releases are parsed into; nullptr to create new releases.
+    UpdateInfo* recycling_update_info;
 
-    return may_have_updates_for_current_platform;
-}
+    /// The contents of the version file received so far.
+    SharedBufferWriter buffer;
 
-/// @brief Parse a version string and populate the UpdateCheck::VersionInfo struct.
-///
-/// This function takes a version string in the format "major.minor.patch.build" and
-/// extracts the individual components (major, minor, patch, and build) from the string.
-/// It then stores these components in the provided UpdateCheck::VersionInfo struct.
-///
-/// @param [in]  version_str The input version string to be parsed.
-/// @param [out] version     A reference to the UpdateCheck::VersionInfo struct to store the parsed version components.
-///
-/// @retval true if the version string is successfully parsed and all components are valid.
-/// @retval false if the parsing fails or the version string format is incorrect.
-static bool ParseVersionString(const std::string& version_str, UpdateCheck::VersionInfo& version)
-{
-    bool              ret = false;
-    std::stringstream ss(version_str);
-    char              dot;
+    /// Validates the contents of the version file as they arrive.
+    UpdateCheckApiUtils::Utf8Validator utf8_validator;
 
-    // Check if the version string can be parsed successfully.
-    if (ss >> version.major && ss >> dot && dot == '.' && ss >> version.minor && ss >> dot && dot == '.' && ss >> version.patch && ss >> dot && dot == '.' &&
-        ss >> version.build)
-    {
-        ret = true;
-    }
+    /// Locates the SchemaVersion and the elements of the Releases list in the buffer.
+    JsonStreamScanner scanner;
 
-    return ret;
-}
+    /// The tape used to parse individual values out of the buffer.
+    JsonTape value_tape;
 
-/// @brief Get the tool version from the environment variable "RDTS_UPDATER_ASSUME_VERSION".
-///
-/// This function retrieves the tool version from the environment variable "RDTS_UPDATER_ASSUME_VERSION"
-/// and parses it to extract the major, minor, patch, and build components.
-///
-/// @param [out] version A reference to the UpdateCheck::VersionInfo struct to store the retrieved or default version components.
-///
-/// @retval true if the tool version is successfully retrieved and parsed from the environment variable.
-/// @retval false if the tool version retrieval fails or the version string format is incorrect.
-static bool GetToolVersion(UpdateCheck::VersionInfo& version)
+    /// True once the SchemaVersion has been received.
+    bool is_schema_known;
+
+    /// True if the SchemaVersion is 1.6.
+    bool is_schema_1_6;
+
+    /// False if a release could not be parsed on its own; Finish() then parses the whole document.
+    bool is_streaming;
+
+    /// False once any release has failed to parse.
+    bool are_releases_parsed;
+
+    /// True once the release callback has asked to stop.
+    bool is_stopped;
+
+    /// The releases parsed so far, in the order they appear in the file.
+    std::vector<ReleaseInfo> releases;
+
+    /// The errors that occurred while parsing the releases.
+    std::string release_error_message;
+};
+
+void ManifestPushParser::Impl::ParseCompleteReleases()
 {
-    bool        ret               = false;
-    const char* env_variable_name = "RDTS_UPDATER_ASSUME_VERSION";
-    char*       tool_version      = nullptr;
+    JsonSpan    span;
+    std::string parse_error_message;
 
-#ifdef _WIN32
-    size_t required_size;
-    getenv_s(&required_size, nullptr, 0, env_variable_name);
+    if (!is_schema_known && scanner.FindMember(SCHEMAVERSION, span))
+    {
+        is_schema_known = true;
+        is_schema_1_6 =
+            value_tape.Parse(buffer.Data() + span.offset, span.length, true, parse_error_message) && value_tape.Root().Equals(SCHEMA_VERSION_1_6);
+    }
 
-    if (required_size != 0)
+    // Releases can only be reported once the file is known to use Schema 1.6.
+    while (is_schema_1_6 && is_streaming && !is_stopped && releases.size() < scanner.GetElementCount())
     {
-        tool_version = new (std::nothrow) char[required_size];
-        if (tool_version != nullptr)
+        span = scanner.GetElement(releases.size());
+
+        if (!value_tape.Parse(buffer.Data() + span.offset, span.length, true, parse_error_message) || !value_tape.Root().IsObject())
         {
-            getenv_s(&required_size, tool_version, required_size, env_variable_name);
+            // Leave it to Finish() to report the error in the context of the whole document.
+            is_streaming = false;
+        }
+        else
+        {
+            ReleaseInfo release_info = (recycling_update_info != nullptr) ? AcquireRelease(*recycling_update_info) : ReleaseInfo();
+            ParseJsonRelease_1_6(value_tape.Root(), buffer.Data(), are_releases_parsed, release_info, release_error_message);
+            releases.push_back(std::move(release_info));
+
+            // Stop reporting releases once the file is known to be invalid.
+            if (are_releases_parsed && release_callback && !release_callback(releases.back()))
+            {
+                is_stopped = true;
+            }
         }
     }
+}
 
-#else
+void ManifestPushParser::Impl::MoveReleases(const std::shared_ptr<const std::string>& manifest_buffer, UpdateInfo& update_info)
+{
+    for (auto release_iter = releases.begin(); release_iter != releases.end(); ++release_iter)
+    {
+        if (!release_iter->extension_fields.empty())
+        {
+            release_iter->manifest_buffer = manifest_buffer;
+        }
+
+        update_info.releases.push_back(std::move(*release_iter));
+    }
+
+    releases.clear();
+}
+
+ManifestPushParser::ManifestPushParser(const ReleaseCallback& release_callback)
+    : impl_(new Impl(release_callback, nullptr))
+{
+}
+
+ManifestPushParser::ManifestPushParser(const ReleaseCallback& release_callback, UpdateInfo& update_info)
+    : impl_(new Impl(release_callback, &update_info))
+{
+}
+
+ManifestPushParser::~ManifestPushParser()
+{
+}
+
+bool ManifestPushParser::Feed(const char* data, size_t size)
+{
+    bool wants_more = false;
+
+    if (!impl_->is_stopped && impl_->utf8_validator.Update(data, size))
+    {
+        // Chunks that were received into the space from PrepareFeed() are already in place.
+        if (data != impl_->buffer.Data() + impl_->buffer.Size())
+        {
+            impl_->buffer.Append(data, size);
+        }
+        else
+        {
+            impl_->buffer.Commit(size);
+        }
+
+        impl_->scanner.Scan(impl_->buffer.Data(), impl_->buffer.Size());
+        impl_->ParseCompleteReleases();
+
+        wants_more = !impl_->is_stopped;
+    }
+
+    return wants_more;
+}
+
+char* ManifestPushParser::PrepareFeed(size_t size)
+{
+    return impl_->buffer.Prepare(size);
+}
+
+bool ManifestPushParser::IsStopped() const
+{
+    return impl_->is_stopped;
+}
+
+bool ManifestPushParser::Finish(UpdateInfo& update_info, std::string& error_message)
+{
+    bool is_parsed = false;
+
+    try
+    {
+        // The releases keep the buffer alive if they have extension fields.
+        SharedBuffer manifest_buffer = impl_->buffer.Publish();
+
+        if (impl_->is_stopped)
+        {
+            // The rest of the file was never received, so report the releases up to the point where the caller stopped.
+            impl_->MoveReleases(manifest_buffer.GetBlock(), update_info);
+            DiscardUnusedReleases(update_info);
+            is_parsed = true;
+        }
+        else if (manifest_buffer.Empty())
+        {
+            error_message.append(kStringErrorDownloadedAnEmptyVersionFile);
+        }
+        else if (!impl_->utf8_validator.IsComplete())
+        {
+            error_message.append(kStringErrorDownloadedFileIsNotValidUtf8);
+        }
+        else
+        {
+            // Validate the whole document, and check that every release in it was parsed as it arrived.
+            JsonTape    json_tape;
+            JsonValue   json_releases;
+            std::string parse_error_message;
+            size_t      release_count = 0;
+
+            if (impl_->is_schema_1_6 && impl_->is_streaming && json_tape.Parse(manifest_buffer.Data(), manifest_buffer.Size(), true, parse_error_message) &&
+                json_tape.Root().Find(SCHEMAVERSION).Equals(SCHEMA_VERSION_1_6))
+            {
+                json_releases = json_tape.Root().Find(RELEASES);
+            }
+
+            if (json_releases.IsArray())
+            {
+                for (JsonValue::Iterator release_iter = json_releases.begin(); release_iter != json_releases.end(); ++release_iter)
+                {
+                    ++release_count;
+                }
+            }
+
+            if (release_count > 0 && release_count == impl_->releases.size())
+            {
+                impl_->MoveReleases(manifest_buffer.GetBlock(), update_info);
+                DiscardUnusedReleases(update_info);
+                error_message.append(impl_->release_error_message);
+                is_parsed = impl_->are_releases_parsed;
+            }
+            else
+            {
+                // Give back the releases that were parsed as they arrived, for the parse of the whole document to reuse.
+                for (ReleaseInfo& release_info : impl_->releases)
+                {
+                    RecycleRelease(release_info, update_info.recycled_releases);
+                }
+
+                impl_->releases.clear();
+
+                // Parse the document from scratch, so that any errors are reported exactly as for a complete file.
+                is_parsed = ParseJsonString(manifest_buffer, true, update_info, error_message);
+            }
+        }
+    }
+    catch (std::exception& e)
+    {
+        is_parsed = false;
+        error_message.append(kStringFailedToParseVersionFile);
+        error_message.append(e.what());
+    }
+
+    return is_parsed;
+}
+
+/// @brief Get the platform that this code is running on.
+///
+/// @return The current platform, or kUnknown if it is not one of the supported platforms.
+static UpdateCheck::TargetPlatform GetCurrentPlatform()
+{
+#ifdef WIN32
+    const UpdateCheck::TargetPlatform current_platform = UpdateCheck::TargetPlatform::kWindows;
+#elif __linux__
+    const UpdateCheck::TargetPlatform current_platform = UpdateCheck::TargetPlatform::kUbuntu;
+#elif __APPLE__
+    const UpdateCheck::TargetPlatform current_platform = UpdateCheck::TargetPlatform::kDarwin;
+#else
+    const UpdateCheck::TargetPlatform current_platform = UpdateCheck::TargetPlatform::kUnknown;
+#endif
+
+    return current_platform;
+}
+
+/// @brief Check whether a release is relevant to a platform.
+///
+/// @param [in] release_info The release.
+/// @param [in] platform     The platform; every release is relevant to kUnknown.
+///
+/// @return true if the release targets the platform; false otherwise.
+static bool IsReleaseForPlatform(const UpdateCheck::ReleaseInfo& release_info, UpdateCheck::TargetPlatform platform)
+{
+    return (UpdateCheck::TargetPlatform::kUnknown == platform ||
+            std::find(release_info.target_platforms.begin(), release_info.target_platforms.end(), platform) != release_info.target_platforms.end());
+}
+
+/// @brief Filter out (remove) the Releases that are not relevant to the current platform.
+///
+/// @param [in] update_info The update info struct.
+///
+/// @return true if there may be updates availble for the current platform; false otherwise.
+static bool FilterToCurrentPlatform(UpdateCheck::UpdateInfo& update_info)
+{
+    bool may_have_updates_for_current_platform = true;
+
+    const UpdateCheck::TargetPlatform current_platform = GetCurrentPlatform();
+
+    if (UpdateCheck::TargetPlatform::kUnknown != current_platform)
+    {
+        // Sort the releases based on platform. Releases that are for the current platform
+        // will be moved to the beginning, in their original order; releases that don't match
+        // will be moved to the end. Swapping keeps the memory of both releases intact.
+        std::vector<UpdateCheck::ReleaseInfo>& releases      = update_info.releases;
+        size_t                                 matched_count = 0;
+
+        for (size_t i = 0; i < releases.size(); ++i)
+        {
+            if (IsReleaseForPlatform(releases[i], current_platform))
+            {
+                if (i != matched_count)
+                {
+                    std::swap(releases[matched_count], releases[i]);
+                }
+
+                ++matched_count;
+            }
+        }
+
+        // Now actually remove the releases that are not for the current platform. They are
+        // kept for the next check to reuse, the same way that UpdateInfo::Reset() does.
+        for (size_t i = matched_count; i < releases.size(); ++i)
+        {
+            RecycleRelease(releases[i], update_info.recycled_releases);
+        }
+
+        releases.erase(releases.begin() + matched_count, releases.end());
+
+        // Updates may be available if there are still releases left.
+        may_have_updates_for_current_platform = (update_info.releases.size() > 0);
+    }
+
+    return may_have_updates_for_current_platform;
+}
+
+/// @brief Parse a version string and populate the UpdateCheck::VersionInfo struct.
+///
+/// This function takes a version string in the format "major.minor.patch.build" and
+/// extracts the individual components (major, minor, patch, and build) from the string.
+/// It then stores these components in the provided UpdateCheck::VersionInfo struct.
+///
+/// @param [in]  version_str The input version string to be parsed.
+/// @param [out] version     A reference to the UpdateCheck::VersionInfo struct to store the parsed version components.
+///
+/// @retval true if the version string is successfully parsed and all components are valid.
+/// @retval false if the parsing fails or the version string format is incorrect.
+static bool ParseVersionString(const std::string& version_str, UpdateCheck::VersionInfo& version)
+{
+    bool              ret = false;
+    std::stringstream ss(version_str);
+    char              dot;
+
+    // Check if the version string can be parsed successfully.
+    if (ss >> version.major && ss >> dot && dot == '.' && ss >> version.minor && ss >> dot && dot == '.' && ss >> version.patch && ss >> dot && dot == '.' &&
+        ss >> version.build)
+    {
+        ret = true;
+    }
+
+    return ret;
+}
+
+/// @brief Get the tool version from the environment variable "RDTS_UPDATER_ASSUME_VERSION".
+///
+/// This function retrieves the tool version from the environment variable "RDTS_UPDATER_ASSUME_VERSION"
+/// and parses it to extract the major, minor, patch, and build components.
+///
+/// @param [out] version A reference to the UpdateCheck::VersionInfo struct to store the retrieved or default version components.
+///
+/// @retval true if the tool version is successfully retrieved and parsed from the environment variable.
+/// @retval false if the tool version retrieval fails or the version string format is incorrect.
+static bool GetToolVersion(UpdateCheck::VersionInfo& version)
+{
+    bool        ret               = false;
+    const char* env_variable_name = "RDTS_UPDATER_ASSUME_VERSION";
+    char*       tool_version      = nullptr;
+
+#ifdef _WIN32
+    size_t required_size;
+    getenv_s(&required_size, nullptr, 0, env_variable_name);
+
+    if (required_size != 0)
+    {
+        tool_version = new (std::nothrow) char[required_size];
+        if (tool_version != nullptr)
+        {
+            getenv_s(&required_size, tool_version, required_size, env_variable_name);
+        }
+    }
+
+#else
 
     tool_version = std::getenv(env_variable_name);
 #endif
@@ -1604,6 +3011,66 @@ static bool GetToolVersion(UpdateCheck::VersionInfo& version)
     return ret;
 }
 
+/// @brief Helper function to check whether a URL is downloaded over http or https, rather than read as a local file.
+///
+/// @param [in] url The URL.
+///
+/// @return true if the URL starts with http:// or https://; false otherwise.
+static bool IsHttpUrl(const std::string& url)
+{
+    return (url.compare(0, strlen(kStringHttpUrlPrefix), kStringHttpUrlPrefix) == 0) ||
+           (url.compare(0, strlen(kStringHttpsUrlPrefix), kStringHttpsUrlPrefix) == 0);
+}
+
+/// @brief Helper function to check whether a release of a downloaded version file refers to local release notes.
+///
+/// A server must not be able to make the application read local files, so only http and
+/// https release notes URLs are kept from version files that were downloaded.
+///
+/// @param [in] release_info The release.
+///
+/// @return true if the release notes URL is set, and is not an http or https URL; false otherwise.
+static bool HasLocalReleaseNotesUrl(const UpdateCheck::ReleaseInfo& release_info)
+{
+    return !release_info.release_notes_url.empty() && !IsHttpUrl(release_info.release_notes_url);
+}
+
+/// @brief Helper function to clear the release notes URLs of a downloaded version file that are not http or https URLs.
+///
+/// @param [in,out] update_info The releases of a version file that was downloaded.
+static void ClearLocalReleaseNotesUrls(UpdateCheck::UpdateInfo& update_info)
+{
+    for (UpdateCheck::ReleaseInfo& release_info : update_info.releases)
+    {
+        if (HasLocalReleaseNotesUrl(release_info))
+        {
+            release_info.release_notes_url.clear();
+        }
+    }
+}
+
+/// @brief Check to see if a release is newer than the current product version, and set is_update_available accordingly.
+///
+/// @param [in]     product_version The current product version.
+/// @param [in,out] update_info     The update info struct.
+static void SetUpdateAvailability(const UpdateCheck::VersionInfo& product_version, UpdateCheck::UpdateInfo& update_info)
+{
+    UpdateCheck::VersionInfo version_to_compare;
+    if (!GetToolVersion(version_to_compare))
+    {
+        version_to_compare = product_version;
+    }
+
+    for (auto release_iter = update_info.releases.begin(); release_iter != update_info.releases.end(); ++release_iter)
+    {
+        update_info.is_update_available = (release_iter->version.Compare(version_to_compare) == kNewer);
+        if (update_info.is_update_available)
+        {
+            break;
+        }
+    }
+}
+
 /// @brief API for checking the availability of product updates.
 ///
 /// @param [in]  product_version     The current product version.
@@ -1620,9 +3087,11 @@ bool UpdateCheck::CheckForUpdates(const UpdateCheck::VersionInfo& product_versio
                                   UpdateCheck::UpdateInfo&        update_info,
                                   std::string&                    error_message)
 {
-    bool checked_for_update         = false;
-    update_info.is_update_available = false;
-    std::string loaded_json_contents;
+    bool checked_for_update = false;
+
+    // Start from an empty result, keeping the memory of the previous one.
+    update_info.Reset();
+    SharedBuffer loaded_json_contents;
 
     try
     {
@@ -1638,27 +3107,22 @@ bool UpdateCheck::CheckForUpdates(const UpdateCheck::VersionInfo& product_versio
         }
         else
         {
-            if (latest_releases_url.find(kStringGithubReleasesLatest) != std::string::npos)
+            const bool is_remote_url = (latest_releases_url.find(kStringGithubReleasesLatest) != std::string::npos) ||
+                                       (latest_releases_url.find(kStringHttpPrefix) == 0);
+
+            if (is_remote_url && !UpdateCheck::IsNetworkReachable())
             {
-                // Get JSON file from the latest release (using GitHub Release API).
-                checked_for_update = LoadJsonFromLatestRelease(latest_releases_url, json_filename, loaded_json_contents, error_message);
+                // A download can only time out while there is no route to the server.
+                checked_for_update = false;
+                error_message.append(kStringErrorNetworkUnreachable);
             }
-            else if (latest_releases_url.find(kStringHttpPrefix) == 0)
+            else if (is_remote_url)
             {
-                // Attempt to download JSON file contents.
-                std::string full_url;
-
-                // If a filename was included in the parameters, append that to the URL.
-                if (json_filename.empty())
-                {
-                    full_url = latest_releases_url;
-                }
-                else
+                // Ask the agent for the file when one is running; otherwise download it in this process.
+                if (!UpdateCheck::RequestJsonFromAgent(latest_releases_url, json_filename, loaded_json_contents, checked_for_update, error_message))
                 {
-                    full_url = latest_releases_url + "/" + json_filename;
+                    checked_for_update = UpdateCheck::LoadRemoteJson(latest_releases_url, json_filename, loaded_json_contents, error_message);
                 }
-
-                checked_for_update = DownloadJsonFile(full_url, loaded_json_contents, error_message);
             }
             else
             {
@@ -1678,30 +3142,22 @@ bool UpdateCheck::CheckForUpdates(const UpdateCheck::VersionInfo& product_versio
 
             if (checked_for_update)
             {
-                // Parse the JSON string to populate the update_info struct.
-                checked_for_update = ParseJsonString(loaded_json_contents, update_info, error_message);
+                // Parse the JSON string to populate the update_info struct. The contents
+                // were validated as UTF-8 when they were loaded.
+                checked_for_update = ParseJsonString(loaded_json_contents, true, update_info, error_message);
 
                 if (checked_for_update)
                 {
+                    if (is_remote_url)
+                    {
+                        ClearLocalReleaseNotesUrls(update_info);
+                    }
+
                     bool has_compatible_update = FilterToCurrentPlatform(update_info);
 
                     if (has_compatible_update)
                     {
-                        // Check to see if a version from the update is newer than the current product version.
-                        UpdateCheck::VersionInfo version_to_compare;
-                        if (!GetToolVersion(version_to_compare))
-                        {
-                            version_to_compare = product_version;
-                        }
-
-                        for (auto release_iter = update_info.releases.begin(); release_iter != update_info.releases.end(); ++release_iter)
-                        {
-                            update_info.is_update_available = (release_iter->version.Compare(version_to_compare) == kNewer);
-                            if (update_info.is_update_available)
-                            {
-                                break;
-                            }
-                        }
+                        SetUpdateAvailability(product_version, update_info);
                     }
                 }
             }
@@ -1710,13 +3166,602 @@ bool UpdateCheck::CheckForUpdates(const UpdateCheck::VersionInfo& product_versio
     catch (std::exception& e)
     {
         checked_for_update = false;
-        error_message.append(kStringErrorUnknownErrorOccurred);
+        AppendErrorMessage(kStringErrorUnknownErrorOccurred, error_message);
         error_message.append(e.what());
     }
 
     return checked_for_update;
 }
 
+/// @brief API for checking the availability of product updates, reporting releases as they arrive.
+///
+/// @param [in]  product_version     The current product version.
+/// @param [in]  latest_releases_url The latest releases url.
+/// @param [in]  json_filename       The json file name.
+/// @param [in]  release_callback    The function to call with each release for the current platform.
+/// @param [in]  update_info         The update info struct.
+/// @param [out] error_message       Any error messsages that occurred.
+///
+/// @return true if checking for updates is successful; false otherwise.
+bool UpdateCheck::CheckForUpdates(const UpdateCheck::VersionInfo&     product_version,
+                                  const std::string&                  latest_releases_url,
+                                  const std::string&                  json_filename,
+                                  const UpdateCheck::ReleaseCallback& release_callback,
+                                  UpdateCheck::UpdateInfo&            update_info,
+                                  std::string&                        error_message)
+{
+    bool checked_for_update = false;
+
+    // Start from an empty result, keeping the memory of the previous one.
+    update_info.Reset();
+
+    try
+    {
+        // Confirm a path to a JSON file was provided.
+        bool is_json = (json_filename.rfind(kStringJsonFileExtension) != std::string::npos);
+        assert(is_json);
+
+        if (!is_json)
+        {
+            // The provided URL doesn't point to a supported file type.
+            checked_for_update = false;
+            error_message.append(kStringErrorUrlMustPointToAJsonFile);
+        }
+        else
+        {
+            const bool is_remote_url = (latest_releases_url.find(kStringGithubReleasesLatest) != std::string::npos) ||
+                                       (latest_releases_url.find(kStringHttpPrefix) == 0);
+
+            // Only pass on the releases that are relevant to the current platform, without the local release notes of a downloaded version file.
+            const UpdateCheck::TargetPlatform current_platform = GetCurrentPlatform();
+            ManifestPushParser                parser(
+                [&](const UpdateCheck::ReleaseInfo& release_info) {
+                    if (!release_callback || !IsReleaseForPlatform(release_info, current_platform))
+                    {
+                        return true;
+                    }
+
+                    if (is_remote_url && HasLocalReleaseNotesUrl(release_info))
+                    {
+                        UpdateCheck::ReleaseInfo remote_release_info = release_info;
+                        remote_release_info.release_notes_url.clear();
+                        return release_callback(remote_release_info);
+                    }
+
+                    return release_callback(release_info);
+                },
+                update_info);
+
+            SharedBuffer agent_json_contents;
+
+            if (is_remote_url && !UpdateCheck::IsNetworkReachable())
+            {
+                // A download can only time out while there is no route to the server.
+                checked_for_update = false;
+                error_message.append(kStringErrorNetworkUnreachable);
+            }
+            else if (is_remote_url && UpdateCheck::RequestJsonFromAgent(latest_releases_url, json_filename, agent_json_contents, checked_for_update, error_message))
+            {
+                // The agent answered, from its cache or with a file that it downloaded for this process.
+                if (checked_for_update)
+                {
+                    parser.Feed(agent_json_contents.Data(), agent_json_contents.Size());
+                }
+            }
+            else if (latest_releases_url.find(kStringGithubReleasesLatest) != std::string::npos)
+            {
+                // Get JSON file from the latest release (using GitHub Release API). The asset
+                // is only known once the release information has been parsed, so it is not streamed.
+                SharedBuffer loaded_json_contents;
+                checked_for_update = LoadJsonFromLatestRelease(latest_releases_url, json_filename, loaded_json_contents, error_message);
+
+                if (checked_for_update)
+                {
+                    parser.Feed(loaded_json_contents.Data(), loaded_json_contents.Size());
+                }
+            }
+            else if (latest_releases_url.find(kStringGithubReleasesChannel) != std::string::npos)
+            {
+                // Get JSON file from the newest release of a channel, which is likewise only known once the release list has been searched.
+                SharedBuffer loaded_json_contents;
+                checked_for_update = LoadJsonFromChannelRelease(latest_releases_url, json_filename, loaded_json_contents, error_message);
+
+                if (checked_for_update)
+                {
+                    parser.Feed(loaded_json_contents.Data(), loaded_json_contents.Size());
+                }
+            }
+            else if (latest_releases_url.find(kStringHttpPrefix) == 0)
+            {
+                // Parse the JSON file contents while they are being downloaded.
+                std::string full_url;
+
+                // If a filename was included in the parameters, append that to the URL.
+                if (json_filename.empty())
+                {
+                    full_url = latest_releases_url;
+                }
+                else
+                {
+                    full_url = latest_releases_url + "/" + json_filename;
+                }
+
+                // Each chunk is received directly into the parser's buffer.
+                checked_for_update = ExecDownloaderToStream(
+                    full_url,
+                    GetVersionFileRequestHeaders(false),
+                    [&parser](size_t size) { return parser.PrepareFeed(size); },
+                    [&parser](const char* data, size_t size) { return parser.Feed(data, size); },
+                    error_message);
+            }
+            else
+            {
+                // Stream the JSON file from disk.
+                std::string full_path;
+                if (latest_releases_url.empty())
+                {
+                    full_path = json_filename;
+                }
+                else
+                {
+                    full_path = latest_releases_url + "/" + json_filename;
+                }
+
+                checked_for_update = StreamJsonFile(full_path, parser, error_message);
+            }
+
+            if (checked_for_update)
+            {
+                checked_for_update = parser.Finish(update_info, error_message);
+
+                if (checked_for_update)
+                {
+                    if (is_remote_url)
+                    {
+                        ClearLocalReleaseNotesUrls(update_info);
+                    }
+
+                    bool has_compatible_update = FilterToCurrentPlatform(update_info);
+
+                    if (has_compatible_update)
+                    {
+                        SetUpdateAvailability(product_version, update_info);
+                    }
+                }
+            }
+        }
+    }
+    catch (std::exception& e)
+    {
+        checked_for_update = false;
+        AppendErrorMessage(kStringErrorUnknownErrorOccurred, error_message);
+        error_message.append(e.what());
+    }
+
+    return checked_for_update;
+}
+
+/// The release notes of one URL in release_notes_cache.
+typedef std::pair<std::string, std::shared_ptr<const std::string>> CachedReleaseNotes;
+
+/// The most bytes of release notes that release_notes_cache keeps; the notes that were used least recently are evicted first.
+static const size_t kReleaseNotesCacheMaxSize = 4 * 1024 * 1024;
+
+/// Release notes that have already been fetched, the most recently used first.
+static std::list<CachedReleaseNotes> release_notes_cache;
+
+/// The entries of release_notes_cache, keyed by their URL.
+static std::map<std::string, std::list<CachedReleaseNotes>::iterator> release_notes_cache_index;
+
+/// The number of bytes of release notes in release_notes_cache.
+static size_t release_notes_cache_size = 0;
+
+/// Guards release_notes_cache, since release notes may be fetched from several threads.
+static std::mutex release_notes_cache_mutex;
+
+/// @brief Helper function to look up release notes that have already been fetched, and mark them as the most recently used.
+///
+/// The caller must hold release_notes_cache_mutex.
+///
+/// @param [in] release_notes_url The URL of the release notes.
+///
+/// @return The release notes, or nullptr if they are not in the cache.
+static std::shared_ptr<const std::string> FindCachedReleaseNotes(const std::string& release_notes_url)
+{
+    std::shared_ptr<const std::string> cached_notes;
+
+    auto index_iter = release_notes_cache_index.find(release_notes_url);
+    if (index_iter != release_notes_cache_index.end())
+    {
+        release_notes_cache.splice(release_notes_cache.begin(), release_notes_cache, index_iter->second);
+        cached_notes = index_iter->second->second;
+    }
+
+    return cached_notes;
+}
+
+/// @brief Helper function to add release notes to the cache, evicting the least recently used ones to make room.
+///
+/// The caller must hold release_notes_cache_mutex. Release notes that are larger than the
+/// cache are not kept.
+///
+/// @param [in] release_notes_url The URL of the release notes.
+/// @param [in] release_notes     The release notes.
+static void CacheReleaseNotes(const std::string& release_notes_url, const std::shared_ptr<const std::string>& release_notes)
+{
+    auto index_iter = release_notes_cache_index.find(release_notes_url);
+    if (index_iter != release_notes_cache_index.end())
+    {
+        // Another thread fetched the same notes in the meantime.
+        release_notes_cache_size -= index_iter->second->second->size();
+        release_notes_cache.erase(index_iter->second);
+        release_notes_cache_index.erase(index_iter);
+    }
+
+    if (release_notes->size() <= kReleaseNotesCacheMaxSize)
+    {
+        while (release_notes_cache_size + release_notes->size() > kReleaseNotesCacheMaxSize)
+        {
+            release_notes_cache_size -= release_notes_cache.back().second->size();
+            release_notes_cache_index.erase(release_notes_cache.back().first);
+            release_notes_cache.pop_back();
+        }
+
+        release_notes_cache.push_front(CachedReleaseNotes(release_notes_url, release_notes));
+        release_notes_cache_index[release_notes_url] = release_notes_cache.begin();
+        release_notes_cache_size += release_notes->size();
+    }
+}
+
+/// @brief Helper function to read release notes from a URL or a local file.
+///
+/// http and https URLs are downloaded; anything else is read as a local file. Version files that were
+/// downloaded cannot refer to local files, because such URLs are cleared when the version file is parsed.
+///
+/// @param [in]  release_notes_url The URL of the release notes, or the path to a local file.
+/// @param [out] release_notes     The contents of the release notes.
+/// @param [out] error_message     Any error messages that occurred.
+///
+/// @return true if the release notes were read and are valid UTF-8 text; false otherwise.
+static bool LoadReleaseNotes(const std::string& release_notes_url, SharedBuffer& release_notes, std::string& error_message)
+{
+    bool               is_loaded = false;
+    SharedBufferWriter writer;
+
+    if (IsHttpUrl(release_notes_url) && !IsValidUrl(release_notes_url))
+    {
+        error_message.append(kStringErrorUrlContainsInvalidCharacters);
+        error_message.append(release_notes_url);
+    }
+    else if (IsHttpUrl(release_notes_url))
+    {
+        // Receive the download directly into the buffer, without a temporary file.
+        UpdateCheckApiUtils::OutputBufferCallback buffer_callback = [&writer](size_t size) { return writer.Prepare(size); };
+        UpdateCheckApiUtils::OutputCallback       output_callback = [&writer](const char* data, size_t size) {
+            UNREFERENCED_PARAMETER(data);
+            writer.Commit(size);
+            return true;
+        };
+
+        is_loaded = ExecDownloaderToStream(release_notes_url, std::vector<std::string>(), buffer_callback, output_callback, error_message);
+    }
+    else
+    {
+        std::ifstream read_file(release_notes_url.c_str(), std::ios::binary);
+        is_loaded = read_file.good();
+
+        while (read_file.good())
+        {
+            read_file.read(writer.Prepare(kStreamChunkSize), kStreamChunkSize);
+            writer.Commit(static_cast<size_t>(read_file.gcount()));
+        }
+    }
+
+    if (!is_loaded)
+    {
+        AppendErrorMessage(kStringErrorFailedToLoadReleaseNotes, error_message);
+    }
+    else if (writer.Size() == 0)
+    {
+        is_loaded = false;
+        AppendErrorMessage(kStringErrorReleaseNotesAreEmpty, error_message);
+    }
+    else if (!UpdateCheckApiUtils::IsValidUtf8(writer.Data(), writer.Size()))
+    {
+        is_loaded = false;
+        AppendErrorMessage(kStringErrorReleaseNotesAreNotValidUtf8, error_message);
+    }
+    else
+    {
+        release_notes = writer.Publish();
+    }
+
+    return is_loaded;
+}
+
+/// @brief API for checking the availability of updates of several products whose JSON files are published together.
+///
+/// @param [in]     latest_releases_url The latest releases url, shared by all products.
+/// @param [in,out] product_checks      The products to check; the results of each are filled in.
+/// @param [out]    error_message       Any error messsages that apply to all products.
+///
+/// @return true if checking for updates is successful for every product; false otherwise.
+bool UpdateCheck::CheckForProductUpdates(const std::string& latest_releases_url, std::vector<ProductCheck>& product_checks, std::string& error_message)
+{
+    bool checked_all_products = false;
+
+    try
+    {
+        // Products that share a JSON file share its download.
+        std::vector<std::string>                json_filenames;
+        std::vector<size_t>                     product_files(product_checks.size(), std::string::npos);
+        std::unordered_map<std::string, size_t> file_indices;
+
+        for (size_t i = 0; i < product_checks.size(); ++i)
+        {
+            ProductCheck& product_check = product_checks[i];
+            product_check.update_info.Reset();
+            product_check.checked_for_update = false;
+            product_check.error_message.clear();
+
+            // Confirm a path to a JSON file was provided.
+            if (product_check.json_filename.rfind(kStringJsonFileExtension) == std::string::npos)
+            {
+                product_check.error_message.append(kStringErrorUrlMustPointToAJsonFile);
+                continue;
+            }
+
+            auto file_index = file_indices.insert(std::make_pair(product_check.json_filename, json_filenames.size())).first;
+            if (file_index->second == json_filenames.size())
+            {
+                json_filenames.push_back(product_check.json_filename);
+            }
+
+            product_files[i] = file_index->second;
+        }
+
+        std::vector<SharedBuffer> json_buffers(json_filenames.size());
+        std::vector<std::string>  file_error_messages(json_filenames.size());
+        std::vector<size_t>       pending_files;
+
+        const bool is_remote_url = (latest_releases_url.find(kStringGithubReleasesLatest) != std::string::npos) ||
+                                   (latest_releases_url.find(kStringHttpPrefix) == 0);
+
+        if (is_remote_url && !UpdateCheck::IsNetworkReachable())
+        {
+            // A download can only time out while there is no route to the server.
+            error_message.append(kStringErrorNetworkUnreachable);
+        }
+        else if (is_remote_url)
+        {
+            // Ask the agent for the files when one is running; the files that it does not answer for are downloaded in this process.
+            bool is_agent_running = true;
+
+            for (size_t i = 0; i < json_filenames.size(); ++i)
+            {
+                bool is_loaded   = false;
+                is_agent_running = is_agent_running &&
+                                   UpdateCheck::RequestJsonFromAgent(latest_releases_url, json_filenames[i], json_buffers[i], is_loaded, file_error_messages[i]);
+
+                if (!is_agent_running)
+                {
+                    pending_files.push_back(i);
+                }
+            }
+        }
+        else
+        {
+            // Attempt to load the JSON files from disk.
+            for (size_t i = 0; i < json_filenames.size(); ++i)
+            {
+                const std::string full_path = latest_releases_url.empty() ? json_filenames[i] : latest_releases_url + "/" + json_filenames[i];
+                LoadJsonFile(full_path, json_buffers[i], file_error_messages[i]);
+            }
+        }
+
+        if (!pending_files.empty())
+        {
+            std::vector<std::string> pending_filenames;
+            std::vector<std::string> pending_urls;
+
+            for (size_t file_index : pending_files)
+            {
+                pending_filenames.push_back(json_filenames[file_index]);
+            }
+
+            if (latest_releases_url.find(kStringGithubReleasesLatest) != std::string::npos)
+            {
+                // Get the JSON files from the latest release (using GitHub Release API), which is requested only once for all of them.
+                std::string release_error_message;
+
+                if (!ResolveLatestReleaseAssetUrls(latest_releases_url, pending_filenames, pending_urls, release_error_message))
+                {
+                    error_message.append(kStringErrorFailedToLoadLatestReleaseInformation);
+                    error_message.append(release_error_message);
+                    pending_urls.assign(pending_filenames.size(), std::string());
+                }
+                else
+                {
+                    for (size_t i = 0; i < pending_files.size(); ++i)
+                    {
+                        if (pending_urls[i].empty())
+                        {
+                            file_error_messages[pending_files[i]].append(kStringErrorAssetNotFound);
+                        }
+                    }
+                }
+            }
+            else if (latest_releases_url.find(kStringGithubReleasesChannel) != std::string::npos)
+            {
+                // Get the JSON files from the newest releases of a channel, which one listing of the releases finds for all of them.
+                std::vector<std::string> asset_error_messages;
+
+                ResolveChannelReleaseAssetUrls(latest_releases_url, pending_filenames, pending_urls, asset_error_messages, error_message);
+
+                for (size_t i = 0; i < pending_files.size(); ++i)
+                {
+                    file_error_messages[pending_files[i]].append(asset_error_messages[i]);
+                }
+            }
+            else
+            {
+                for (const std::string& json_filename : pending_filenames)
+                {
+                    pending_urls.push_back(latest_releases_url + "/" + json_filename);
+                }
+            }
+
+            // Download the JSON files concurrently.
+            std::vector<std::string>  download_urls;
+            std::vector<size_t>       download_files;
+            std::vector<SharedBuffer> downloaded_buffers;
+            std::vector<std::string>  download_error_messages;
+
+            for (size_t i = 0; i < pending_files.size(); ++i)
+            {
+                if (!pending_urls[i].empty())
+                {
+                    download_urls.push_back(pending_urls[i]);
+                    download_files.push_back(pending_files[i]);
+                }
+            }
+
+            DownloadJsonFiles(download_urls, downloaded_buffers, download_error_messages);
+
+            for (size_t i = 0; i < download_files.size(); ++i)
+            {
+                json_buffers[download_files[i]] = downloaded_buffers[i];
+                file_error_messages[download_files[i]].append(download_error_messages[i]);
+            }
+        }
+
+        checked_all_products = !product_checks.empty();
+
+        for (size_t i = 0; i < product_checks.size(); ++i)
+        {
+            ProductCheck& product_check = product_checks[i];
+
+            if (product_files[i] != std::string::npos)
+            {
+                const SharedBuffer& json_buffer = json_buffers[product_files[i]];
+
+                if (json_buffer.Empty())
+                {
+                    product_check.error_message.append(file_error_messages[product_files[i]]);
+                }
+                else
+                {
+                    // Parse the JSON string to populate the update_info struct. The contents
+                    // were validated as UTF-8 when they were loaded.
+                    product_check.checked_for_update = ParseJsonString(json_buffer, true, product_check.update_info, product_check.error_message);
+
+                    if (product_check.checked_for_update && is_remote_url)
+                    {
+                        ClearLocalReleaseNotesUrls(product_check.update_info);
+                    }
+
+                    if (product_check.checked_for_update && FilterToCurrentPlatform(product_check.update_info))
+                    {
+                        SetUpdateAvailability(product_check.product_version, product_check.update_info);
+                    }
+                }
+            }
+
+            checked_all_products = checked_all_products && product_check.checked_for_update;
+        }
+    }
+    catch (std::exception& e)
+    {
+        checked_all_products = false;
+        AppendErrorMessage(kStringErrorUnknownErrorOccurred, error_message);
+        error_message.append(e.what());
+    }
+
+    return checked_all_products;
+}
+
+/// @brief API for opening the connection of a check ahead of time.
+///
+/// @param [in] latest_releases_url The latest releases url that is going to be checked.
+void UpdateCheck::Prewarm(const std::string& latest_releases_url)
+{
+#ifdef UPDATECHECKAPI_CURL
+    if (latest_releases_url.find(kStringHttpPrefix) == 0)
+    {
+        try
+        {
+            CurlTransport::GetDefault().Prewarm(latest_releases_url);
+        }
+        catch (std::exception&)
+        {
+            // Without a prewarmed connection, the check opens its own.
+        }
+    }
+#else
+    // Each download launches rtda, which cannot reuse a connection that was opened here.
+    (void)latest_releases_url;
+#endif  // UPDATECHECKAPI_CURL
+}
+
+/// @brief API for fetching the release notes of a release.
+///
+/// @param [in]  release_notes_url The release notes URL of a release, or the path to a local file.
+/// @param [out] release_notes     The text of the release notes.
+/// @param [out] error_message     Any error messsages that occurred.
+///
+/// @return true if the release notes were fetched successfully; false otherwise.
+bool UpdateCheck::FetchReleaseNotes(const std::string& release_notes_url, std::string& release_notes, std::string& error_message)
+{
+    bool was_fetched = false;
+    release_notes.clear();
+
+    try
+    {
+        if (release_notes_url.empty())
+        {
+            error_message.append(kStringErrorReleaseNotesUrlIsEmpty);
+        }
+        else
+        {
+            std::shared_ptr<const std::string> cached_notes;
+
+            {
+                std::lock_guard<std::mutex> lock(release_notes_cache_mutex);
+                cached_notes = FindCachedReleaseNotes(release_notes_url);
+            }
+
+            // The lock is not held while downloading, so other release notes can be served from the
+            // cache in the meantime. Concurrent requests for the same URL may each download it.
+            if (cached_notes == nullptr)
+            {
+                SharedBuffer downloaded_notes;
+                if (LoadReleaseNotes(release_notes_url, downloaded_notes, error_message))
+                {
+                    // The writer publishes exactly the bytes that were received, so the block is the entire text.
+                    cached_notes = downloaded_notes.GetBlock();
+
+                    std::lock_guard<std::mutex> lock(release_notes_cache_mutex);
+                    CacheReleaseNotes(release_notes_url, cached_notes);
+                }
+            }
+
+            if (cached_notes != nullptr)
+            {
+                release_notes = *cached_notes;
+                was_fetched   = true;
+            }
+        }
+    }
+    catch (std::exception& e)
+    {
+        was_fetched = false;
+        AppendErrorMessage(kStringErrorUnknownErrorOccurred, error_message);
+        error_message.append(e.what());
+    }
+
+    return was_fetched;
+}
+
 /// @brief Utility API to convert from a TargetPlatform enum to a string.
 ///
 /// @param [in] target_platform The target platform value to convert to the string equivalent.
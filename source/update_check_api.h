@@ -7,14 +7,20 @@
 #ifndef UPDATECHECKAPI_UPDATE_CHECK_API_H_
 #define UPDATECHECKAPI_UPDATE_CHECK_API_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "update_check_api_small_vector.h"
+
 // Versioning information of the UpdateCheckAPI.
-#define UPDATECHECKAPI_MAJOR 2
-#define UPDATECHECKAPI_MINOR 1
-#define UPDATECHECKAPI_PATCH 1
+#define UPDATECHECKAPI_MAJOR 3
+#define UPDATECHECKAPI_MINOR 0
+#define UPDATECHECKAPI_PATCH 0
 #define UPDATECHECKAPI_BUILD 0
 
 namespace UpdateCheck
@@ -104,9 +110,52 @@ namespace UpdateCheck
         std::string package_name;
     };
 
+    /// @brief The location of the raw JSON text of a value within a version file.
+    struct ExtensionFieldSpan
+    {
+        /// Byte offset of the value in the version file.
+        size_t offset;
+
+        /// Length of the raw JSON text in bytes.
+        size_t length;
+    };
+
     /// @brief A structure containing all the data pertaining to a specific release.
     struct ReleaseInfo
     {
+        /// @brief Get the raw JSON text of an extension field.
+        ///
+        /// @param [in]  key  The name of the field.
+        /// @param [out] data A pointer to the raw JSON text within manifest_buffer.
+        /// @param [out] size The length of the raw JSON text in bytes.
+        ///
+        /// @return true if the release has the field; false otherwise.
+        bool GetExtensionFieldJson(const std::string& key, const char*& data, size_t& size) const;
+
+        /// @brief Decode an extension field that holds a string.
+        ///
+        /// @param [in]  key   The name of the field.
+        /// @param [out] value The decoded string.
+        ///
+        /// @return true if the release has the field and it is a string; false otherwise.
+        bool GetExtensionFieldString(const std::string& key, std::string& value) const;
+
+        /// @brief Decode an extension field that holds an array of strings.
+        ///
+        /// @param [in]  key    The name of the field.
+        /// @param [out] values The decoded strings.
+        ///
+        /// @return true if the release has the field and it is an array of strings; false otherwise.
+        bool GetExtensionFieldStringList(const std::string& key, std::vector<std::string>& values) const;
+
+        /// @brief Decode an extension field that holds a non-negative integer.
+        ///
+        /// @param [in]  key   The name of the field.
+        /// @param [out] value The decoded number.
+        ///
+        /// @return true if the release has the field and it is an integer that fits into 32 bits; false otherwise.
+        bool GetExtensionFieldUint32(const std::string& key, uint32_t& value) const;
+
         /// The version of the available update.
         VersionInfo version;
 
@@ -116,30 +165,158 @@ namespace UpdateCheck
         /// Text describing the available update, may include release notes highlights for example.
         std::string title;
 
+        /// The location of the full release notes (Schema 1.6 only; optional, and empty if the version file does not have one).
+        /// The notes are not part of the version file; they are fetched on request with FetchReleaseNotes().
+        /// A version file that was downloaded may only refer to http and https URLs; a path to a local file
+        /// is only kept when the version file itself was loaded from a local file, and is otherwise left empty.
+        std::string release_notes_url;
+
         /// The target platforms to which the packge referenced by this link is relevant.
-        std::vector<TargetPlatform> target_platforms;
+        /// Stored inline for up to four platforms.
+        SmallVector<TargetPlatform, 4> target_platforms;
 
         /// The type of the release for the package that is referenced by this link.
         ReleaseType type;
 
         /// Arbitrary string tags that can help identify a particular release.
-        std::vector<std::string> tags;
+        /// Stored inline for up to four tags.
+        SmallVector<std::string, 4> tags;
 
         /// The available update packages: package type and URL from which they can be downloaded.
-        std::vector<DownloadLink> download_links;
+        /// Stored inline for up to three links.
+        SmallVector<DownloadLink, 3> download_links;
 
         /// Links to relevant pages, like product landing page on GPUOpen, or Releases page on Github.com.
-        std::vector<InfoPageLink> info_links;
+        /// Stored inline for up to two links.
+        SmallVector<InfoPageLink, 2> info_links;
+
+        /// Fields of the release that are not part of the schema (Schema 1.6 only), keyed by name.
+        /// The values are not decoded; each one refers to its raw JSON text in manifest_buffer.
+        std::map<std::string, ExtensionFieldSpan> extension_fields;
+
+        /// The contents of the version file that extension_fields refer to. Only set if there are extension fields.
+        std::shared_ptr<const std::string> manifest_buffer;
     };
 
     /// @brief A structure containing a collection of releases, and a flag to indicate if at least one of the releases is an update to the current version.
     struct UpdateInfo
     {
+        /// @brief Clear the results of a previous check so the struct can be reused for the next one.
+        ///
+        /// The releases are kept in recycled_releases rather than destroyed, so
+        /// that the next check can reuse the memory of their strings and lists.
+        /// A periodic check of a version file that has not changed in size then
+        /// performs close to no allocations.
+        void Reset();
+
         /// True if an update to a newer version is available, false otherwise.
         bool is_update_available;
 
         /// List of releases available during this update.
         std::vector<ReleaseInfo> releases;
+
+        /// Releases from previous checks, kept by Reset() so that their memory can be reused. Their contents are stale,
+        /// and they do not keep the version file alive. There are never more than the last check parsed.
+        std::vector<ReleaseInfo> recycled_releases;
+    };
+
+    /// @brief The check of one of several products whose JSON files are published together.
+    struct ProductCheck
+    {
+        /// The current product version.
+        VersionInfo product_version;
+
+        /// The json file name of the product.
+        std::string json_filename;
+
+        /// The update info of the product.
+        UpdateInfo update_info;
+
+        /// True if checking for updates of the product was successful.
+        bool checked_for_update;
+
+        /// Any error messages of the product.
+        std::string error_message;
+    };
+
+    /// @brief A function that is called with each release as soon as it has been parsed.
+    ///
+    /// @param [in] release_info The release.
+    ///
+    /// @return true to continue; false to stop parsing (and downloading) the version file.
+    typedef std::function<bool(const ReleaseInfo& release_info)> ReleaseCallback;
+
+    /// @brief Parses a version file incrementally while it is being downloaded.
+    ///
+    /// Chunks of the file are supplied to Feed() in the order that they arrive,
+    /// and may be split at any byte. For Schema 1.6 files, each element of the
+    /// Releases list is parsed as soon as it has been received in full and is
+    /// passed to the release callback, so the caller can act on a release near
+    /// the top of the file before the rest of it has arrived. Releases that are
+    /// reported early have not been checked against the rest of the document;
+    /// the final result is only known once Finish() returns. Files using older
+    /// schemas are parsed by Finish().
+    class ManifestPushParser
+    {
+    public:
+        /// @brief Constructor.
+        ///
+        /// @param [in] release_callback The function to call with each complete release; may be empty.
+        explicit ManifestPushParser(const ReleaseCallback& release_callback);
+
+        /// @brief Constructor that parses the releases into the memory of the releases that an UpdateInfo recycled.
+        ///
+        /// @param [in]     release_callback The function to call with each complete release; may be empty.
+        /// @param [in,out] update_info      The update info struct that is later passed to Finish(), after its Reset().
+        ManifestPushParser(const ReleaseCallback& release_callback, UpdateInfo& update_info);
+
+        /// @brief Destructor.
+        ~ManifestPushParser();
+
+        /// @brief Get space at the end of the parser's buffer to receive the next chunk into.
+        ///
+        /// A chunk that is written here and then passed to Feed() is not copied.
+        /// The pointer is only valid until the next call to PrepareFeed() or Feed().
+        ///
+        /// @param [in] size The maximum size of the chunk in bytes.
+        ///
+        /// @return A pointer to at least size writable bytes.
+        char* PrepareFeed(size_t size);
+
+        /// @brief Supply the next chunk of the version file.
+        ///
+        /// @param [in] data The bytes of the chunk; either a caller's buffer, or the space returned by PrepareFeed().
+        /// @param [in] size The number of bytes.
+        ///
+        /// @return true if more data is wanted; false if the release callback asked to stop, or the file is not valid UTF-8 text.
+        bool Feed(const char* data, size_t size);
+
+        /// @brief Check whether the release callback asked to stop.
+        ///
+        /// @return true if parsing was stopped early.
+        bool IsStopped() const;
+
+        /// @brief Complete parsing once all of the chunks have been supplied.
+        ///
+        /// If the release callback asked to stop, update_info receives the
+        /// releases that were reported up to that point. Otherwise the entire
+        /// file is validated and update_info receives all of its releases. The
+        /// is_update_available flag is not modified.
+        ///
+        /// @param [out] update_info   The update info struct.
+        /// @param [out] error_message Any error messages that occurred.
+        ///
+        /// @return true if the version file was parsed successfully; false otherwise.
+        bool Finish(UpdateInfo& update_info, std::string& error_message);
+
+    private:
+        ManifestPushParser(const ManifestPushParser&)            = delete;
+        ManifestPushParser& operator=(const ManifestPushParser&) = delete;
+
+        struct Impl;
+
+        /// The parser state.
+        std::unique_ptr<Impl> impl_;
     };
 
     /// @brief Get API Version information.
@@ -162,6 +339,74 @@ namespace UpdateCheck
                          UpdateInfo&        update_info,
                          std::string&       error_message);
 
+    /// @brief API for checking the availability of product updates, reporting releases as they arrive.
+    ///
+    /// The version file is parsed while it is being downloaded. Each release
+    /// that targets the current platform is passed to release_callback as soon
+    /// as it has been received. If the callback returns false, for example
+    /// because it has found a newer version, the download is stopped and
+    /// update_info only contains the releases reported so far.
+    ///
+    /// @param [in]  product_version     The current product version.
+    /// @param [in]  latest_releases_url The latest releases url.
+    /// @param [in]  json_filename       The json file name.
+    /// @param [in]  release_callback    The function to call with each release for the current platform.
+    /// @param [in]  update_info         The update info struct.
+    /// @param [out] error_message       Any error messsages that occurred.
+    ///
+    /// @return true if checking for updates is successful; false otherwise
+    bool CheckForUpdates(const VersionInfo&     current_product_version,
+                         const std::string&     latest_release_url,
+                         const std::string&     json_filename,
+                         const ReleaseCallback& release_callback,
+                         UpdateInfo&            update_info,
+                         std::string&           error_message);
+
+    /// @brief API for checking the availability of updates of several products whose JSON files are published together.
+    ///
+    /// This is for repositories that attach the JSON files of several products
+    /// to one release. The latest release is requested once, and the download
+    /// URLs of all JSON files are found in a single pass over the response while
+    /// it is being received; the download stops as soon as all of them have been
+    /// found. The JSON files are then downloaded concurrently. Other URLs are
+    /// handled as by CheckForUpdates(), with the JSON files downloaded concurrently.
+    ///
+    /// @param [in]     latest_releases_url The latest releases url, shared by all products.
+    /// @param [in,out] product_checks      The products to check; the results of each are filled in.
+    /// @param [out]    error_message       Any error messsages that apply to all products.
+    ///
+    /// @return true if checking for updates is successful for every product; false otherwise.
+    bool CheckForProductUpdates(const std::string& latest_releases_url, std::vector<ProductCheck>& product_checks, std::string& error_message);
+
+    /// @brief API for opening the connection of a check ahead of time.
+    ///
+    /// Call this early during application startup, for example before showing
+    /// a splash screen, with the URL that is later passed to CheckForUpdates().
+    /// It returns immediately; the host name is resolved and a connection is
+    /// opened in the background, so that the check starts on an open connection
+    /// instead of waiting for DNS, TCP and TLS. It has no effect for local paths,
+    /// or when files are downloaded with rtda rather than in-process.
+    ///
+    /// @param [in] latest_releases_url The latest releases url that is going to be checked.
+    void Prewarm(const std::string& latest_releases_url);
+
+    /// @brief API for fetching the release notes of a release.
+    ///
+    /// The release notes are only downloaded the first time that they are
+    /// requested. Up to 4 MiB of the most recently used release notes are
+    /// kept in memory, so later requests for the same URL return immediately. The first
+    /// request blocks until the download is complete; applications with a UI
+    /// can use ThreadController::StartFetchReleaseNotes() to fetch them in the
+    /// background instead. http and https URLs are downloaded; anything else is
+    /// read as a local file.
+    ///
+    /// @param [in]  release_notes_url The release notes URL of a release, or the path to a local file.
+    /// @param [out] release_notes     The text of the release notes.
+    /// @param [out] error_message     Any error messsages that occurred.
+    ///
+    /// @return true if the release notes were fetched successfully; false otherwise.
+    bool FetchReleaseNotes(const std::string& release_notes_url, std::string& release_notes, std::string& error_message);
+
     /// @brief Utility API to convert from a TargetPlatform enum to a string.
     ///
     /// @param [in] target_platform The target platform value to convert to the string equivalent.
@@ -0,0 +1,1433 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A per-user agent that checks for updates on behalf of all local tools.
+//==============================================================================
+#include "update_check_api_agent.h"
+#include "update_check_api_network_watcher.h"
+#ifdef UPDATECHECKAPI_CURL
+#include "update_check_api_curl_transport.h"
+#endif
+#include "update_check_api_strings.h"
+#include "update_check_api_utils.h"
+
+#ifndef _WIN32
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using UpdateCheckApiUtils::SharedBuffer;
+
+namespace UpdateCheck
+{
+    AgentOptions::AgentOptions()
+        : cache_timeout_s(900)
+        , refresh_interval_s(21600)
+    {
+    }
+
+#ifndef _WIN32
+    // The types of the messages between the agent and its clients.
+    enum AgentMessageType : uint8_t
+    {
+        kAgentMessageCheck      = 1,  ///< Client: send the JSON file of a check.
+        kAgentMessageSubscribe  = 2,  ///< Client: report when the JSON file of a check changes.
+        kAgentMessageJson       = 3,  ///< Agent: the contents of the JSON file.
+        kAgentMessageError      = 4,  ///< Agent: the JSON file could not be loaded; the payload is the error message.
+        kAgentMessageSubscribed = 5,  ///< Agent: the subscription was accepted.
+        kAgentMessageChanged    = 6   ///< Agent: the JSON file of a subscription changed.
+    };
+
+    // The size of the header of each frame: payload size, message type and request id.
+    static const size_t kAgentFrameHeaderSize = 9;
+
+    // The largest request that the agent accepts; requests only hold a URL and a filename.
+    static const uint32_t kAgentMaxRequestSize = 65536;
+
+    // The largest JSON file that a client accepts from the agent.
+    static const uint32_t kAgentMaxResponseSize = 256 * 1024 * 1024;
+
+    // How long a client waits for the agent to answer, in milliseconds. This is longer
+    // than the agent's own downloads may take, so that their errors reach the client.
+    static const int kAgentResponseTimeoutMs = 90000;
+
+    // How soon a subscribed file is downloaded again after a download failed, in seconds.
+    static const long kAgentRetryIntervalS = 300;
+
+    // The size of the chunks that the agent reads requests in.
+    static const size_t kAgentReadChunkSize = 16384;
+
+#ifdef UPDATECHECKAPI_CURL
+    // How often Stop() cancels the transfers of the downloads that are still running, in milliseconds.
+    static const int kAgentCancelIntervalMs = 50;
+#endif
+
+#ifdef MSG_NOSIGNAL
+    // A client that went away must not kill the process that writes to it.
+    static const int kAgentSendFlags = MSG_NOSIGNAL;
+#else
+    static const int kAgentSendFlags = 0;
+#endif
+
+    /// @brief Append a little-endian uint32 to a buffer.
+    static void AppendUint32(std::string& buffer, uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+        }
+    }
+
+    /// @brief Read a little-endian uint32.
+    static uint32_t ReadUint32(const char* data)
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+        return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) | (static_cast<uint32_t>(bytes[2]) << 16) |
+               (static_cast<uint32_t>(bytes[3]) << 24);
+    }
+
+    /// @brief Build the header of a frame.
+    ///
+    /// @param [in] type         The message type.
+    /// @param [in] request_id   The id of the request that the frame belongs to.
+    /// @param [in] payload_size The size of the payload that follows the header.
+    ///
+    /// @return The header.
+    static std::string MakeFrameHeader(uint8_t type, uint32_t request_id, size_t payload_size)
+    {
+        std::string header;
+        header.reserve(kAgentFrameHeaderSize);
+        AppendUint32(header, static_cast<uint32_t>(payload_size));
+        header.push_back(static_cast<char>(type));
+        AppendUint32(header, request_id);
+        return header;
+    }
+
+    /// @brief Build the frame of a check or subscribe request.
+    static std::string MakeRequestFrame(uint8_t type, uint32_t request_id, const std::string& latest_releases_url, const std::string& json_filename)
+    {
+        std::string payload;
+        AppendUint32(payload, static_cast<uint32_t>(latest_releases_url.size()));
+        payload.append(latest_releases_url);
+        AppendUint32(payload, static_cast<uint32_t>(json_filename.size()));
+        payload.append(json_filename);
+
+        return MakeFrameHeader(type, request_id, payload.size()) + payload;
+    }
+
+    /// @brief Read a length-prefixed string from a payload.
+    ///
+    /// @param [in,out] data  The position in the payload; moved past the string.
+    /// @param [in]     end   The end of the payload.
+    /// @param [out]    value The string.
+    ///
+    /// @return true if the string fits in the payload; false otherwise.
+    static bool ReadString(const char*& data, const char* end, std::string& value)
+    {
+        bool is_read = false;
+
+        if (end - data >= 4)
+        {
+            uint32_t size = ReadUint32(data);
+            data += 4;
+
+            if (static_cast<size_t>(end - data) >= size)
+            {
+                value.assign(data, size);
+                data += size;
+                is_read = true;
+            }
+        }
+
+        return is_read;
+    }
+
+    /// @brief Keep a file descriptor from being inherited by child processes.
+    static void SetCloseOnExec(int fd)
+    {
+        fcntl(fd, F_SETFD, fcntl(fd, F_GETFD) | FD_CLOEXEC);
+    }
+
+    /// @brief Make reads and writes of a file descriptor return instead of waiting.
+    static void SetNonBlocking(int fd)
+    {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    }
+
+    /// @brief Open a Unix domain stream socket.
+    static int OpenAgentSocket()
+    {
+        int agent_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (agent_socket >= 0)
+        {
+            SetCloseOnExec(agent_socket);
+#ifdef SO_NOSIGPIPE
+            int is_enabled = 1;
+            setsockopt(agent_socket, SOL_SOCKET, SO_NOSIGPIPE, &is_enabled, sizeof(is_enabled));
+#endif
+        }
+
+        return agent_socket;
+    }
+
+    /// @brief Fill in the address of a socket path.
+    ///
+    /// @return false if the path does not fit in the address.
+    static bool MakeSocketAddress(const std::string& socket_path, struct sockaddr_un& address)
+    {
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+
+        bool is_valid = !socket_path.empty() && socket_path.size() < sizeof(address.sun_path);
+
+        if (is_valid)
+        {
+            memcpy(address.sun_path, socket_path.c_str(), socket_path.size());
+        }
+
+        return is_valid;
+    }
+
+    /// @brief Check that the process at the other end of a socket runs as the current user.
+    static bool IsPeerCurrentUser(int connected_socket)
+    {
+#ifdef __APPLE__
+        uid_t peer_uid = 0;
+        gid_t peer_gid = 0;
+        return getpeereid(connected_socket, &peer_uid, &peer_gid) == 0 && peer_uid == getuid();
+#else
+        struct ucred peer_credentials;
+        socklen_t    size = sizeof(peer_credentials);
+        return getsockopt(connected_socket, SOL_SOCKET, SO_PEERCRED, &peer_credentials, &size) == 0 && peer_credentials.uid == getuid();
+#endif
+    }
+
+    /// @brief Connect to the agent.
+    ///
+    /// @param [in] socket_path The path of the agent's socket.
+    ///
+    /// @return The connected socket, or -1 if no agent of the current user listens on the path.
+    static int ConnectToAgent(const std::string& socket_path)
+    {
+        int                agent_socket = -1;
+        struct sockaddr_un address;
+
+        // Checking that the socket exists first is much cheaper than creating one to find out.
+        if (MakeSocketAddress(socket_path, address) && access(socket_path.c_str(), F_OK) == 0)
+        {
+            agent_socket = OpenAgentSocket();
+
+            if (agent_socket >= 0 && (connect(agent_socket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0 ||
+                                      !IsPeerCurrentUser(agent_socket)))
+            {
+                close(agent_socket);
+                agent_socket = -1;
+            }
+        }
+
+        return agent_socket;
+    }
+
+    /// @brief Send all of a buffer over a blocking socket.
+    static bool SendAll(int connected_socket, const char* data, size_t size)
+    {
+        while (size > 0)
+        {
+            ssize_t sent = send(connected_socket, data, size, kAgentSendFlags);
+
+            if (sent < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return false;
+            }
+
+            data += sent;
+            size -= static_cast<size_t>(sent);
+        }
+
+        return true;
+    }
+
+    /// @brief Receive exactly size bytes from a socket, unless the deadline passes first.
+    static bool ReceiveAll(int connected_socket, char* data, size_t size, std::chrono::steady_clock::time_point deadline)
+    {
+        while (size > 0)
+        {
+            long long remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+
+            if (remaining_ms <= 0)
+            {
+                return false;
+            }
+
+            struct pollfd poll_fd;
+            poll_fd.fd     = connected_socket;
+            poll_fd.events = POLLIN;
+
+            int ready = poll(&poll_fd, 1, static_cast<int>(remaining_ms));
+
+            if (ready < 0 && errno != EINTR)
+            {
+                return false;
+            }
+
+            if (ready > 0)
+            {
+                ssize_t received = recv(connected_socket, data, size, 0);
+
+                if (received == 0 || (received < 0 && errno != EINTR && errno != EAGAIN))
+                {
+                    return false;
+                }
+
+                if (received > 0)
+                {
+                    data += received;
+                    size -= static_cast<size_t>(received);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief Receive the header of a frame.
+    static bool ReceiveFrameHeader(int connected_socket, uint8_t& type, uint32_t& request_id, uint32_t& payload_size, std::chrono::steady_clock::time_point deadline)
+    {
+        char header[kAgentFrameHeaderSize];
+        bool is_received = ReceiveAll(connected_socket, header, sizeof(header), deadline);
+
+        if (is_received)
+        {
+            payload_size = ReadUint32(header);
+            type         = static_cast<uint8_t>(header[4]);
+            request_id   = ReadUint32(header + 5);
+        }
+
+        return is_received;
+    }
+
+    std::string GetAgentSocketPath()
+    {
+        std::string socket_path;
+        const char* runtime_directory = getenv(kStringRuntimeDirectoryEnvVariableName);
+
+        if (runtime_directory != nullptr && runtime_directory[0] != '\0')
+        {
+            // The runtime directory belongs to the user, so nobody else can create the socket.
+            socket_path = std::string(runtime_directory) + "/" + kStringAgentSocketName;
+        }
+        else if (UpdateCheckApiUtils::GetTempDirectory(socket_path))
+        {
+            // The temporary directory is shared, so the name includes the user; clients also
+            // check that the agent runs as the same user before trusting what it sends.
+            socket_path += "/" + std::to_string(getuid()) + "-" + kStringAgentSocketName;
+        }
+
+        return socket_path;
+    }
+
+    bool RequestJsonFromAgent(const std::string&                 latest_releases_url,
+                              const std::string&                 json_filename,
+                              UpdateCheckApiUtils::SharedBuffer& json_buffer,
+                              bool&                              is_loaded,
+                              std::string&                       error_message)
+    {
+        bool is_answered = false;
+        is_loaded        = false;
+
+        int agent_socket = ConnectToAgent(GetAgentSocketPath());
+
+        if (agent_socket >= 0)
+        {
+            try
+            {
+                const std::string request  = MakeRequestFrame(kAgentMessageCheck, 1, latest_releases_url, json_filename);
+                const auto        deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(kAgentResponseTimeoutMs);
+
+                uint8_t  type         = 0;
+                uint32_t request_id   = 0;
+                uint32_t payload_size = 0;
+
+                if (SendAll(agent_socket, request.data(), request.size()) && ReceiveFrameHeader(agent_socket, type, request_id, payload_size, deadline) &&
+                    (type == kAgentMessageJson || type == kAgentMessageError) && payload_size <= kAgentMaxResponseSize)
+                {
+                    // Receive the payload straight into the block that the buffer shares.
+                    std::shared_ptr<std::string> payload = std::make_shared<std::string>(payload_size, '\0');
+
+                    if (payload_size == 0 || ReceiveAll(agent_socket, &(*payload)[0], payload_size, deadline))
+                    {
+                        is_answered = true;
+
+                        if (type == kAgentMessageJson)
+                        {
+                            is_loaded   = true;
+                            json_buffer = SharedBuffer(payload);
+                        }
+                        else
+                        {
+                            error_message.append(*payload);
+                        }
+                    }
+                }
+            }
+            catch (std::exception&)
+            {
+                // Fall back to loading the file in this process.
+                is_answered = false;
+            }
+
+            close(agent_socket);
+        }
+
+        return is_answered;
+    }
+
+    /// @brief A JSON file that the agent downloaded, and the clients that wait for it or subscribed to it.
+    struct AgentCacheEntry
+    {
+        AgentCacheEntry()
+            : is_fetching(false)
+        {
+        }
+
+        /// The latest releases url of the check.
+        std::string latest_releases_url;
+
+        /// The json file name of the check.
+        std::string json_filename;
+
+        /// The contents that were downloaded last; empty until a download succeeds.
+        SharedBuffer contents;
+
+        /// When the contents were downloaded.
+        std::chrono::steady_clock::time_point fetched_at;
+
+        /// When the contents are downloaded again, if there are subscribers.
+        std::chrono::steady_clock::time_point next_refresh;
+
+        /// True while a download of the file is running.
+        bool is_fetching;
+
+        /// The clients that wait for the download to finish, with the ids of their requests.
+        std::vector<std::pair<int, uint32_t>> waiters;
+
+        /// The clients that subscribed to changes, with the ids of their subscriptions.
+        std::vector<std::pair<int, uint32_t>> subscribers;
+    };
+
+    /// @brief The result of a download, passed from its thread to the thread of the agent.
+    struct AgentFetchResult
+    {
+        /// The key of the cache entry.
+        std::string key;
+
+        /// True if the file was downloaded.
+        bool is_loaded;
+
+        /// The contents of the file.
+        SharedBuffer contents;
+
+        /// Any error messages that occurred.
+        std::string error_message;
+    };
+
+    /// @brief A connected client of the agent.
+    struct AgentClient
+    {
+        /// The bytes of requests that were received but not handled yet.
+        std::string input;
+
+        /// The frames that are waiting to be sent; the contents of files are shared with the cache, not copied.
+        std::deque<SharedBuffer> output;
+    };
+
+    struct Agent::Impl
+    {
+        Impl(const AgentOptions& agent_options)
+            : options(agent_options)
+            , listen_socket(-1)
+            , is_stopping(false)
+            , is_refresh_requested(false)
+        {
+            wake_pipe[0] = -1;
+            wake_pipe[1] = -1;
+        }
+
+        /// @brief Wake the thread of the agent.
+        void Wake()
+        {
+            const char wake = 0;
+
+            // The pipe is non-blocking; if it is full, the thread is going to wake up anyway.
+            while (write(wake_pipe[1], &wake, sizeof(wake)) < 0 && errno == EINTR)
+            {
+            }
+        }
+
+        /// @brief Serve clients until the agent is stopped.
+        void Run();
+
+        /// @brief Accept the clients that are waiting to connect.
+        void AcceptClients();
+
+        /// @brief Read and handle the requests of a client.
+        ///
+        /// @return false if the client must be disconnected.
+        bool ReadClient(int client_socket);
+
+        /// @brief Handle a request of a client.
+        ///
+        /// @return false if the request is invalid and the client must be disconnected.
+        bool HandleRequest(int client_socket, uint8_t type, uint32_t request_id, const char* payload, size_t payload_size);
+
+        /// @brief Send as much of the output of a client as the socket takes.
+        ///
+        /// @return false if the client must be disconnected.
+        bool FlushClient(int client_socket, AgentClient& client);
+
+        /// @brief Queue a frame for a client.
+        void SendFrame(int client_socket, uint8_t type, uint32_t request_id, const SharedBuffer& payload);
+
+        /// @brief Disconnect a client, and forget its requests and subscriptions.
+        void CloseClient(int client_socket);
+
+        /// @brief Start downloading the file of a cache entry on a thread of its own.
+        void StartFetch(const std::string& key, AgentCacheEntry& entry);
+
+        /// @brief Answer the clients that waited for a download, and tell subscribers if the file changed.
+        void FinishFetch(const AgentFetchResult& result);
+
+        /// @brief Start the downloads of subscribed files that are due, and get the time until the next one is.
+        ///
+        /// @return The time to wait in milliseconds, or -1 to wait until a client or download wakes the thread.
+        int StartDueRefreshes();
+
+        /// The options of the agent.
+        AgentOptions options;
+
+        /// The path of the socket that the agent listens on.
+        std::string socket_path;
+
+        /// The socket that clients connect to.
+        int listen_socket;
+
+        /// Written to, to wake the thread of the agent.
+        int wake_pipe[2];
+
+        /// The thread that serves clients.
+        std::thread thread;
+
+        /// Protects completed_fetches, is_stopping and is_refresh_requested.
+        std::mutex mutex;
+
+        /// Downloads that finished, and that the thread of the agent has not handled yet.
+        std::vector<AgentFetchResult> completed_fetches;
+
+        /// Set to stop the thread of the agent.
+        bool is_stopping;
+
+        /// Set when the network became reachable, to refresh all subscribed files.
+        bool is_refresh_requested;
+
+        /// The threads of the running downloads, by cache key. Only used by the thread of the agent, and by Stop() after it finished.
+        std::map<std::string, std::thread> fetch_threads;
+
+        /// The downloaded files, by cache key. Only used by the thread of the agent.
+        std::map<std::string, AgentCacheEntry> cache;
+
+        /// The connected clients, by socket. Only used by the thread of the agent.
+        std::map<int, AgentClient> clients;
+
+        /// Refreshes the subscribed files when the network comes back, and makes downloads fail fast while it is gone.
+        NetworkWatcher network_watcher;
+    };
+
+    void Agent::Impl::Run()
+    {
+        std::vector<struct pollfd> poll_fds;
+        std::vector<int>           closed_clients;
+
+        for (;;)
+        {
+            std::vector<AgentFetchResult> fetch_results;
+            bool                          is_refresh_due = false;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (is_stopping)
+                {
+                    break;
+                }
+
+                fetch_results.swap(completed_fetches);
+                std::swap(is_refresh_due, is_refresh_requested);
+            }
+
+            for (const AgentFetchResult& result : fetch_results)
+            {
+                auto fetch_thread = fetch_threads.find(result.key);
+
+                if (fetch_thread != fetch_threads.end())
+                {
+                    fetch_thread->second.join();
+                    fetch_threads.erase(fetch_thread);
+                }
+
+                FinishFetch(result);
+            }
+
+            if (is_refresh_due)
+            {
+                const auto now = std::chrono::steady_clock::now();
+
+                for (auto& entry : cache)
+                {
+                    entry.second.next_refresh = now;
+                }
+            }
+
+            int timeout_ms = StartDueRefreshes();
+
+            poll_fds.clear();
+            poll_fds.push_back({wake_pipe[0], POLLIN, 0});
+            poll_fds.push_back({listen_socket, POLLIN, 0});
+
+            for (const auto& client : clients)
+            {
+                short events = POLLIN;
+
+                if (!client.second.output.empty())
+                {
+                    events |= POLLOUT;
+                }
+
+                poll_fds.push_back({client.first, events, 0});
+            }
+
+            if (poll(poll_fds.data(), poll_fds.size(), timeout_ms) < 0)
+            {
+                continue;
+            }
+
+            if (poll_fds[0].revents != 0)
+            {
+                char    drained[64];
+                ssize_t received = 0;
+
+                do
+                {
+                    received = read(wake_pipe[0], drained, sizeof(drained));
+                } while (received > 0 || (received < 0 && errno == EINTR));
+            }
+
+            if (poll_fds[1].revents != 0)
+            {
+                AcceptClients();
+            }
+
+            closed_clients.clear();
+
+            for (size_t i = 2; i < poll_fds.size(); ++i)
+            {
+                auto client = clients.find(poll_fds[i].fd);
+
+                if (client == clients.end() || poll_fds[i].revents == 0)
+                {
+                    continue;
+                }
+
+                bool is_connected = true;
+
+                if ((poll_fds[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+                {
+                    is_connected = ReadClient(poll_fds[i].fd);
+                }
+
+                if (is_connected && !client->second.output.empty())
+                {
+                    is_connected = FlushClient(poll_fds[i].fd, client->second);
+                }
+
+                if (!is_connected)
+                {
+                    closed_clients.push_back(poll_fds[i].fd);
+                }
+            }
+
+            for (int client_socket : closed_clients)
+            {
+                CloseClient(client_socket);
+            }
+        }
+    }
+
+    void Agent::Impl::AcceptClients()
+    {
+        for (;;)
+        {
+            int client_socket = accept(listen_socket, nullptr, nullptr);
+
+            if (client_socket < 0)
+            {
+                if (errno == EINTR || errno == ECONNABORTED)
+                {
+                    continue;
+                }
+
+                break;
+            }
+
+            SetCloseOnExec(client_socket);
+            SetNonBlocking(client_socket);
+
+            if (IsPeerCurrentUser(client_socket))
+            {
+                clients[client_socket];
+            }
+            else
+            {
+                close(client_socket);
+            }
+        }
+    }
+
+    bool Agent::Impl::ReadClient(int client_socket)
+    {
+        AgentClient& client       = clients[client_socket];
+        bool         is_connected = true;
+        char         chunk[kAgentReadChunkSize];
+
+        for (;;)
+        {
+            ssize_t received = recv(client_socket, chunk, sizeof(chunk), 0);
+
+            if (received > 0)
+            {
+                client.input.append(chunk, static_cast<size_t>(received));
+            }
+            else if (received < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            else
+            {
+                is_connected = (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+                break;
+            }
+        }
+
+        size_t offset = 0;
+
+        while (is_connected && client.input.size() - offset >= kAgentFrameHeaderSize)
+        {
+            const char*    header       = client.input.data() + offset;
+            const uint32_t payload_size = ReadUint32(header);
+
+            if (payload_size > kAgentMaxRequestSize)
+            {
+                is_connected = false;
+            }
+            else if (client.input.size() - offset - kAgentFrameHeaderSize < payload_size)
+            {
+                break;
+            }
+            else
+            {
+                is_connected = HandleRequest(client_socket, static_cast<uint8_t>(header[4]), ReadUint32(header + 5), header + kAgentFrameHeaderSize, payload_size);
+                offset += kAgentFrameHeaderSize + payload_size;
+            }
+        }
+
+        client.input.erase(0, offset);
+
+        return is_connected;
+    }
+
+    bool Agent::Impl::HandleRequest(int client_socket, uint8_t type, uint32_t request_id, const char* payload, size_t payload_size)
+    {
+        const char* end = payload + payload_size;
+        std::string latest_releases_url;
+        std::string json_filename;
+
+        bool is_valid = (type == kAgentMessageCheck || type == kAgentMessageSubscribe) && ReadString(payload, end, latest_releases_url) &&
+                        ReadString(payload, end, json_filename);
+
+        if (is_valid)
+        {
+            const std::string key   = latest_releases_url + '\n' + json_filename;
+            AgentCacheEntry&  entry = cache[key];
+            const auto        now   = std::chrono::steady_clock::now();
+
+            entry.latest_releases_url = latest_releases_url;
+            entry.json_filename       = json_filename;
+
+            if (type == kAgentMessageCheck)
+            {
+                if (!entry.contents.Empty() && now - entry.fetched_at < std::chrono::seconds(options.cache_timeout_s))
+                {
+                    SendFrame(client_socket, kAgentMessageJson, request_id, entry.contents);
+                }
+                else
+                {
+                    // Checks that arrive while the file is being downloaded share the download.
+                    entry.waiters.push_back(std::make_pair(client_socket, request_id));
+
+                    if (!entry.is_fetching)
+                    {
+                        StartFetch(key, entry);
+                    }
+                }
+            }
+            else
+            {
+                if (entry.subscribers.empty())
+                {
+                    entry.next_refresh = entry.contents.Empty() ? now : entry.fetched_at + std::chrono::seconds(options.refresh_interval_s);
+                }
+
+                entry.subscribers.push_back(std::make_pair(client_socket, request_id));
+                SendFrame(client_socket, kAgentMessageSubscribed, request_id, SharedBuffer());
+            }
+        }
+
+        return is_valid;
+    }
+
+    bool Agent::Impl::FlushClient(int client_socket, AgentClient& client)
+    {
+        bool is_connected = true;
+
+        while (is_connected && !client.output.empty())
+        {
+            const SharedBuffer& frame = client.output.front();
+            ssize_t             sent  = send(client_socket, frame.Data(), frame.Size(), kAgentSendFlags);
+
+            if (sent < 0)
+            {
+                is_connected = (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK);
+
+                if (errno != EINTR)
+                {
+                    break;
+                }
+            }
+            else if (static_cast<size_t>(sent) == frame.Size())
+            {
+                client.output.pop_front();
+            }
+            else
+            {
+                client.output.front() = frame.Slice(static_cast<size_t>(sent), frame.Size());
+            }
+        }
+
+        return is_connected;
+    }
+
+    void Agent::Impl::SendFrame(int client_socket, uint8_t type, uint32_t request_id, const SharedBuffer& payload)
+    {
+        auto client = clients.find(client_socket);
+
+        if (client != clients.end())
+        {
+            client->second.output.push_back(SharedBuffer(std::make_shared<const std::string>(MakeFrameHeader(type, request_id, payload.Size()))));
+
+            if (!payload.Empty())
+            {
+                client->second.output.push_back(payload);
+            }
+        }
+    }
+
+    void Agent::Impl::CloseClient(int client_socket)
+    {
+        for (auto& entry : cache)
+        {
+            for (std::vector<std::pair<int, uint32_t>>* requests : {&entry.second.waiters, &entry.second.subscribers})
+            {
+                for (size_t i = 0; i < requests->size();)
+                {
+                    if ((*requests)[i].first == client_socket)
+                    {
+                        requests->erase(requests->begin() + i);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+            }
+        }
+
+        clients.erase(client_socket);
+        close(client_socket);
+    }
+
+    void Agent::Impl::StartFetch(const std::string& key, AgentCacheEntry& entry)
+    {
+        entry.is_fetching = true;
+
+        AgentFetchResult result;
+        result.key       = key;
+        result.is_loaded = false;
+
+        if (!IsNetworkReachable())
+        {
+            // Downloads can only time out; the file is downloaded again when the network comes back.
+            result.error_message = kStringErrorNetworkUnreachable;
+            FinishFetch(result);
+        }
+        else
+        {
+            try
+            {
+                const std::string latest_releases_url = entry.latest_releases_url;
+                const std::string json_filename       = entry.json_filename;
+
+                fetch_threads[key] = std::thread([this, result, latest_releases_url, json_filename]() mutable {
+                    try
+                    {
+                        result.is_loaded = LoadRemoteJson(latest_releases_url, json_filename, result.contents, result.error_message);
+                    }
+                    catch (std::exception& e)
+                    {
+                        result.is_loaded = false;
+                        result.error_message.append(kStringErrorUnknownErrorOccurred);
+                        result.error_message.append(e.what());
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        completed_fetches.push_back(std::move(result));
+                    }
+
+                    Wake();
+                });
+            }
+            catch (std::exception& e)
+            {
+                fetch_threads.erase(key);
+                result.error_message.append(kStringErrorUnknownErrorOccurred);
+                result.error_message.append(e.what());
+                FinishFetch(result);
+            }
+        }
+    }
+
+    void Agent::Impl::FinishFetch(const AgentFetchResult& result)
+    {
+        auto found = cache.find(result.key);
+
+        if (found != cache.end())
+        {
+            AgentCacheEntry& entry = found->second;
+            const auto       now   = std::chrono::steady_clock::now();
+            entry.is_fetching      = false;
+
+            if (result.is_loaded)
+            {
+                bool is_changed = (result.contents.Size() != entry.contents.Size()) ||
+                                  (memcmp(result.contents.Data(), entry.contents.Data(), result.contents.Size()) != 0);
+
+                entry.contents     = result.contents;
+                entry.fetched_at   = now;
+                entry.next_refresh = now + std::chrono::seconds(options.refresh_interval_s);
+
+                for (const auto& waiter : entry.waiters)
+                {
+                    SendFrame(waiter.first, kAgentMessageJson, waiter.second, entry.contents);
+                }
+
+                if (is_changed)
+                {
+                    for (const auto& subscriber : entry.subscribers)
+                    {
+                        SendFrame(subscriber.first, kAgentMessageChanged, subscriber.second, SharedBuffer());
+                    }
+                }
+            }
+            else
+            {
+                const SharedBuffer error_message(std::make_shared<const std::string>(result.error_message));
+
+                for (const auto& waiter : entry.waiters)
+                {
+                    SendFrame(waiter.first, kAgentMessageError, waiter.second, error_message);
+                }
+
+                entry.next_refresh = now + std::chrono::seconds(std::min(options.refresh_interval_s, kAgentRetryIntervalS));
+            }
+
+            entry.waiters.clear();
+
+            // Send the answers right away rather than after the next poll.
+            for (auto& client : clients)
+            {
+                if (!client.second.output.empty())
+                {
+                    FlushClient(client.first, client.second);
+                }
+            }
+        }
+    }
+
+    int Agent::Impl::StartDueRefreshes()
+    {
+        const auto now        = std::chrono::steady_clock::now();
+        int        timeout_ms = -1;
+
+        for (auto& entry : cache)
+        {
+            if (entry.second.subscribers.empty() || entry.second.is_fetching)
+            {
+                continue;
+            }
+
+            if (entry.second.next_refresh <= now)
+            {
+                StartFetch(entry.first, entry.second);
+            }
+            else
+            {
+                long long wait_ms = std::chrono::duration_cast<std::chrono::milliseconds>(entry.second.next_refresh - now).count() + 1;
+
+                if (timeout_ms < 0 || wait_ms < timeout_ms)
+                {
+                    timeout_ms = static_cast<int>(std::min<long long>(wait_ms, 0x7fffffff));
+                }
+            }
+        }
+
+        return timeout_ms;
+    }
+
+    Agent::Agent(const AgentOptions& options)
+        : impl_(new Impl(options))
+    {
+    }
+
+    Agent::~Agent()
+    {
+        Stop();
+    }
+
+    bool Agent::Start(std::string& error_message)
+    {
+        Stop();
+
+        impl_->socket_path = impl_->options.socket_path.empty() ? GetAgentSocketPath() : impl_->options.socket_path;
+        impl_->is_stopping = false;
+
+        bool               is_started = false;
+        struct sockaddr_un address;
+        int                running_agent = ConnectToAgent(impl_->socket_path);
+
+        if (running_agent >= 0)
+        {
+            close(running_agent);
+            error_message.append(kStringErrorAgentAlreadyRunning);
+            error_message.append(impl_->socket_path);
+        }
+        else if (!MakeSocketAddress(impl_->socket_path, address))
+        {
+            error_message.append(kStringErrorFailedToStartAgent);
+            error_message.append(kStringErrorAgentSocketPathTooLong);
+        }
+        else
+        {
+            // A socket that is left over from an agent that exited without removing it cannot be connected to.
+            unlink(impl_->socket_path.c_str());
+
+            impl_->listen_socket = OpenAgentSocket();
+
+            if (impl_->listen_socket < 0 || bind(impl_->listen_socket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0 ||
+                chmod(impl_->socket_path.c_str(), S_IRUSR | S_IWUSR) != 0 || listen(impl_->listen_socket, SOMAXCONN) != 0 || pipe(impl_->wake_pipe) != 0)
+            {
+                error_message.append(kStringErrorFailedToStartAgent);
+                error_message.append(strerror(errno));
+            }
+            else
+            {
+                SetNonBlocking(impl_->listen_socket);
+
+                for (int fd : impl_->wake_pipe)
+                {
+                    SetCloseOnExec(fd);
+                    SetNonBlocking(fd);
+                }
+
+                // Without a watcher, downloads are simply attempted, so failing to start it is not an error.
+                std::string watcher_error_message;
+                Impl*       impl = impl_.get();
+
+                impl_->network_watcher.Start(
+                    [impl]() {
+                        std::lock_guard<std::mutex> lock(impl->mutex);
+                        impl->is_refresh_requested = true;
+                        impl->Wake();
+                    },
+                    watcher_error_message);
+
+                try
+                {
+                    impl_->thread = std::thread(&Impl::Run, impl);
+                    is_started    = true;
+                }
+                catch (std::exception& e)
+                {
+                    error_message.append(kStringErrorFailedToStartAgent);
+                    error_message.append(e.what());
+                }
+            }
+        }
+
+        if (!is_started && impl_->listen_socket >= 0)
+        {
+            Stop();
+        }
+
+        return is_started;
+    }
+
+    void Agent::Stop()
+    {
+        impl_->network_watcher.Stop();
+
+        if (impl_->thread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(impl_->mutex);
+                impl_->is_stopping = true;
+            }
+
+            impl_->Wake();
+            impl_->thread.join();
+        }
+
+#ifdef UPDATECHECKAPI_CURL
+        // Cancel the downloads that are still running. A download may make several transfers one after
+        // the other, like finding a release and then downloading its asset, so keep cancelling until
+        // every download thread has reported its result.
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> lock(impl_->mutex);
+                if (impl_->completed_fetches.size() >= impl_->fetch_threads.size())
+                {
+                    break;
+                }
+            }
+
+            CurlTransport::GetDefault().CancelAllTransfers();
+
+            // The download threads write to the wake pipe when they finish.
+            pollfd  wake_poll_fd = {impl_->wake_pipe[0], POLLIN, 0};
+            char    drained[64];
+            ssize_t received = 0;
+
+            if (poll(&wake_poll_fd, 1, kAgentCancelIntervalMs) > 0)
+            {
+                do
+                {
+                    received = read(impl_->wake_pipe[0], drained, sizeof(drained));
+                } while (received > 0 || (received < 0 && errno == EINTR));
+            }
+        }
+#else
+        // Downloads that launch rtda cannot be cancelled, so wait for them to finish.
+#endif
+        for (auto& fetch_thread : impl_->fetch_threads)
+        {
+            fetch_thread.second.join();
+        }
+
+        for (auto& client : impl_->clients)
+        {
+            close(client.first);
+        }
+
+        if (impl_->listen_socket >= 0)
+        {
+            close(impl_->listen_socket);
+            unlink(impl_->socket_path.c_str());
+            impl_->listen_socket = -1;
+        }
+
+        for (int& fd : impl_->wake_pipe)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+                fd = -1;
+            }
+        }
+
+        impl_->fetch_threads.clear();
+        impl_->completed_fetches.clear();
+        impl_->clients.clear();
+        impl_->cache.clear();
+    }
+
+    struct AgentSubscription::Impl
+    {
+        Impl()
+            : agent_socket(-1)
+        {
+            stop_pipe[0] = -1;
+            stop_pipe[1] = -1;
+        }
+
+        /// @brief Wait for the agent to report changes, until the subscription ends.
+        void Run()
+        {
+            for (;;)
+            {
+                struct pollfd poll_fds[2];
+                poll_fds[0].fd     = agent_socket;
+                poll_fds[0].events = POLLIN;
+                poll_fds[1].fd     = stop_pipe[0];
+                poll_fds[1].events = POLLIN;
+
+                if (poll(poll_fds, 2, -1) < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    break;
+                }
+
+                if (poll_fds[1].revents != 0)
+                {
+                    break;
+                }
+
+                uint8_t  type         = 0;
+                uint32_t request_id   = 0;
+                uint32_t payload_size = 0;
+
+                // Notifications have no payload, so a frame that has one is not expected.
+                if (!ReceiveFrameHeader(agent_socket, type, request_id, payload_size,
+                                        std::chrono::steady_clock::now() + std::chrono::milliseconds(kAgentResponseTimeoutMs)) ||
+                    payload_size != 0)
+                {
+                    break;
+                }
+
+                if (type == kAgentMessageChanged && changed_callback)
+                {
+                    changed_callback();
+                }
+            }
+        }
+
+        /// The connection to the agent.
+        int agent_socket;
+
+        /// Written to, to stop the thread.
+        int stop_pipe[2];
+
+        /// The thread that waits for changes.
+        std::thread thread;
+
+        /// The function to call when the file changed.
+        std::function<void()> changed_callback;
+    };
+
+    AgentSubscription::AgentSubscription()
+        : impl_(new Impl())
+    {
+    }
+
+    AgentSubscription::~AgentSubscription()
+    {
+        Stop();
+    }
+
+    bool AgentSubscription::Start(const std::string&           latest_releases_url,
+                                  const std::string&           json_filename,
+                                  const std::function<void()>& changed_callback,
+                                  std::string&                 error_message)
+    {
+        Stop();
+
+        bool is_started     = false;
+        impl_->agent_socket = ConnectToAgent(GetAgentSocketPath());
+
+        if (impl_->agent_socket < 0)
+        {
+            error_message.append(kStringErrorFailedToSubscribeToAgent);
+            error_message.append(kStringErrorAgentNotRunning);
+        }
+        else
+        {
+            try
+            {
+                const std::string request  = MakeRequestFrame(kAgentMessageSubscribe, 1, latest_releases_url, json_filename);
+                const auto        deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(kAgentResponseTimeoutMs);
+
+                uint8_t  type         = 0;
+                uint32_t request_id   = 0;
+                uint32_t payload_size = 0;
+
+                if (!SendAll(impl_->agent_socket, request.data(), request.size()) ||
+                    !ReceiveFrameHeader(impl_->agent_socket, type, request_id, payload_size, deadline) || type != kAgentMessageSubscribed)
+                {
+                    error_message.append(kStringErrorFailedToSubscribeToAgent);
+                    error_message.append(kStringErrorAgentDidNotAnswer);
+                }
+                else if (pipe(impl_->stop_pipe) != 0)
+                {
+                    error_message.append(kStringErrorFailedToSubscribeToAgent);
+                    error_message.append(strerror(errno));
+                }
+                else
+                {
+                    SetCloseOnExec(impl_->stop_pipe[0]);
+                    SetCloseOnExec(impl_->stop_pipe[1]);
+
+                    impl_->changed_callback = changed_callback;
+                    impl_->thread           = std::thread(&Impl::Run, impl_.get());
+                    is_started              = true;
+                }
+            }
+            catch (std::exception& e)
+            {
+                error_message.append(kStringErrorFailedToSubscribeToAgent);
+                error_message.append(e.what());
+            }
+        }
+
+        if (!is_started)
+        {
+            Stop();
+        }
+
+        return is_started;
+    }
+
+    void AgentSubscription::Stop()
+    {
+        if (impl_->thread.joinable())
+        {
+            const char stop = 0;
+
+            while (write(impl_->stop_pipe[1], &stop, sizeof(stop)) < 0 && errno == EINTR)
+            {
+            }
+
+            impl_->thread.join();
+        }
+
+        for (int* fd : {&impl_->agent_socket, &impl_->stop_pipe[0], &impl_->stop_pipe[1]})
+        {
+            if (*fd >= 0)
+            {
+                close(*fd);
+                *fd = -1;
+            }
+        }
+
+        impl_->changed_callback = nullptr;
+    }
+#else
+    std::string GetAgentSocketPath()
+    {
+        return std::string();
+    }
+
+    bool RequestJsonFromAgent(const std::string&                 latest_releases_url,
+                              const std::string&                 json_filename,
+                              UpdateCheckApiUtils::SharedBuffer& json_buffer,
+                              bool&                              is_loaded,
+                              std::string&                       error_message)
+    {
+        (void)latest_releases_url;
+        (void)json_filename;
+        (void)json_buffer;
+        (void)error_message;
+        is_loaded = false;
+        return false;
+    }
+
+    struct Agent::Impl
+    {
+    };
+
+    Agent::Agent(const AgentOptions& options)
+        : impl_(new Impl())
+    {
+        (void)options;
+    }
+
+    Agent::~Agent()
+    {
+    }
+
+    bool Agent::Start(std::string& error_message)
+    {
+        error_message.append(kStringErrorAgentNotSupported);
+        return false;
+    }
+
+    void Agent::Stop()
+    {
+    }
+
+    struct AgentSubscription::Impl
+    {
+    };
+
+    AgentSubscription::AgentSubscription()
+        : impl_(new Impl())
+    {
+    }
+
+    AgentSubscription::~AgentSubscription()
+    {
+    }
+
+    bool AgentSubscription::Start(const std::string&           latest_releases_url,
+                                  const std::string&           json_filename,
+                                  const std::function<void()>& changed_callback,
+                                  std::string&                 error_message)
+    {
+        (void)latest_releases_url;
+        (void)json_filename;
+        (void)changed_callback;
+        error_message.append(kStringErrorAgentNotSupported);
+        return false;
+    }
+
+    void AgentSubscription::Stop()
+    {
+    }
+#endif  // !_WIN32
+}  // namespace UpdateCheck
@@ -0,0 +1,167 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A per-user agent that checks for updates on behalf of all local tools.
+///
+/// Without the agent, every tool downloads its JSON file itself, each time it
+/// starts. The agent owns the downloads for all tools of a user: it keeps the
+/// downloaded files in memory, refreshes the ones that tools subscribed to, and
+/// serves them over a Unix domain socket. While the socket exists,
+/// CheckForUpdates() asks the agent for remote files, so that a check costs one
+/// round trip to a local process; if no agent answers, it downloads the file
+/// itself as before. Parsing, and comparing against the product version, stay
+/// in the tool.
+///
+/// Each message of the protocol is a frame with a 9-byte header, all integers
+/// little-endian:
+///     uint32 payload size, uint8 message type, uint32 request id, payload.
+/// Requests carry the latest releases URL and the JSON filename, each as a
+/// uint32 length followed by the bytes. The agent answers a check with the
+/// contents of the file or an error message as the payload, and later sends an
+/// empty "changed" frame with the id of a subscription whenever a refresh
+/// finds that the file changed.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_AGENT_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_AGENT_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "update_check_api_shared_buffer.h"
+
+namespace UpdateCheck
+{
+    /// @brief Options for the update check agent.
+    struct AgentOptions
+    {
+        /// @brief Constructor that sets the default values.
+        AgentOptions();
+
+        /// The path of the socket to listen on. Empty for GetAgentSocketPath(), which is where clients look for it.
+        std::string socket_path;
+
+        /// How long a downloaded file answers checks, in seconds; after that, the next check downloads it again. Default 900.
+        long cache_timeout_s;
+
+        /// How often the files that tools subscribed to are downloaded again, in seconds. Default 21600.
+        /// Files are also downloaded again as soon as the network becomes reachable after it was not.
+        long refresh_interval_s;
+    };
+
+    /// @brief Get the path of the agent's socket for the current user.
+    ///
+    /// This is in the per-user runtime directory when there is one, and in the
+    /// temporary directory, with the user id in its name, otherwise.
+    ///
+    /// @return The path, or an empty string on platforms without an agent.
+    std::string GetAgentSocketPath();
+
+    /// @brief The update check agent, which downloads JSON files on behalf of the tools of a user.
+    ///
+    /// One thread serves all clients, and each download runs on a thread of
+    /// its own, so that a slow server does not hold up checks for other files.
+    /// Concurrent checks for the same file share one download. Only processes
+    /// of the same user are served.
+    class Agent
+    {
+    public:
+        /// @brief Constructor.
+        ///
+        /// @param [in] options The options of the agent.
+        explicit Agent(const AgentOptions& options = AgentOptions());
+
+        /// @brief Destructor. Stops the agent.
+        ~Agent();
+
+        /// @brief Listen on the socket, and start serving clients on a thread.
+        ///
+        /// @param [out] error_message Any error messages that occurred.
+        ///
+        /// @return true if the agent started; false if another agent is running or the socket could not be created.
+        bool Start(std::string& error_message);
+
+        /// @brief Stop serving clients, end running downloads, and remove the socket.
+        ///
+        /// Downloads over libcurl are cancelled. Downloads that launch rtda cannot be, so they are waited for.
+        void Stop();
+
+    private:
+        Agent(const Agent&)            = delete;
+        Agent& operator=(const Agent&) = delete;
+
+        struct Impl;
+
+        /// The socket, cache and threads of the agent.
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /// @brief Ask the agent of the current user for the JSON file of a remote check.
+    ///
+    /// @param [in]  latest_releases_url The latest releases url.
+    /// @param [in]  json_filename       The json file name.
+    /// @param [out] json_buffer         The contents of the JSON file, which the agent validated as UTF-8.
+    /// @param [out] is_loaded           true if the agent provided the file; false if it reported an error.
+    /// @param [out] error_message       The error that the agent reported.
+    ///
+    /// @return true if an agent answered; false if none is running, in which case the caller should load the file itself.
+    bool RequestJsonFromAgent(const std::string&                 latest_releases_url,
+                              const std::string&                 json_filename,
+                              UpdateCheckApiUtils::SharedBuffer& json_buffer,
+                              bool&                              is_loaded,
+                              std::string&                       error_message);
+
+    /// @brief A subscription to changes of a JSON file that the agent refreshes.
+    class AgentSubscription
+    {
+    public:
+        /// @brief Constructor.
+        AgentSubscription();
+
+        /// @brief Destructor. Ends the subscription.
+        ~AgentSubscription();
+
+        /// @brief Subscribe to changes of the JSON file of a check.
+        ///
+        /// The subscription ends when the agent exits; Start() it again to resubscribe.
+        ///
+        /// @param [in]  latest_releases_url The latest releases url.
+        /// @param [in]  json_filename       The json file name.
+        /// @param [in]  changed_callback    The function to call when the file changed. It is called on the thread of the
+        ///                                  subscription; calling CheckForUpdates() then gets the new file from the agent.
+        /// @param [out] error_message       Any error messages that occurred.
+        ///
+        /// @return true if the agent accepted the subscription; false otherwise.
+        bool Start(const std::string& latest_releases_url, const std::string& json_filename, const std::function<void()>& changed_callback, std::string& error_message);
+
+        /// @brief End the subscription. This must not be called from the changed_callback.
+        void Stop();
+
+    private:
+        AgentSubscription(const AgentSubscription&)            = delete;
+        AgentSubscription& operator=(const AgentSubscription&) = delete;
+
+        struct Impl;
+
+        /// The connection to the agent and the thread that waits for changes.
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /// @brief Load the JSON file of a remote check directly, without asking the agent.
+    ///
+    /// This is what the agent does for its clients. It is defined in update_check_api.cpp.
+    ///
+    /// @param [in]  latest_releases_url The latest releases url.
+    /// @param [in]  json_filename       The json file name.
+    /// @param [out] json_buffer         The contents of the JSON file.
+    /// @param [out] error_message       Any error messages that occurred.
+    ///
+    /// @return true if the file was loaded; false otherwise.
+    bool LoadRemoteJson(const std::string&                 latest_releases_url,
+                        const std::string&                 json_filename,
+                        UpdateCheckApiUtils::SharedBuffer& json_buffer,
+                        std::string&                       error_message);
+}  // namespace UpdateCheck
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_AGENT_H_
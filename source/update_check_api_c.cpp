@@ -0,0 +1,561 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A C interface to the UpdateCheckAPI.
+//==============================================================================
+#include "update_check_api_c.h"
+#include "update_check_api.h"
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string>
+
+// The C constants are the values of the C++ enums, so that they can be converted with a cast.
+static_assert(UPDATECHECK_PLATFORM_UNKNOWN == static_cast<int32_t>(UpdateCheck::TargetPlatform::kUnknown), "Platform values differ.");
+static_assert(UPDATECHECK_PLATFORM_WINDOWS == static_cast<int32_t>(UpdateCheck::TargetPlatform::kWindows), "Platform values differ.");
+static_assert(UPDATECHECK_PLATFORM_UBUNTU == static_cast<int32_t>(UpdateCheck::TargetPlatform::kUbuntu), "Platform values differ.");
+static_assert(UPDATECHECK_PLATFORM_RHEL == static_cast<int32_t>(UpdateCheck::TargetPlatform::kRhel), "Platform values differ.");
+static_assert(UPDATECHECK_PLATFORM_DARWIN == static_cast<int32_t>(UpdateCheck::TargetPlatform::kDarwin), "Platform values differ.");
+static_assert(UPDATECHECK_PACKAGE_UNKNOWN == static_cast<int32_t>(UpdateCheck::PackageType::kUnknown), "Package type values differ.");
+static_assert(UPDATECHECK_PACKAGE_ZIP == static_cast<int32_t>(UpdateCheck::PackageType::kZip), "Package type values differ.");
+static_assert(UPDATECHECK_PACKAGE_MSI == static_cast<int32_t>(UpdateCheck::PackageType::kMsi), "Package type values differ.");
+static_assert(UPDATECHECK_PACKAGE_TAR == static_cast<int32_t>(UpdateCheck::PackageType::kTar), "Package type values differ.");
+static_assert(UPDATECHECK_PACKAGE_RPM == static_cast<int32_t>(UpdateCheck::PackageType::kRpm), "Package type values differ.");
+static_assert(UPDATECHECK_PACKAGE_DEBIAN == static_cast<int32_t>(UpdateCheck::PackageType::kDebian), "Package type values differ.");
+static_assert(UPDATECHECK_RELEASE_UNKNOWN == static_cast<int32_t>(UpdateCheck::ReleaseType::kUnknown), "Release type values differ.");
+static_assert(UPDATECHECK_RELEASE_GENERAL_AVAILABILITY == static_cast<int32_t>(UpdateCheck::ReleaseType::kGeneralAvailability), "Release type values differ.");
+static_assert(UPDATECHECK_RELEASE_BETA == static_cast<int32_t>(UpdateCheck::ReleaseType::kBeta), "Release type values differ.");
+static_assert(UPDATECHECK_RELEASE_ALPHA == static_cast<int32_t>(UpdateCheck::ReleaseType::kAlpha), "Release type values differ.");
+static_assert(UPDATECHECK_RELEASE_PATCH == static_cast<int32_t>(UpdateCheck::ReleaseType::kPatch), "Release type values differ.");
+static_assert(UPDATECHECK_RELEASE_DEVELOPMENT == static_cast<int32_t>(UpdateCheck::ReleaseType::kDevelopment), "Release type values differ.");
+
+/// @brief The state behind an UpdateCheckChecker handle.
+struct UpdateCheckChecker
+{
+    /// The result of the last check; reused by the next one.
+    UpdateCheck::UpdateInfo update_info;
+
+    /// The error messages of the last check.
+    std::string error_message;
+
+    /// True if the last check succeeded, so that update_info holds its result.
+    bool has_result;
+};
+
+/// @brief Copy a string into a caller's buffer, truncating it if necessary.
+///
+/// @param [in]  text          The string.
+/// @param [out] buffer        The buffer; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL or UPDATECHECK_STATUS_INVALID_ARGUMENT.
+static UpdateCheckStatus CopyString(const std::string& text, char* buffer, size_t buffer_size, size_t* required_size)
+{
+    if (buffer == nullptr && buffer_size > 0)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (required_size != nullptr)
+    {
+        *required_size = text.size() + 1;
+    }
+
+    if (buffer_size == 0)
+    {
+        return (required_size != nullptr) ? UPDATECHECK_STATUS_OK : UPDATECHECK_STATUS_BUFFER_TOO_SMALL;
+    }
+
+    size_t copy_size = text.size();
+    if (copy_size >= buffer_size)
+    {
+        copy_size = buffer_size - 1;
+    }
+
+    memcpy(buffer, text.data(), copy_size);
+    buffer[copy_size] = '\0';
+
+    return (copy_size == text.size()) ? UPDATECHECK_STATUS_OK : UPDATECHECK_STATUS_BUFFER_TOO_SMALL;
+}
+
+/// @brief Look up a release of the checker's result.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] release_info  The release.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_INVALID_ARGUMENT, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+static UpdateCheckStatus GetRelease(const UpdateCheckChecker* checker, size_t release_index, const UpdateCheck::ReleaseInfo*& release_info)
+{
+    if (checker == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!checker->has_result)
+    {
+        return UPDATECHECK_STATUS_NO_RESULT;
+    }
+
+    if (release_index >= checker->update_info.releases.size())
+    {
+        return UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE;
+    }
+
+    release_info = &checker->update_info.releases[release_index];
+    return UPDATECHECK_STATUS_OK;
+}
+
+/// @brief Look up an element of one of the lists of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [in]  list          The member of ReleaseInfo that holds the list.
+/// @param [in]  element_index The index of the element.
+/// @param [out] element       The element.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_INVALID_ARGUMENT, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+template <typename List>
+static UpdateCheckStatus GetReleaseElement(const UpdateCheckChecker*         checker,
+                                           size_t                            release_index,
+                                           List UpdateCheck::ReleaseInfo::*list,
+                                           size_t                            element_index,
+                                           const typename List::value_type*& element)
+{
+    const UpdateCheck::ReleaseInfo* release_info = nullptr;
+    UpdateCheckStatus               status       = GetRelease(checker, release_index, release_info);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        const List& elements = release_info->*list;
+        if (element_index < elements.size())
+        {
+            element = &elements[element_index];
+        }
+        else
+        {
+            status = UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE;
+        }
+    }
+
+    return status;
+}
+
+/// @brief Get the number of elements in one of the lists of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [in]  list          The member of ReleaseInfo that holds the list.
+/// @param [out] count         The number of elements.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_INVALID_ARGUMENT, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+template <typename List>
+static UpdateCheckStatus GetReleaseListSize(const UpdateCheckChecker* checker, size_t release_index, List UpdateCheck::ReleaseInfo::*list, size_t* count)
+{
+    if (count == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    const UpdateCheck::ReleaseInfo* release_info = nullptr;
+    UpdateCheckStatus               status       = GetRelease(checker, release_index, release_info);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        *count = (release_info->*list).size();
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetAbiInfo(UpdateCheckAbiInfo* abi_info)
+{
+    if (abi_info == nullptr || abi_info->struct_size < offsetof(UpdateCheckAbiInfo, api_version))
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    abi_info->abi_version = UPDATECHECKAPI_C_ABI_VERSION;
+
+    if (abi_info->struct_size >= offsetof(UpdateCheckAbiInfo, api_version) + sizeof(UpdateCheckVersion))
+    {
+        abi_info->api_version.major = UPDATECHECKAPI_MAJOR;
+        abi_info->api_version.minor = UPDATECHECKAPI_MINOR;
+        abi_info->api_version.patch = UPDATECHECKAPI_PATCH;
+        abi_info->api_version.build = UPDATECHECKAPI_BUILD;
+    }
+
+    return UPDATECHECK_STATUS_OK;
+}
+
+UpdateCheckStatus UpdateCheckCreateChecker(UpdateCheckChecker** checker)
+{
+    if (checker == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    *checker = new (std::nothrow) UpdateCheckChecker();
+    if (*checker == nullptr)
+    {
+        return UPDATECHECK_STATUS_OUT_OF_MEMORY;
+    }
+
+    (*checker)->update_info.is_update_available = false;
+    (*checker)->has_result                      = false;
+
+    return UPDATECHECK_STATUS_OK;
+}
+
+void UpdateCheckDestroyChecker(UpdateCheckChecker* checker)
+{
+    delete checker;
+}
+
+UpdateCheckStatus UpdateCheckCheckForUpdates(UpdateCheckChecker*       checker,
+                                             const UpdateCheckVersion* current_product_version,
+                                             const char*               latest_release_url,
+                                             const char*               json_filename)
+{
+    if (checker == nullptr || current_product_version == nullptr || latest_release_url == nullptr || json_filename == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    UpdateCheck::VersionInfo product_version;
+    product_version.major = current_product_version->major;
+    product_version.minor = current_product_version->minor;
+    product_version.patch = current_product_version->patch;
+    product_version.build = current_product_version->build;
+
+    checker->has_result = false;
+    checker->error_message.clear();
+
+    // No exception may reach the caller, who may not even be written in C++.
+    UpdateCheckStatus status = UPDATECHECK_STATUS_CHECK_FAILED;
+    try
+    {
+        if (UpdateCheck::CheckForUpdates(product_version, latest_release_url, json_filename, checker->update_info, checker->error_message))
+        {
+            checker->has_result = true;
+            status              = UPDATECHECK_STATUS_OK;
+        }
+    }
+    catch (const std::bad_alloc&)
+    {
+        status = UPDATECHECK_STATUS_OUT_OF_MEMORY;
+    }
+    catch (...)
+    {
+        status = UPDATECHECK_STATUS_CHECK_FAILED;
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetErrorMessage(const UpdateCheckChecker* checker, char* buffer, size_t buffer_size, size_t* required_size)
+{
+    if (checker == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    return CopyString(checker->error_message, buffer, buffer_size, required_size);
+}
+
+UpdateCheckStatus UpdateCheckIsUpdateAvailable(const UpdateCheckChecker* checker, int32_t* is_update_available)
+{
+    if (checker == nullptr || is_update_available == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!checker->has_result)
+    {
+        return UPDATECHECK_STATUS_NO_RESULT;
+    }
+
+    *is_update_available = checker->update_info.is_update_available ? 1 : 0;
+    return UPDATECHECK_STATUS_OK;
+}
+
+UpdateCheckStatus UpdateCheckGetReleaseCount(const UpdateCheckChecker* checker, size_t* release_count)
+{
+    if (checker == nullptr || release_count == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!checker->has_result)
+    {
+        return UPDATECHECK_STATUS_NO_RESULT;
+    }
+
+    *release_count = checker->update_info.releases.size();
+    return UPDATECHECK_STATUS_OK;
+}
+
+UpdateCheckStatus UpdateCheckGetReleaseVersion(const UpdateCheckChecker* checker, size_t release_index, UpdateCheckVersion* version)
+{
+    if (version == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    const UpdateCheck::ReleaseInfo* release_info = nullptr;
+    UpdateCheckStatus               status       = GetRelease(checker, release_index, release_info);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        version->major = release_info->version.major;
+        version->minor = release_info->version.minor;
+        version->patch = release_info->version.patch;
+        version->build = release_info->version.build;
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetReleaseType(const UpdateCheckChecker* checker, size_t release_index, int32_t* release_type)
+{
+    if (release_type == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    const UpdateCheck::ReleaseInfo* release_info = nullptr;
+    UpdateCheckStatus               status       = GetRelease(checker, release_index, release_info);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        *release_type = static_cast<int32_t>(release_info->type);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetReleaseDate(const UpdateCheckChecker* checker, size_t release_index, char* buffer, size_t buffer_size, size_t* required_size)
+{
+    const UpdateCheck::ReleaseInfo* release_info = nullptr;
+    UpdateCheckStatus               status       = GetRelease(checker, release_index, release_info);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        status = CopyString(release_info->date, buffer, buffer_size, required_size);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetReleaseTitle(const UpdateCheckChecker* checker, size_t release_index, char* buffer, size_t buffer_size, size_t* required_size)
+{
+    const UpdateCheck::ReleaseInfo* release_info = nullptr;
+    UpdateCheckStatus               status       = GetRelease(checker, release_index, release_info);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        status = CopyString(release_info->title, buffer, buffer_size, required_size);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetReleaseNotesUrl(const UpdateCheckChecker* checker,
+                                                size_t                    release_index,
+                                                char*                     buffer,
+                                                size_t                    buffer_size,
+                                                size_t*                   required_size)
+{
+    const UpdateCheck::ReleaseInfo* release_info = nullptr;
+    UpdateCheckStatus               status       = GetRelease(checker, release_index, release_info);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        status = CopyString(release_info->release_notes_url, buffer, buffer_size, required_size);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckFetchReleaseNotes(UpdateCheckChecker* checker, size_t release_index, char* buffer, size_t buffer_size, size_t* required_size)
+{
+    const UpdateCheck::ReleaseInfo* release_info = nullptr;
+    UpdateCheckStatus               status       = GetRelease(checker, release_index, release_info);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        checker->error_message.clear();
+
+        try
+        {
+            std::string release_notes;
+            if (UpdateCheck::FetchReleaseNotes(release_info->release_notes_url, release_notes, checker->error_message))
+            {
+                status = CopyString(release_notes, buffer, buffer_size, required_size);
+            }
+            else
+            {
+                status = UPDATECHECK_STATUS_CHECK_FAILED;
+            }
+        }
+        catch (const std::bad_alloc&)
+        {
+            status = UPDATECHECK_STATUS_OUT_OF_MEMORY;
+        }
+        catch (...)
+        {
+            status = UPDATECHECK_STATUS_CHECK_FAILED;
+        }
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetReleasePlatformCount(const UpdateCheckChecker* checker, size_t release_index, size_t* platform_count)
+{
+    return GetReleaseListSize(checker, release_index, &UpdateCheck::ReleaseInfo::target_platforms, platform_count);
+}
+
+UpdateCheckStatus UpdateCheckGetReleasePlatform(const UpdateCheckChecker* checker, size_t release_index, size_t platform_index, int32_t* platform)
+{
+    if (platform == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    const UpdateCheck::TargetPlatform* target_platform = nullptr;
+    UpdateCheckStatus status = GetReleaseElement(checker, release_index, &UpdateCheck::ReleaseInfo::target_platforms, platform_index, target_platform);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        *platform = static_cast<int32_t>(*target_platform);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetReleaseTagCount(const UpdateCheckChecker* checker, size_t release_index, size_t* tag_count)
+{
+    return GetReleaseListSize(checker, release_index, &UpdateCheck::ReleaseInfo::tags, tag_count);
+}
+
+UpdateCheckStatus UpdateCheckGetReleaseTag(const UpdateCheckChecker* checker,
+                                           size_t                    release_index,
+                                           size_t                    tag_index,
+                                           char*                     buffer,
+                                           size_t                    buffer_size,
+                                           size_t*                   required_size)
+{
+    const std::string* tag    = nullptr;
+    UpdateCheckStatus  status = GetReleaseElement(checker, release_index, &UpdateCheck::ReleaseInfo::tags, tag_index, tag);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        status = CopyString(*tag, buffer, buffer_size, required_size);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetDownloadLinkCount(const UpdateCheckChecker* checker, size_t release_index, size_t* link_count)
+{
+    return GetReleaseListSize(checker, release_index, &UpdateCheck::ReleaseInfo::download_links, link_count);
+}
+
+UpdateCheckStatus UpdateCheckGetDownloadLinkUrl(const UpdateCheckChecker* checker,
+                                                size_t                    release_index,
+                                                size_t                    link_index,
+                                                char*                     buffer,
+                                                size_t                    buffer_size,
+                                                size_t*                   required_size)
+{
+    const UpdateCheck::DownloadLink* download_link = nullptr;
+    UpdateCheckStatus status = GetReleaseElement(checker, release_index, &UpdateCheck::ReleaseInfo::download_links, link_index, download_link);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        status = CopyString(download_link->url, buffer, buffer_size, required_size);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetDownloadLinkPackageType(const UpdateCheckChecker* checker, size_t release_index, size_t link_index, int32_t* package_type)
+{
+    if (package_type == nullptr)
+    {
+        return UPDATECHECK_STATUS_INVALID_ARGUMENT;
+    }
+
+    const UpdateCheck::DownloadLink* download_link = nullptr;
+    UpdateCheckStatus status = GetReleaseElement(checker, release_index, &UpdateCheck::ReleaseInfo::download_links, link_index, download_link);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        *package_type = static_cast<int32_t>(download_link->package_type);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetDownloadLinkPackageName(const UpdateCheckChecker* checker,
+                                                        size_t                    release_index,
+                                                        size_t                    link_index,
+                                                        char*                     buffer,
+                                                        size_t                    buffer_size,
+                                                        size_t*                   required_size)
+{
+    const UpdateCheck::DownloadLink* download_link = nullptr;
+    UpdateCheckStatus status = GetReleaseElement(checker, release_index, &UpdateCheck::ReleaseInfo::download_links, link_index, download_link);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        status = CopyString(download_link->package_name, buffer, buffer_size, required_size);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetInfoLinkCount(const UpdateCheckChecker* checker, size_t release_index, size_t* link_count)
+{
+    return GetReleaseListSize(checker, release_index, &UpdateCheck::ReleaseInfo::info_links, link_count);
+}
+
+UpdateCheckStatus UpdateCheckGetInfoLinkUrl(const UpdateCheckChecker* checker,
+                                            size_t                    release_index,
+                                            size_t                    link_index,
+                                            char*                     buffer,
+                                            size_t                    buffer_size,
+                                            size_t*                   required_size)
+{
+    const UpdateCheck::InfoPageLink* info_link = nullptr;
+    UpdateCheckStatus status = GetReleaseElement(checker, release_index, &UpdateCheck::ReleaseInfo::info_links, link_index, info_link);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        status = CopyString(info_link->url, buffer, buffer_size, required_size);
+    }
+
+    return status;
+}
+
+UpdateCheckStatus UpdateCheckGetInfoLinkDescription(const UpdateCheckChecker* checker,
+                                                    size_t                    release_index,
+                                                    size_t                    link_index,
+                                                    char*                     buffer,
+                                                    size_t                    buffer_size,
+                                                    size_t*                   required_size)
+{
+    const UpdateCheck::InfoPageLink* info_link = nullptr;
+    UpdateCheckStatus status = GetReleaseElement(checker, release_index, &UpdateCheck::ReleaseInfo::info_links, link_index, info_link);
+
+    if (status == UPDATECHECK_STATUS_OK)
+    {
+        status = CopyString(info_link->page_description, buffer, buffer_size, required_size);
+    }
+
+    return status;
+}
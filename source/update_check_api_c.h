@@ -0,0 +1,417 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A C interface to the UpdateCheckAPI.
+///
+/// This interface can be used from C, and from C++ code that is built with a
+/// different compiler or runtime library than the UpdateCheckAPI, since no
+/// C++ types cross it. A checker is an opaque handle that owns the result of
+/// the last check. The result is read through accessor functions: numbers are
+/// returned through pointers, and strings are copied into buffers that are
+/// provided by the caller. Reading a result does not allocate any memory.
+///
+/// A checker may be used by one thread at a time. Different checkers may be
+/// used concurrently.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_C_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_C_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Projects that build the UpdateCheckAPI into a shared library can define this to export the functions.
+#ifndef UPDATECHECKAPI_C_EXPORT
+#define UPDATECHECKAPI_C_EXPORT
+#endif
+
+// The version of the C interface. It is only increased when existing functions or structures change incompatibly.
+#define UPDATECHECKAPI_C_ABI_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// An opaque handle to a checker.
+typedef struct UpdateCheckChecker UpdateCheckChecker;
+
+/// The result of a function of the C interface.
+typedef int32_t UpdateCheckStatus;
+
+/// The function succeeded.
+#define UPDATECHECK_STATUS_OK 0
+
+/// An argument was null or otherwise invalid.
+#define UPDATECHECK_STATUS_INVALID_ARGUMENT 1
+
+/// A string did not fit into the caller's buffer; it was truncated, and the required size was returned.
+#define UPDATECHECK_STATUS_BUFFER_TOO_SMALL 2
+
+/// An index was not less than the corresponding count.
+#define UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE 3
+
+/// The checker does not hold a result, because no check has succeeded yet.
+#define UPDATECHECK_STATUS_NO_RESULT 4
+
+/// The check for updates failed; UpdateCheckGetErrorMessage() describes why.
+#define UPDATECHECK_STATUS_CHECK_FAILED 5
+
+/// Memory could not be allocated.
+#define UPDATECHECK_STATUS_OUT_OF_MEMORY 6
+
+// The values of UpdateCheck::TargetPlatform.
+#define UPDATECHECK_PLATFORM_UNKNOWN 0
+#define UPDATECHECK_PLATFORM_WINDOWS 1
+#define UPDATECHECK_PLATFORM_UBUNTU 2
+#define UPDATECHECK_PLATFORM_RHEL 3
+#define UPDATECHECK_PLATFORM_DARWIN 4
+
+// The values of UpdateCheck::PackageType.
+#define UPDATECHECK_PACKAGE_UNKNOWN 0
+#define UPDATECHECK_PACKAGE_ZIP 1
+#define UPDATECHECK_PACKAGE_MSI 2
+#define UPDATECHECK_PACKAGE_TAR 3
+#define UPDATECHECK_PACKAGE_RPM 4
+#define UPDATECHECK_PACKAGE_DEBIAN 5
+
+// The values of UpdateCheck::ReleaseType.
+#define UPDATECHECK_RELEASE_UNKNOWN 0
+#define UPDATECHECK_RELEASE_GENERAL_AVAILABILITY 1
+#define UPDATECHECK_RELEASE_BETA 2
+#define UPDATECHECK_RELEASE_ALPHA 3
+#define UPDATECHECK_RELEASE_PATCH 4
+#define UPDATECHECK_RELEASE_DEVELOPMENT 5
+
+/// @brief A version of the format Major.Minor.Patch.Build.
+typedef struct UpdateCheckVersion
+{
+    uint32_t major;
+    uint32_t minor;
+    uint32_t patch;
+    uint32_t build;
+} UpdateCheckVersion;
+
+/// @brief Version information of the library.
+///
+/// The caller sets struct_size to sizeof(UpdateCheckAbiInfo) before calling
+/// UpdateCheckGetAbiInfo(). Fields are only ever added to the end of the
+/// structure, and the library only fills in the fields that fit into
+/// struct_size, so callers that were built against an older header keep
+/// working with a newer library.
+typedef struct UpdateCheckAbiInfo
+{
+    /// The size of the structure in bytes, as set by the caller.
+    uint32_t struct_size;
+
+    /// The UPDATECHECKAPI_C_ABI_VERSION of the library.
+    uint32_t abi_version;
+
+    /// The version of the UpdateCheckAPI.
+    UpdateCheckVersion api_version;
+} UpdateCheckAbiInfo;
+
+/// @brief Get version information of the library.
+///
+/// @param [in,out] abi_info The version information; struct_size must be set by the caller.
+///
+/// @return UPDATECHECK_STATUS_OK, or UPDATECHECK_STATUS_INVALID_ARGUMENT if struct_size is too small for the first two fields.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetAbiInfo(UpdateCheckAbiInfo* abi_info);
+
+/// @brief Create a checker.
+///
+/// @param [out] checker The new checker; must be destroyed with UpdateCheckDestroyChecker().
+///
+/// @return UPDATECHECK_STATUS_OK on success.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckCreateChecker(UpdateCheckChecker** checker);
+
+/// @brief Destroy a checker and its result.
+///
+/// @param [in] checker The checker; may be null.
+UPDATECHECKAPI_C_EXPORT void UpdateCheckDestroyChecker(UpdateCheckChecker* checker);
+
+/// @brief Check for updates, replacing the checker's previous result.
+///
+/// The memory of the previous result is reused, so checking the same version
+/// file periodically with one checker allocates little memory.
+///
+/// @param [in] checker                 The checker.
+/// @param [in] current_product_version The current product version.
+/// @param [in] latest_release_url      The latest releases url, as a null-terminated UTF-8 string.
+/// @param [in] json_filename           The json file name, as a null-terminated UTF-8 string.
+///
+/// @return UPDATECHECK_STATUS_OK on success, or UPDATECHECK_STATUS_CHECK_FAILED.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckCheckForUpdates(UpdateCheckChecker*       checker,
+                                                                     const UpdateCheckVersion* current_product_version,
+                                                                     const char*               latest_release_url,
+                                                                     const char*               json_filename);
+
+/// @brief Get the error messages of the last check.
+///
+/// Strings are always null-terminated. If the buffer is too small, the string
+/// is truncated to fit. required_size receives the size of the buffer needed
+/// for the entire string, including the terminator; the buffer may be null to
+/// only query the size. The same applies to all functions that return strings.
+///
+/// @param [in]  checker       The checker.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, or UPDATECHECK_STATUS_BUFFER_TOO_SMALL.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetErrorMessage(const UpdateCheckChecker* checker,
+                                                                     char*                     buffer,
+                                                                     size_t                    buffer_size,
+                                                                     size_t*                   required_size);
+
+/// @brief Check whether the last check found an update to a newer version.
+///
+/// @param [in]  checker             The checker.
+/// @param [out] is_update_available 1 if an update is available, 0 otherwise.
+///
+/// @return UPDATECHECK_STATUS_OK, or UPDATECHECK_STATUS_NO_RESULT.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckIsUpdateAvailable(const UpdateCheckChecker* checker, int32_t* is_update_available);
+
+/// @brief Get the number of releases found by the last check.
+///
+/// @param [in]  checker       The checker.
+/// @param [out] release_count The number of releases.
+///
+/// @return UPDATECHECK_STATUS_OK, or UPDATECHECK_STATUS_NO_RESULT.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleaseCount(const UpdateCheckChecker* checker, size_t* release_count);
+
+/// @brief Get the version of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] version       The version.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleaseVersion(const UpdateCheckChecker* checker, size_t release_index, UpdateCheckVersion* version);
+
+/// @brief Get the type of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] release_type  One of the UPDATECHECK_RELEASE_ values.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleaseType(const UpdateCheckChecker* checker, size_t release_index, int32_t* release_type);
+
+/// @brief Get the release date of a release, in the format YYYY-MM-DD.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleaseDate(const UpdateCheckChecker* checker,
+                                                                    size_t                    release_index,
+                                                                    char*                     buffer,
+                                                                    size_t                    buffer_size,
+                                                                    size_t*                   required_size);
+
+/// @brief Get the title of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleaseTitle(const UpdateCheckChecker* checker,
+                                                                     size_t                    release_index,
+                                                                     char*                     buffer,
+                                                                     size_t                    buffer_size,
+                                                                     size_t*                   required_size);
+
+/// @brief Get the release notes URL of a release, which is empty if the version file does not have one.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleaseNotesUrl(const UpdateCheckChecker* checker,
+                                                                        size_t                    release_index,
+                                                                        char*                     buffer,
+                                                                        size_t                    buffer_size,
+                                                                        size_t*                   required_size);
+
+/// @brief Fetch the release notes of a release.
+///
+/// The release notes are downloaded the first time that they are requested,
+/// which blocks until the download is complete, and are then kept in memory.
+/// Calling this again for the same release, for instance with a larger
+/// buffer, returns immediately. If fetching fails, the checker's error
+/// message describes why.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] buffer        The buffer that receives the release notes; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire release notes in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT, UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE or UPDATECHECK_STATUS_CHECK_FAILED.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckFetchReleaseNotes(UpdateCheckChecker* checker,
+                                                                       size_t              release_index,
+                                                                       char*               buffer,
+                                                                       size_t              buffer_size,
+                                                                       size_t*             required_size);
+
+/// @brief Get the number of target platforms of a release.
+///
+/// @param [in]  checker        The checker.
+/// @param [in]  release_index  The index of the release.
+/// @param [out] platform_count The number of target platforms.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleasePlatformCount(const UpdateCheckChecker* checker, size_t release_index, size_t* platform_count);
+
+/// @brief Get a target platform of a release.
+///
+/// @param [in]  checker        The checker.
+/// @param [in]  release_index  The index of the release.
+/// @param [in]  platform_index The index of the target platform.
+/// @param [out] platform       One of the UPDATECHECK_PLATFORM_ values.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleasePlatform(const UpdateCheckChecker* checker,
+                                                                        size_t                    release_index,
+                                                                        size_t                    platform_index,
+                                                                        int32_t*                  platform);
+
+/// @brief Get the number of tags of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] tag_count     The number of tags.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleaseTagCount(const UpdateCheckChecker* checker, size_t release_index, size_t* tag_count);
+
+/// @brief Get a tag of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [in]  tag_index     The index of the tag.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetReleaseTag(const UpdateCheckChecker* checker,
+                                                                   size_t                    release_index,
+                                                                   size_t                    tag_index,
+                                                                   char*                     buffer,
+                                                                   size_t                    buffer_size,
+                                                                   size_t*                   required_size);
+
+/// @brief Get the number of download links of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] link_count    The number of download links.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetDownloadLinkCount(const UpdateCheckChecker* checker, size_t release_index, size_t* link_count);
+
+/// @brief Get the URL of a download link.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [in]  link_index    The index of the download link.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetDownloadLinkUrl(const UpdateCheckChecker* checker,
+                                                                        size_t                    release_index,
+                                                                        size_t                    link_index,
+                                                                        char*                     buffer,
+                                                                        size_t                    buffer_size,
+                                                                        size_t*                   required_size);
+
+/// @brief Get the package type of a download link.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [in]  link_index    The index of the download link.
+/// @param [out] package_type  One of the UPDATECHECK_PACKAGE_ values.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetDownloadLinkPackageType(const UpdateCheckChecker* checker,
+                                                                                size_t                    release_index,
+                                                                                size_t                    link_index,
+                                                                                int32_t*                  package_type);
+
+/// @brief Get the package name of a download link, which is empty if the version file does not name the package.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [in]  link_index    The index of the download link.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetDownloadLinkPackageName(const UpdateCheckChecker* checker,
+                                                                                size_t                    release_index,
+                                                                                size_t                    link_index,
+                                                                                char*                     buffer,
+                                                                                size_t                    buffer_size,
+                                                                                size_t*                   required_size);
+
+/// @brief Get the number of info page links of a release.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [out] link_count    The number of info page links.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetInfoLinkCount(const UpdateCheckChecker* checker, size_t release_index, size_t* link_count);
+
+/// @brief Get the URL of an info page link.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [in]  link_index    The index of the info page link.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetInfoLinkUrl(const UpdateCheckChecker* checker,
+                                                                    size_t                    release_index,
+                                                                    size_t                    link_index,
+                                                                    char*                     buffer,
+                                                                    size_t                    buffer_size,
+                                                                    size_t*                   required_size);
+
+/// @brief Get the description of an info page link.
+///
+/// @param [in]  checker       The checker.
+/// @param [in]  release_index The index of the release.
+/// @param [in]  link_index    The index of the info page link.
+/// @param [out] buffer        The buffer that receives the string; may be null if buffer_size is 0.
+/// @param [in]  buffer_size   The size of the buffer in bytes.
+/// @param [out] required_size The size of the entire string in bytes, including the terminator; may be null.
+///
+/// @return UPDATECHECK_STATUS_OK, UPDATECHECK_STATUS_BUFFER_TOO_SMALL, UPDATECHECK_STATUS_NO_RESULT or UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE.
+UPDATECHECKAPI_C_EXPORT UpdateCheckStatus UpdateCheckGetInfoLinkDescription(const UpdateCheckChecker* checker,
+                                                                            size_t                    release_index,
+                                                                            size_t                    link_index,
+                                                                            char*                     buffer,
+                                                                            size_t                    buffer_size,
+                                                                            size_t*                   required_size);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_C_H_
@@ -0,0 +1,1617 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief An in-process HTTP/HTTPS transport built on libcurl.
+//==============================================================================
+#include "update_check_api_curl_transport.h"
+#include "update_check_api.h"
+#include "update_check_api_strings.h"
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+namespace UpdateCheck
+{
+#if LIBCURL_VERSION_NUM >= 0x080c00
+    // The first bytes of a TLS session file.
+    static const char kTlsSessionFileMagic[8] = {'U', 'C', 'A', 'T', 'L', 'S', '0', '1'};
+#endif
+
+    // How long before a signed URL expires to stop using it as a redirect target, in seconds, so that a transfer
+    // that starts just before the expiry is not rejected.
+    static const std::time_t kRedirectExpiryMargin = 30;
+
+    // The name of the Link response header, in lower case, followed by the colon that ends it.
+    static const char kLinkHeaderPrefix[] = "link:";
+
+    /// @brief Where a URL redirected to.
+    struct RedirectTarget
+    {
+        /// The URL that the redirects ended at.
+        std::string url;
+
+        /// The time until which the target may be used instead of the URL.
+        std::time_t valid_until;
+    };
+
+    /// @brief The libcurl state that is shared by all transports in the process.
+    ///
+    /// Resolved host names and TLS sessions are shared, so that a transport
+    /// that is created for a single check does not have to resolve the
+    /// host or perform a full TLS handshake again.
+    struct SharedCurlState
+    {
+        /// @brief Constructor. Initializes libcurl and creates the share handle.
+        SharedCurlState()
+            : share(nullptr)
+            , statistics()
+        {
+            if (curl_global_init(CURL_GLOBAL_DEFAULT) == CURLE_OK)
+            {
+                share = curl_share_init();
+            }
+
+            if (share != nullptr)
+            {
+                curl_share_setopt(share, CURLSHOPT_LOCKFUNC, LockShare);
+                curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, UnlockShare);
+                curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+                curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+                curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+            }
+        }
+
+        /// @brief Destructor.
+        ~SharedCurlState()
+        {
+            if (share != nullptr)
+            {
+                curl_share_cleanup(share);
+            }
+        }
+
+        /// @brief Lock shared data for a transfer; called by libcurl.
+        static void LockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* user_data)
+        {
+            (void)handle;
+            (void)access;
+            static_cast<SharedCurlState*>(user_data)->locks[data].lock();
+        }
+
+        /// @brief Unlock shared data after a transfer used it; called by libcurl.
+        static void UnlockShare(CURL* handle, curl_lock_data data, void* user_data)
+        {
+            (void)handle;
+            static_cast<SharedCurlState*>(user_data)->locks[data].unlock();
+        }
+
+        /// @brief Get the shared state, which is created on first use.
+        static SharedCurlState& Get()
+        {
+            static SharedCurlState shared_state;
+            return shared_state;
+        }
+
+        /// The share handle, or nullptr if libcurl could not be initialized.
+        CURLSH* share;
+
+        /// A lock for each kind of shared data.
+        std::mutex locks[CURL_LOCK_DATA_LAST];
+
+        /// Protects statistics.
+        std::mutex statistics_mutex;
+
+        /// The totals over all transfers.
+        TransportStatistics statistics;
+
+        /// Serializes reading and writing TLS session files, and protects loaded_session_files.
+        std::mutex session_file_mutex;
+
+        /// The TLS session files that have been loaded into the share handle.
+        std::set<std::string> loaded_session_files;
+
+        /// Protects ipv4_preferred_hosts.
+        std::mutex address_family_mutex;
+
+        /// The hosts that IPv4 won the last connection race to, and the time until which they are connected to over IPv4 only.
+        std::map<std::string, std::time_t> ipv4_preferred_hosts;
+
+        /// Protects redirect_targets.
+        std::mutex redirect_mutex;
+
+        /// The URLs that redirected, and where they redirected to.
+        std::map<std::string, RedirectTarget> redirect_targets;
+    };
+
+    /// @brief A transfer that is in progress.
+    struct ActiveTransfer
+    {
+        /// The index of the request.
+        size_t index;
+
+        /// The easy handle of the transfer while it is in progress; nullptr once it is complete.
+        CURL* easy;
+
+        /// The request.
+        const TransferRequest* request;
+
+        /// The URL that is downloaded: the URL of the request, or where it redirected to before.
+        std::string url;
+
+        /// True if url is a cached redirect target.
+        bool is_redirect_cached;
+
+        /// True if only the headers are requested, to open a connection for Prewarm().
+        bool is_prewarm;
+
+        /// The scheme, host and port of url, which identify the connections that the transfer can use.
+        std::string connection_key;
+
+        /// True once the transfer has left the queue, and has been added to the multi handle.
+        bool is_started;
+
+        /// The outcome of the request.
+        TransferResult* result;
+
+        /// Receives the body if the request does not have a data_callback.
+        UpdateCheckApiUtils::SharedBufferWriter body_writer;
+
+        /// True if the data_callback stopped the transfer.
+        bool was_stopped;
+
+        /// The host name of the request.
+        std::string host;
+
+        /// True if the transfer connects over IPv4 only, because IPv4 won the last race to the host.
+        bool is_ipv4_only;
+
+        /// The additional headers of the request, which libcurl uses until the transfer is released.
+        struct curl_slist* headers;
+
+        /// Receives libcurl's description of an error.
+        char error_buffer[CURL_ERROR_SIZE];
+    };
+
+#if LIBCURL_VERSION_NUM >= 0x080c00
+    /// @brief Append a length-prefixed field to a TLS session file.
+    static void AppendSessionField(std::string& file_contents, const void* data, size_t size)
+    {
+        uint32_t field_size = static_cast<uint32_t>(size);
+        file_contents.append(reinterpret_cast<const char*>(&field_size), sizeof(field_size));
+        file_contents.append(static_cast<const char*>(data), size);
+    }
+
+    /// @brief Read a length-prefixed field of a TLS session file.
+    ///
+    /// @return true if the field was read; false if the file ends early.
+    static bool ReadSessionField(const std::string& file_contents, size_t& offset, const unsigned char*& data, size_t& size)
+    {
+        uint32_t field_size = 0;
+        if (file_contents.size() - offset < sizeof(field_size))
+        {
+            return false;
+        }
+
+        std::memcpy(&field_size, file_contents.data() + offset, sizeof(field_size));
+        offset += sizeof(field_size);
+
+        if (file_contents.size() - offset < field_size)
+        {
+            return false;
+        }
+
+        data = reinterpret_cast<const unsigned char*>(file_contents.data() + offset);
+        size = field_size;
+        offset += field_size;
+        return true;
+    }
+
+    /// @brief The state of exporting TLS sessions to a file.
+    struct SessionExport
+    {
+        /// The contents of the file.
+        std::string file_contents;
+
+        /// The current time, to skip sessions that have expired.
+        curl_off_t now;
+
+        /// The number of sessions that were exported.
+        uint64_t session_count;
+    };
+
+    /// @brief Add a TLS session to the contents of a TLS session file; called by libcurl.
+    ///
+    /// Only the salted hash of the session key is kept, so the file does not name the hosts.
+    static CURLcode ExportTlsSession(CURL*                handle,
+                                     void*                user_data,
+                                     const char*          session_key,
+                                     const unsigned char* shmac,
+                                     size_t               shmac_size,
+                                     const unsigned char* session_data,
+                                     size_t               session_data_size,
+                                     curl_off_t           valid_until,
+                                     int                  ietf_tls_id,
+                                     const char*          alpn,
+                                     size_t               early_data_max)
+    {
+        (void)handle;
+        (void)session_key;
+        (void)ietf_tls_id;
+        (void)alpn;
+        (void)early_data_max;
+
+        SessionExport* session_export = static_cast<SessionExport*>(user_data);
+
+        if (shmac != nullptr && shmac_size != 0 && (valid_until == 0 || valid_until > session_export->now))
+        {
+            AppendSessionField(session_export->file_contents, shmac, shmac_size);
+            AppendSessionField(session_export->file_contents, session_data, session_data_size);
+            AppendSessionField(session_export->file_contents, &valid_until, sizeof(valid_until));
+            ++session_export->session_count;
+        }
+
+        return CURLE_OK;
+    }
+#endif  // LIBCURL_VERSION_NUM >= 0x080c00
+
+    /// @brief Load the TLS sessions of a file into the share handle, once per process.
+    ///
+    /// Sessions that have expired, and files that cannot be read, are skipped.
+    static void ImportTlsSessions(const std::string& session_file_path)
+    {
+#if LIBCURL_VERSION_NUM >= 0x080c00
+        SharedCurlState&            shared_state = SharedCurlState::Get();
+        std::lock_guard<std::mutex> session_file_lock(shared_state.session_file_mutex);
+
+        if (!shared_state.loaded_session_files.insert(session_file_path).second)
+        {
+            return;
+        }
+
+        std::ifstream session_file(session_file_path.c_str(), std::ios::binary);
+        std::string   file_contents((std::istreambuf_iterator<char>(session_file)), std::istreambuf_iterator<char>());
+
+        CURL* easy = nullptr;
+        if (file_contents.size() >= sizeof(kTlsSessionFileMagic) && std::memcmp(file_contents.data(), kTlsSessionFileMagic, sizeof(kTlsSessionFileMagic)) == 0)
+        {
+            easy = curl_easy_init();
+        }
+
+        if (easy != nullptr)
+        {
+            curl_easy_setopt(easy, CURLOPT_SHARE, shared_state.share);
+
+            const curl_off_t now           = static_cast<curl_off_t>(std::time(nullptr));
+            size_t           offset        = sizeof(kTlsSessionFileMagic);
+            uint64_t         session_count = 0;
+
+            const unsigned char* shmac             = nullptr;
+            const unsigned char* session_data      = nullptr;
+            const unsigned char* valid_until_data  = nullptr;
+            size_t               shmac_size        = 0;
+            size_t               session_data_size = 0;
+            size_t               valid_until_size  = 0;
+
+            while (ReadSessionField(file_contents, offset, shmac, shmac_size) && ReadSessionField(file_contents, offset, session_data, session_data_size) &&
+                   ReadSessionField(file_contents, offset, valid_until_data, valid_until_size))
+            {
+                curl_off_t valid_until = 0;
+                if (valid_until_size == sizeof(valid_until))
+                {
+                    std::memcpy(&valid_until, valid_until_data, sizeof(valid_until));
+                }
+
+                if (valid_until == 0 || valid_until > now)
+                {
+                    CURLcode code = curl_easy_ssls_import(easy, nullptr, shmac, shmac_size, session_data, session_data_size);
+                    if (code == CURLE_NOT_BUILT_IN)
+                    {
+                        break;
+                    }
+
+                    if (code == CURLE_OK)
+                    {
+                        ++session_count;
+                    }
+                }
+            }
+
+            curl_easy_cleanup(easy);
+
+            std::lock_guard<std::mutex> statistics_lock(shared_state.statistics_mutex);
+            shared_state.statistics.tls_sessions_imported += session_count;
+        }
+#else
+        (void)session_file_path;
+#endif  // LIBCURL_VERSION_NUM >= 0x080c00
+    }
+
+    /// @brief Save the TLS sessions of the share handle to a file, replacing its contents.
+    static void ExportTlsSessions(const std::string& session_file_path)
+    {
+#if LIBCURL_VERSION_NUM >= 0x080c00
+        SharedCurlState&            shared_state = SharedCurlState::Get();
+        std::lock_guard<std::mutex> session_file_lock(shared_state.session_file_mutex);
+
+        SessionExport session_export;
+        session_export.file_contents.assign(kTlsSessionFileMagic, sizeof(kTlsSessionFileMagic));
+        session_export.now           = static_cast<curl_off_t>(std::time(nullptr));
+        session_export.session_count = 0;
+
+        CURL* easy = curl_easy_init();
+        if (easy != nullptr)
+        {
+            curl_easy_setopt(easy, CURLOPT_SHARE, shared_state.share);
+            CURLcode code = curl_easy_ssls_export(easy, ExportTlsSession, &session_export);
+            curl_easy_cleanup(easy);
+
+            if (code == CURLE_OK && session_export.session_count != 0)
+            {
+                // Write a new file and then replace the old one, so that another process never reads a partial file.
+                std::string temp_file_path = session_file_path + ".tmp";
+                {
+                    std::ofstream session_file(temp_file_path.c_str(), std::ios::binary | std::ios::trunc);
+                    session_file.write(session_export.file_contents.data(), session_export.file_contents.size());
+                }
+
+                std::remove(session_file_path.c_str());
+                if (std::rename(temp_file_path.c_str(), session_file_path.c_str()) == 0)
+                {
+                    std::lock_guard<std::mutex> statistics_lock(shared_state.statistics_mutex);
+                    shared_state.statistics.tls_sessions_exported += session_export.session_count;
+                }
+            }
+        }
+#else
+        (void)session_file_path;
+#endif  // LIBCURL_VERSION_NUM >= 0x080c00
+    }
+
+    struct CurlTransport::Impl
+    {
+        /// The settings of the transport.
+        TransportOptions options;
+
+        /// The multi handle, which owns the open connections.
+        CURLM* multi;
+
+        /// Easy handles that are not in use. They are kept so that each transfer does not have to allocate one.
+        std::vector<CURL*> idle_handles;
+
+        /// Serializes calls to Fetch().
+        std::mutex fetch_mutex;
+
+        /// For each host that the transport connected to, whether it connects over IPv4 only.
+        std::map<std::string, bool> host_address_families;
+
+        /// The connection keys of the https:// servers that answered over HTTP/1, so that they cannot multiplex transfers.
+        std::set<std::string> http1_servers;
+
+        /// Protects cancel_requests, is_cancelling_all and is_fetching, which other threads access through CancelTransfer() and CancelAllTransfers().
+        std::mutex cancel_mutex;
+
+        /// The indices of the transfers that CancelTransfer() was called for, and that Fetch() has not stopped yet.
+        std::vector<size_t> cancel_requests;
+
+        /// True once CancelAllTransfers() was called, until the Fetch() in progress stopped all of its transfers.
+        bool is_cancelling_all;
+
+        /// True while Fetch() is in progress.
+        bool is_fetching;
+
+        /// True once the transport is being destroyed; the transfers in progress are stopped.
+        bool is_closing;
+
+        /// Protects prewarm_urls and is_prewarming.
+        std::mutex prewarm_mutex;
+
+        /// The URLs that Prewarm() was called for, and that the prewarm thread has not connected to yet.
+        std::vector<std::string> prewarm_urls;
+
+        /// True while the prewarm thread is running.
+        bool is_prewarming;
+
+        /// The thread that opens connections for Prewarm().
+        std::thread prewarm_thread;
+    };
+
+    /// @brief Receive a chunk of a response body; called by libcurl.
+    ///
+    /// @return The number of bytes that were consumed; any other value stops the transfer.
+    static size_t ReceiveBody(char* data, size_t size, size_t count, void* user_data)
+    {
+        ActiveTransfer* transfer   = static_cast<ActiveTransfer*>(user_data);
+        size_t          chunk_size = size * count;
+
+        try
+        {
+            if (transfer->request->data_callback)
+            {
+                if (!transfer->request->data_callback(data, chunk_size))
+                {
+                    transfer->was_stopped = true;
+                    return 0;
+                }
+            }
+            else
+            {
+                transfer->body_writer.Append(data, chunk_size);
+            }
+        }
+        catch (std::exception&)
+        {
+            // Exceptions must not propagate through libcurl; failing the write fails the transfer.
+            transfer->was_stopped = true;
+            return 0;
+        }
+
+        transfer->result->body_size += chunk_size;
+        return chunk_size;
+    }
+
+    /// @brief Get the duration of a phase of a transfer in milliseconds.
+    static double GetPhaseTime(CURL* easy, CURLINFO info)
+    {
+        curl_off_t microseconds = 0;
+        curl_easy_getinfo(easy, info, &microseconds);
+        return static_cast<double>(microseconds) / 1000.0;
+    }
+
+    /// @brief Get the host name of a URL.
+    ///
+    /// @return The host name, or an empty string if the URL is not valid.
+    static std::string GetUrlHost(const std::string& url)
+    {
+        std::string host;
+        CURLU*      parsed_url = curl_url();
+
+        if (parsed_url != nullptr)
+        {
+            char* host_part = nullptr;
+            if (curl_url_set(parsed_url, CURLUPART_URL, url.c_str(), 0) == CURLUE_OK && curl_url_get(parsed_url, CURLUPART_HOST, &host_part, 0) == CURLUE_OK)
+            {
+                host = host_part;
+                curl_free(host_part);
+            }
+
+            curl_url_cleanup(parsed_url);
+        }
+
+        return host;
+    }
+
+    /// @brief Get the scheme, host and port of a URL, which identify the connections that transfers of the URL can share.
+    ///
+    /// @return The key, like "https://api.github.com:443"; or the URL itself if it is not valid.
+    static std::string GetConnectionKey(const std::string& url)
+    {
+        std::string key        = url;
+        CURLU*      parsed_url = curl_url();
+
+        if (parsed_url != nullptr)
+        {
+            char* scheme_part = nullptr;
+            char* host_part   = nullptr;
+            char* port_part   = nullptr;
+
+            if (curl_url_set(parsed_url, CURLUPART_URL, url.c_str(), 0) == CURLUE_OK && curl_url_get(parsed_url, CURLUPART_SCHEME, &scheme_part, 0) == CURLUE_OK &&
+                curl_url_get(parsed_url, CURLUPART_HOST, &host_part, 0) == CURLUE_OK && curl_url_get(parsed_url, CURLUPART_PORT, &port_part, CURLU_DEFAULT_PORT) == CURLUE_OK)
+            {
+                key = std::string(scheme_part) + "://" + host_part + ":" + port_part;
+            }
+
+            curl_free(scheme_part);
+            curl_free(host_part);
+            curl_free(port_part);
+            curl_url_cleanup(parsed_url);
+        }
+
+        return key;
+    }
+
+    /// @brief Check whether the transfers to a host should connect over IPv4 only.
+    ///
+    /// @return true if IPv4 won the last race to the host, and the preference has not expired.
+    static bool IsIpv4PreferredHost(const std::string& host)
+    {
+        SharedCurlState&            shared_state = SharedCurlState::Get();
+        std::lock_guard<std::mutex> address_family_lock(shared_state.address_family_mutex);
+
+        bool                                         is_preferred = false;
+        std::map<std::string, std::time_t>::iterator preference   = shared_state.ipv4_preferred_hosts.find(host);
+
+        if (preference != shared_state.ipv4_preferred_hosts.end())
+        {
+            if (preference->second > std::time(nullptr))
+            {
+                is_preferred = true;
+            }
+            else
+            {
+                shared_state.ipv4_preferred_hosts.erase(preference);
+            }
+        }
+
+        return is_preferred;
+    }
+
+    /// @brief Remember which address family a transfer connected with, for the next transfers to its host.
+    static void UpdateAddressFamilyPreference(CURLcode code, const ActiveTransfer& transfer, const TransportOptions& options)
+    {
+        const TransferResult& result = *transfer.result;
+
+        if (transfer.host.empty() || options.ipv4_preference_timeout_s <= 0)
+        {
+            return;
+        }
+
+        SharedCurlState&            shared_state = SharedCurlState::Get();
+        std::lock_guard<std::mutex> address_family_lock(shared_state.address_family_mutex);
+
+        if (transfer.is_ipv4_only && (code == CURLE_COULDNT_RESOLVE_HOST || code == CURLE_COULDNT_CONNECT || code == CURLE_OPERATION_TIMEDOUT))
+        {
+            // IPv4 no longer works for the host; race both families again next time.
+            shared_state.ipv4_preferred_hosts.erase(transfer.host);
+        }
+        else if (result.new_connections > 0 && !result.primary_ip.empty())
+        {
+            if (result.primary_ip.find(':') == std::string::npos)
+            {
+                shared_state.ipv4_preferred_hosts[transfer.host] = std::time(nullptr) + options.ipv4_preference_timeout_s;
+            }
+            else
+            {
+                shared_state.ipv4_preferred_hosts.erase(transfer.host);
+            }
+        }
+    }
+
+    /// @brief Convert a UTC calendar date and time to a time_t, independently of the time zone of the process.
+    static std::time_t GetUtcTime(int year, int month, int day, int hour, int minute, int second)
+    {
+        // Count the days since 1970-01-01, with years that start in March so that the leap day is the last day of a year.
+        year -= (month <= 2) ? 1 : 0;
+        const long long era         = (year >= 0 ? year : year - 399) / 400;
+        const long long year_of_era = year - era * 400;
+        const long long day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const long long day_of_era  = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+        const long long days        = era * 146097 + day_of_era - 719468;
+
+        return static_cast<std::time_t>(days * 86400 + hour * 3600 + minute * 60 + second);
+    }
+
+    /// @brief Get the time when a signed URL expires, from the parameters of its query.
+    ///
+    /// The expiry parameters of Azure Blob Storage (se), Amazon S3 (X-Amz-Date and
+    /// X-Amz-Expires) and Amazon CloudFront (Expires) are recognized; GitHub serves
+    /// release assets from URLs signed in these ways.
+    ///
+    /// @return The time when the URL expires, or 0 if it does not have a recognized expiry.
+    static std::time_t GetSignedUrlExpiry(const std::string& url)
+    {
+        std::map<std::string, std::string> parameters;
+
+        size_t query_start = url.find('?');
+        size_t query_end   = url.find('#');
+        if (query_start == std::string::npos || (query_end != std::string::npos && query_end < query_start))
+        {
+            return 0;
+        }
+
+        if (query_end == std::string::npos)
+        {
+            query_end = url.size();
+        }
+
+        for (size_t parameter_start = query_start + 1; parameter_start < query_end;)
+        {
+            size_t parameter_end = std::min(url.find('&', parameter_start), query_end);
+            size_t value_start   = url.find('=', parameter_start);
+
+            if (value_start < parameter_end)
+            {
+                // Percent-decode the value; the dates of Azure signatures have encoded colons.
+                std::string value;
+                for (size_t i = value_start + 1; i < parameter_end; ++i)
+                {
+                    if (url[i] == '%' && i + 2 < parameter_end)
+                    {
+                        value += static_cast<char>(std::strtol(url.substr(i + 1, 2).c_str(), nullptr, 16));
+                        i += 2;
+                    }
+                    else
+                    {
+                        value += url[i];
+                    }
+                }
+
+                parameters[url.substr(parameter_start, value_start - parameter_start)] = value;
+            }
+
+            parameter_start = parameter_end + 1;
+        }
+
+        std::time_t expiry = 0;
+        int         year   = 0;
+        int         month  = 0;
+        int         day    = 0;
+        int         hour   = 0;
+        int         minute = 0;
+        int         second = 0;
+
+        std::map<std::string, std::string>::const_iterator azure_expiry   = parameters.find("se");
+        std::map<std::string, std::string>::const_iterator amazon_date    = parameters.find("X-Amz-Date");
+        std::map<std::string, std::string>::const_iterator amazon_expires = parameters.find("X-Amz-Expires");
+        std::map<std::string, std::string>::const_iterator expires        = parameters.find("Expires");
+
+        if (azure_expiry != parameters.end() &&
+            std::sscanf(azure_expiry->second.c_str(), "%4d-%2d-%2dT%2d:%2d:%2d", &year, &month, &day, &hour, &minute, &second) >= 3)
+        {
+            expiry = GetUtcTime(year, month, day, hour, minute, second);
+        }
+        else if (amazon_date != parameters.end() && amazon_expires != parameters.end() &&
+                 std::sscanf(amazon_date->second.c_str(), "%4d%2d%2dT%2d%2d%2d", &year, &month, &day, &hour, &minute, &second) == 6)
+        {
+            expiry = GetUtcTime(year, month, day, hour, minute, second) + std::strtol(amazon_expires->second.c_str(), nullptr, 10);
+        }
+        else if (expires != parameters.end())
+        {
+            expiry = static_cast<std::time_t>(std::strtoll(expires->second.c_str(), nullptr, 10));
+        }
+
+        return expiry;
+    }
+
+    /// @brief Get the time until which the redirect responses of a transfer may be reused, from their Cache-Control and Expires headers.
+    ///
+    /// @return The earliest time; 0 if the responses do not limit it; or -1 if one of them must not be reused.
+    static std::time_t GetRedirectResponseExpiry(CURL* easy, long redirect_count, std::time_t now)
+    {
+        std::time_t expiry = 0;
+
+#if LIBCURL_VERSION_NUM >= 0x075400
+        // With redirects followed, the responses of the first redirect_count requests are the redirects.
+        for (long request = 0; request < redirect_count && expiry >= 0; ++request)
+        {
+            std::time_t  response_expiry = 0;
+            curl_header* header          = nullptr;
+
+            if (curl_easy_header(easy, "Cache-Control", 0, CURLH_HEADER, static_cast<int>(request), &header) == CURLHE_OK)
+            {
+                std::string cache_control = header->value;
+                std::transform(cache_control.begin(), cache_control.end(), cache_control.begin(), ::tolower);
+
+                size_t max_age = cache_control.find("max-age=");
+                if (cache_control.find("no-store") != std::string::npos)
+                {
+                    response_expiry = -1;
+                }
+                else if (max_age != std::string::npos)
+                {
+                    response_expiry = now + std::strtol(cache_control.c_str() + max_age + std::strlen("max-age="), nullptr, 10);
+                }
+            }
+
+            if (response_expiry == 0 && curl_easy_header(easy, "Expires", 0, CURLH_HEADER, static_cast<int>(request), &header) == CURLHE_OK)
+            {
+                // A date that cannot be parsed, like "0", means that the response has already expired.
+                response_expiry = curl_getdate(header->value, nullptr);
+            }
+
+            if (response_expiry != 0 && response_expiry <= now)
+            {
+                response_expiry = -1;
+            }
+
+            if (response_expiry != 0 && (expiry == 0 || response_expiry < expiry))
+            {
+                expiry = response_expiry;
+            }
+        }
+#else
+        (void)easy;
+        (void)redirect_count;
+        (void)now;
+#endif  // LIBCURL_VERSION_NUM >= 0x075400
+
+        return expiry;
+    }
+
+    /// @brief Look up where a URL redirected to.
+    ///
+    /// @return true if the URL redirected before, and the target has not expired.
+    static bool FindRedirectTarget(const std::string& url, std::string& target_url)
+    {
+        SharedCurlState&            shared_state = SharedCurlState::Get();
+        std::lock_guard<std::mutex> redirect_lock(shared_state.redirect_mutex);
+
+        bool                                            is_found = false;
+        std::map<std::string, RedirectTarget>::iterator target   = shared_state.redirect_targets.find(url);
+
+        if (target != shared_state.redirect_targets.end())
+        {
+            if (target->second.valid_until > std::time(nullptr))
+            {
+                target_url = target->second.url;
+                is_found   = true;
+            }
+            else
+            {
+                shared_state.redirect_targets.erase(target);
+            }
+        }
+
+        return is_found;
+    }
+
+    /// @brief Remember where the URL of a transfer redirected to, or forget a cached target that failed.
+    static void UpdateRedirectTarget(CURL* easy, CURLcode code, const ActiveTransfer& transfer, const TransportOptions& options)
+    {
+        SharedCurlState& shared_state = SharedCurlState::Get();
+
+        // Where a POST request redirects to depends on its body, so it is not remembered.
+        if (!transfer.request->post_body.empty())
+        {
+            return;
+        }
+
+        if (transfer.is_redirect_cached)
+        {
+            if (code != CURLE_OK)
+            {
+                {
+                    std::lock_guard<std::mutex> redirect_lock(shared_state.redirect_mutex);
+                    shared_state.redirect_targets.erase(transfer.request->url);
+                }
+
+                std::lock_guard<std::mutex> statistics_lock(shared_state.statistics_mutex);
+                shared_state.statistics.redirect_targets_failed += 1;
+            }
+
+            return;
+        }
+
+        long        redirect_count = 0;
+        long        http_status    = 0;
+        const char* effective_url  = nullptr;
+        curl_easy_getinfo(easy, CURLINFO_REDIRECT_COUNT, &redirect_count);
+        curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status);
+        curl_easy_getinfo(easy, CURLINFO_EFFECTIVE_URL, &effective_url);
+
+        if (options.redirect_cache_timeout_s <= 0 || code != CURLE_OK || http_status >= 400 || redirect_count == 0 || effective_url == nullptr)
+        {
+            return;
+        }
+
+        const std::time_t now             = std::time(nullptr);
+        const std::time_t response_expiry = GetRedirectResponseExpiry(easy, redirect_count, now);
+        const std::time_t url_expiry      = GetSignedUrlExpiry(effective_url);
+        std::time_t       valid_until     = now + options.redirect_cache_timeout_s;
+
+        if (response_expiry > 0)
+        {
+            valid_until = std::min(valid_until, response_expiry);
+        }
+
+        if (url_expiry > 0)
+        {
+            valid_until = std::min(valid_until, url_expiry - kRedirectExpiryMargin);
+        }
+
+        if (response_expiry < 0 || valid_until <= now)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> redirect_lock(shared_state.redirect_mutex);
+
+        // Drop the targets that have expired, so that URLs that are not requested again do not accumulate.
+        for (std::map<std::string, RedirectTarget>::iterator target = shared_state.redirect_targets.begin(); target != shared_state.redirect_targets.end();)
+        {
+            if (target->second.valid_until <= now)
+            {
+                target = shared_state.redirect_targets.erase(target);
+            }
+            else
+            {
+                ++target;
+            }
+        }
+
+        RedirectTarget& target = shared_state.redirect_targets[transfer.request->url];
+        target.url             = effective_url;
+        target.valid_until     = valid_until;
+    }
+
+    /// @brief Receive a header line of a response; called by libcurl.
+    ///
+    /// @return The number of bytes that were consumed.
+    static size_t ReceiveHeader(char* data, size_t size, size_t count, void* user_data)
+    {
+        ActiveTransfer* transfer    = static_cast<ActiveTransfer*>(user_data);
+        size_t          line_size   = size * count;
+        const size_t    link_length = std::strlen(kLinkHeaderPrefix);
+
+        try
+        {
+            if (line_size >= 5 && std::strncmp(data, "HTTP/", 5) == 0)
+            {
+                // A new response, like the one after a redirect, replaces the headers of the previous one.
+                transfer->result->link_header.clear();
+            }
+            else if (line_size > link_length)
+            {
+                std::string name(data, link_length);
+                std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+                if (name == kLinkHeaderPrefix)
+                {
+                    std::string value(data + link_length, line_size - link_length);
+                    size_t      value_start = value.find_first_not_of(" \t");
+                    size_t      value_end   = value.find_last_not_of(" \t\r\n");
+
+                    if (value_start != std::string::npos)
+                    {
+                        transfer->result->link_header = value.substr(value_start, value_end - value_start + 1);
+                    }
+                }
+            }
+        }
+        catch (std::exception&)
+        {
+            // Exceptions must not propagate through libcurl; the header is not needed to complete the transfer.
+        }
+
+        return line_size;
+    }
+
+    /// @brief Fill in the outcome of a transfer that is complete.
+    static void CompleteTransfer(CURL* easy, CURLcode code, ActiveTransfer& transfer)
+    {
+        TransferResult& result      = *transfer.result;
+        result.used_cached_redirect = transfer.is_redirect_cached;
+
+        const char* effective_url = nullptr;
+        const char* primary_ip    = nullptr;
+        const char* content_type  = nullptr;
+        long        http_version  = CURL_HTTP_VERSION_NONE;
+        curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &result.http_status);
+        curl_easy_getinfo(easy, CURLINFO_HTTP_VERSION, &http_version);
+        curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &result.new_connections);
+        if (curl_easy_getinfo(easy, CURLINFO_EFFECTIVE_URL, &effective_url) == CURLE_OK && effective_url != nullptr)
+        {
+            result.effective_url = effective_url;
+        }
+
+        if (curl_easy_getinfo(easy, CURLINFO_PRIMARY_IP, &primary_ip) == CURLE_OK && primary_ip != nullptr)
+        {
+            result.primary_ip = primary_ip;
+        }
+
+        if (curl_easy_getinfo(easy, CURLINFO_CONTENT_TYPE, &content_type) == CURLE_OK && content_type != nullptr)
+        {
+            result.content_type = content_type;
+        }
+
+        // Phases that did not happen are reported as 0; give them the time of the phase before.
+        TransferTiming& timing = result.timing;
+        timing.name_lookup     = GetPhaseTime(easy, CURLINFO_NAMELOOKUP_TIME_T);
+        timing.connect         = std::max(timing.name_lookup, GetPhaseTime(easy, CURLINFO_CONNECT_TIME_T));
+        timing.tls_handshake   = std::max(timing.connect, GetPhaseTime(easy, CURLINFO_APPCONNECT_TIME_T));
+        timing.first_byte      = std::max(timing.tls_handshake, GetPhaseTime(easy, CURLINFO_STARTTRANSFER_TIME_T));
+        timing.total           = std::max(timing.first_byte, GetPhaseTime(easy, CURLINFO_TOTAL_TIME_T));
+        timing.redirect        = GetPhaseTime(easy, CURLINFO_REDIRECT_TIME_T);
+
+        curl_off_t wire_size = 0;
+        curl_easy_getinfo(easy, CURLINFO_SIZE_DOWNLOAD_T, &wire_size);
+        result.wire_size = static_cast<uint64_t>(wire_size);
+
+        // A TLS handshake took place if the transfer opened a connection that has a TLS phase.
+        double tls_handshake_end = GetPhaseTime(easy, CURLINFO_APPCONNECT_TIME_T);
+        bool   did_tls_handshake = (result.new_connections > 0 && tls_handshake_end > 0.0);
+
+        {
+            SharedCurlState&            shared_state = SharedCurlState::Get();
+            std::lock_guard<std::mutex> statistics_lock(shared_state.statistics_mutex);
+            shared_state.statistics.transfers += 1;
+            shared_state.statistics.new_connections += static_cast<uint64_t>(result.new_connections);
+            shared_state.statistics.body_bytes += result.body_size;
+            shared_state.statistics.wire_bytes += result.wire_size;
+            if (transfer.is_ipv4_only)
+            {
+                shared_state.statistics.ipv4_preferred_transfers += 1;
+            }
+
+            if (transfer.is_redirect_cached && code == CURLE_OK)
+            {
+                shared_state.statistics.redirects_skipped += 1;
+            }
+
+            if (did_tls_handshake)
+            {
+                shared_state.statistics.tls_handshakes += 1;
+                shared_state.statistics.tls_handshake_time += timing.tls_handshake - timing.connect;
+            }
+        }
+
+        switch (http_version)
+        {
+        case CURL_HTTP_VERSION_1_0:
+            result.http_version = 10;
+            break;
+        case CURL_HTTP_VERSION_1_1:
+            result.http_version = 11;
+            break;
+        case CURL_HTTP_VERSION_2_0:
+            result.http_version = 20;
+            break;
+        case CURL_HTTP_VERSION_3:
+            result.http_version = 30;
+            break;
+        default:
+            result.http_version = 0;
+            break;
+        }
+
+        if (code != CURLE_OK)
+        {
+            result.was_successful = false;
+            result.error_message.append(kStringErrorTransferFailed);
+            result.error_message.append(transfer.request->url);
+            result.error_message.append(": ");
+            result.error_message.append((transfer.error_buffer[0] != '\0') ? transfer.error_buffer : curl_easy_strerror(code));
+        }
+        else if (result.http_status >= 400)
+        {
+            result.was_successful = false;
+            result.error_message.append(kStringErrorTransferFailed);
+            result.error_message.append(transfer.request->url);
+            result.error_message.append(": ");
+            result.error_message.append(kStringErrorHttpStatus);
+            result.error_message.append(std::to_string(result.http_status));
+        }
+        else
+        {
+            result.was_successful = true;
+        }
+
+        if (!transfer.request->data_callback)
+        {
+            result.body = transfer.body_writer.Publish();
+        }
+    }
+
+    TransportOptions::TransportOptions()
+        : max_connections(64)
+        , max_host_connections(8)
+        , max_idle_connections(16)
+        , max_idle_time_s(60)
+        , connect_timeout_ms(15000)
+        , transfer_timeout_ms(60000)
+        , max_redirects(10)
+        , happy_eyeballs_delay_ms(250)
+        , dns_cache_timeout_s(60)
+        , ipv4_preference_timeout_s(600)
+        , redirect_cache_timeout_s(300)
+        , accept_compressed(true)
+        , use_http2(true)
+        , max_streams_per_connection(100)
+    {
+        user_agent = kStringTransportUserAgent;
+        user_agent += std::to_string(UPDATECHECKAPI_MAJOR) + "." + std::to_string(UPDATECHECKAPI_MINOR) + "." + std::to_string(UPDATECHECKAPI_PATCH);
+    }
+
+    CurlTransport::CurlTransport(const TransportOptions& options)
+        : impl_(new Impl())
+    {
+        impl_->options       = options;
+        impl_->multi         = nullptr;
+        impl_->is_cancelling_all = false;
+        impl_->is_fetching       = false;
+        impl_->is_closing        = false;
+        impl_->is_prewarming     = false;
+
+        if (SharedCurlState::Get().share != nullptr)
+        {
+            impl_->multi = curl_multi_init();
+        }
+
+        if (impl_->multi != nullptr)
+        {
+            curl_multi_setopt(impl_->multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, options.max_connections);
+            curl_multi_setopt(impl_->multi, CURLMOPT_MAX_HOST_CONNECTIONS, options.max_host_connections);
+            curl_multi_setopt(impl_->multi, CURLMOPT_MAXCONNECTS, options.max_idle_connections);
+            curl_multi_setopt(impl_->multi, CURLMOPT_PIPELINING, options.use_http2 ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+            curl_multi_setopt(impl_->multi, CURLMOPT_MAX_CONCURRENT_STREAMS, options.max_streams_per_connection);
+        }
+    }
+
+    CurlTransport::~CurlTransport()
+    {
+        // Stop connecting for Prewarm(), rather than waiting for a slow server.
+        {
+            std::lock_guard<std::mutex> cancel_lock(impl_->cancel_mutex);
+            impl_->is_closing = true;
+            if (impl_->multi != nullptr)
+            {
+                curl_multi_wakeup(impl_->multi);
+            }
+        }
+
+        if (impl_->prewarm_thread.joinable())
+        {
+            impl_->prewarm_thread.join();
+        }
+
+        for (CURL* easy : impl_->idle_handles)
+        {
+            curl_easy_cleanup(easy);
+        }
+
+        if (impl_->multi != nullptr)
+        {
+            curl_multi_cleanup(impl_->multi);
+        }
+    }
+
+    bool CurlTransport::IsValid() const
+    {
+        return impl_->multi != nullptr;
+    }
+
+    /// @brief Get the order to start the requests of a Fetch() in, taking one request of each group in turn.
+    ///
+    /// The requests of a group keep their order. This is the order of the queue in which
+    /// transfers wait for a connection to their server.
+    ///
+    /// @return The indices of the requests.
+    static std::vector<size_t> GetStartOrder(const std::vector<TransferRequest>& requests)
+    {
+        std::vector<std::vector<size_t>> groups;
+        std::map<std::string, size_t>    group_indices;
+
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            std::pair<std::map<std::string, size_t>::iterator, bool> group = group_indices.insert(std::make_pair(requests[i].group, groups.size()));
+            if (group.second)
+            {
+                groups.push_back(std::vector<size_t>());
+            }
+
+            groups[group.first->second].push_back(i);
+        }
+
+        std::vector<size_t> start_order;
+        start_order.reserve(requests.size());
+
+        for (size_t round = 0; start_order.size() < requests.size(); ++round)
+        {
+            for (const std::vector<size_t>& group : groups)
+            {
+                if (round < group.size())
+                {
+                    start_order.push_back(group[round]);
+                }
+            }
+        }
+
+        return start_order;
+    }
+
+    /// @brief Start the queued transfers that may run now, in the order of the queue.
+    ///
+    /// A transfer may start while fewer than max_host_connections transfers to its
+    /// server are running, or max_streams_per_connection times as many if HTTP/2 can
+    /// multiplex them. Transfers that were cancelled while they were queued are dropped.
+    ///
+    /// @param [in]     multi          The multi handle.
+    /// @param [in,out] transfers      The transfers of the Fetch().
+    /// @param [in,out] queue          The indices of the transfers that have not started.
+    /// @param [in,out] running_counts The number of running transfers for each connection key.
+    /// @param [in]     http1_servers  The connection keys of the https:// servers that answered over HTTP/1.
+    /// @param [in]     options        The settings of the transport.
+    /// @param [in]     fetch_start    The time that the Fetch() started.
+    static void StartQueuedTransfers(CURLM*                                       multi,
+                                     std::vector<ActiveTransfer>&                 transfers,
+                                     std::vector<size_t>&                         queue,
+                                     std::map<std::string, long>&                 running_counts,
+                                     const std::set<std::string>&                 http1_servers,
+                                     const TransportOptions&                      options,
+                                     const std::chrono::steady_clock::time_point& fetch_start)
+    {
+        std::vector<size_t>::iterator queued = queue.begin();
+
+        while (queued != queue.end())
+        {
+            ActiveTransfer& transfer = transfers[*queued];
+
+            // HTTP/2 is only negotiated for https:// URLs.
+            bool is_multiplexed = (options.use_http2 && transfer.connection_key.compare(0, 8, "https://") == 0 && http1_servers.count(transfer.connection_key) == 0);
+
+            long limit = options.max_host_connections;
+            if (limit > 0 && options.max_streams_per_connection > 0 && is_multiplexed)
+            {
+                limit *= options.max_streams_per_connection;
+            }
+
+            if (transfer.easy == nullptr)
+            {
+                queued = queue.erase(queued);
+            }
+            else if (limit <= 0 || running_counts[transfer.connection_key] < limit)
+            {
+                transfer.result->timing.queue = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - fetch_start).count();
+                transfer.is_started           = true;
+                ++running_counts[transfer.connection_key];
+                curl_multi_add_handle(multi, transfer.easy);
+                queued = queue.erase(queued);
+            }
+            else
+            {
+                ++queued;
+            }
+        }
+    }
+
+    /// @brief Stop tracking a transfer that is complete, and keep its easy handle for the next transfer.
+    static void ReleaseTransfer(CURLM* multi, std::vector<CURL*>& idle_handles, ActiveTransfer& transfer)
+    {
+        curl_multi_remove_handle(multi, transfer.easy);
+        idle_handles.push_back(transfer.easy);
+        transfer.easy = nullptr;
+
+        curl_slist_free_all(transfer.headers);
+        transfer.headers = nullptr;
+    }
+
+    /// @brief Set the options of an easy handle for a transfer.
+    ///
+    /// @param [in]     easy                  The easy handle.
+    /// @param [in,out] transfer              The transfer; its host and address family are set.
+    /// @param [in]     options               The settings of the transport.
+    /// @param [in,out] host_address_families Whether the transport connects to each host over IPv4 only.
+    static void ConfigureTransfer(CURL* easy, ActiveTransfer& transfer, const TransportOptions& options, std::map<std::string, bool>& host_address_families)
+    {
+        transfer.host           = GetUrlHost(transfer.url);
+        transfer.connection_key = GetConnectionKey(transfer.url);
+
+        // libcurl only reuses a connection for a transfer with the same address family setting, so
+        // a transport keeps the setting of its first transfer to a host, even if the preference changes.
+        std::map<std::string, bool>::iterator address_family = host_address_families.find(transfer.host);
+        if (address_family == host_address_families.end())
+        {
+            bool is_ipv4_only = (options.ipv4_preference_timeout_s > 0 && !transfer.host.empty() && IsIpv4PreferredHost(transfer.host));
+            address_family    = host_address_families.insert(std::make_pair(transfer.host, is_ipv4_only)).first;
+        }
+
+        transfer.is_ipv4_only = address_family->second;
+
+        curl_easy_setopt(easy, CURLOPT_URL, transfer.url.c_str());
+        curl_easy_setopt(easy, CURLOPT_SHARE, SharedCurlState::Get().share);
+        curl_easy_setopt(easy, CURLOPT_PRIVATE, &transfer);
+        curl_easy_setopt(easy, CURLOPT_ERRORBUFFER, transfer.error_buffer);
+        curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, ReceiveBody);
+        curl_easy_setopt(easy, CURLOPT_WRITEDATA, &transfer);
+        curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, ReceiveHeader);
+        curl_easy_setopt(easy, CURLOPT_HEADERDATA, &transfer);
+        curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(easy, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(easy, CURLOPT_MAXREDIRS, options.max_redirects);
+        curl_easy_setopt(easy, CURLOPT_CONNECTTIMEOUT_MS, options.connect_timeout_ms);
+        curl_easy_setopt(easy, CURLOPT_TIMEOUT_MS, options.transfer_timeout_ms);
+        curl_easy_setopt(easy, CURLOPT_USERAGENT, options.user_agent.c_str());
+        curl_easy_setopt(easy, CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS, options.happy_eyeballs_delay_ms);
+        curl_easy_setopt(easy, CURLOPT_DNS_CACHE_TIMEOUT, options.dns_cache_timeout_s);
+        curl_easy_setopt(easy, CURLOPT_MAXAGE_CONN, options.max_idle_time_s);
+        // An empty string advertises every encoding that libcurl was built with, and enables decoding them.
+        curl_easy_setopt(easy, CURLOPT_ACCEPT_ENCODING, options.accept_compressed ? "" : nullptr);
+        curl_easy_setopt(easy, CURLOPT_IPRESOLVE, transfer.is_ipv4_only ? CURL_IPRESOLVE_V4 : CURL_IPRESOLVE_WHATEVER);
+#if LIBCURL_VERSION_NUM >= 0x075500
+        curl_easy_setopt(easy, CURLOPT_PROTOCOLS_STR, "http,https");
+        curl_easy_setopt(easy, CURLOPT_REDIR_PROTOCOLS_STR, "http,https");
+#else
+        curl_easy_setopt(easy, CURLOPT_PROTOCOLS, static_cast<long>(CURLPROTO_HTTP | CURLPROTO_HTTPS));
+        curl_easy_setopt(easy, CURLOPT_REDIR_PROTOCOLS, static_cast<long>(CURLPROTO_HTTP | CURLPROTO_HTTPS));
+#endif
+        if (options.use_http2)
+        {
+            // Wait for a connection that is being established to the same host, and multiplex
+            // over it, rather than opening a connection for every transfer that starts at once.
+            curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS));
+            curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+        }
+        else
+        {
+            curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_1_1));
+        }
+
+        if (!options.proxy.empty())
+        {
+            curl_easy_setopt(easy, CURLOPT_PROXY, options.proxy.c_str());
+        }
+
+        if (!options.ca_file.empty())
+        {
+            curl_easy_setopt(easy, CURLOPT_CAINFO, options.ca_file.c_str());
+        }
+
+        // A cached redirect target that fails, for example because its signature was revoked, is
+        // requested again through the URL of the request; its error response is not part of the body.
+        curl_easy_setopt(easy, CURLOPT_FAILONERROR, transfer.is_redirect_cached ? 1L : 0L);
+        curl_easy_setopt(easy, CURLOPT_NOBODY, transfer.is_prewarm ? 1L : 0L);
+
+        if (!transfer.request->post_body.empty())
+        {
+            // The body is copied, so the request does not have to outlive a retry of the transfer.
+            curl_easy_setopt(easy, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(transfer.request->post_body.size()));
+            curl_easy_setopt(easy, CURLOPT_COPYPOSTFIELDS, transfer.request->post_body.data());
+        }
+
+        curl_slist_free_all(transfer.headers);
+        transfer.headers = nullptr;
+
+        for (const std::string& header : transfer.request->headers)
+        {
+            struct curl_slist* headers = curl_slist_append(transfer.headers, header.c_str());
+            if (headers != nullptr)
+            {
+                transfer.headers = headers;
+            }
+        }
+
+        curl_easy_setopt(easy, CURLOPT_HTTPHEADER, transfer.headers);
+    }
+
+    void CurlTransport::Fetch(const std::vector<TransferRequest>&                                    requests,
+                              std::vector<TransferResult>&                                           results,
+                              const std::function<void(size_t index, const TransferResult& result)>& result_callback)
+    {
+        FetchTransfers(requests, results, result_callback, false);
+    }
+
+    void CurlTransport::FetchTransfers(const std::vector<TransferRequest>&                                    requests,
+                                       std::vector<TransferResult>&                                           results,
+                                       const std::function<void(size_t index, const TransferResult& result)>& result_callback,
+                                       bool                                                                   is_prewarm)
+    {
+        std::lock_guard<std::mutex> fetch_lock(impl_->fetch_mutex);
+
+        {
+            // The transfers of Prewarm() cannot be cancelled; the indices passed to CancelTransfer() refer to the requests of Fetch().
+            std::lock_guard<std::mutex> cancel_lock(impl_->cancel_mutex);
+            impl_->cancel_requests.clear();
+            impl_->is_cancelling_all = false;
+            impl_->is_fetching       = !is_prewarm;
+        }
+
+        results.clear();
+        results.resize(requests.size());
+
+        if (!impl_->options.tls_session_file.empty() && impl_->multi != nullptr)
+        {
+            ImportTlsSessions(impl_->options.tls_session_file);
+        }
+
+        std::vector<ActiveTransfer>                 transfers(requests.size());
+        std::vector<size_t>                         queue;
+        std::map<std::string, long>                 running_counts;
+        size_t                                      active_count         = 0;
+        long                                        new_connection_count = 0;
+        const std::chrono::steady_clock::time_point fetch_start          = std::chrono::steady_clock::now();
+
+        for (size_t i : GetStartOrder(requests))
+        {
+            TransferResult& result      = results[i];
+            result.was_successful       = false;
+            result.was_cancelled        = false;
+            result.used_cached_redirect = false;
+            result.http_status          = 0;
+            result.http_version         = 0;
+            result.body_size            = 0;
+            result.wire_size            = 0;
+            result.new_connections      = 0;
+            result.timing               = TransferTiming();
+
+            ActiveTransfer& transfer    = transfers[i];
+            transfer.index              = i;
+            transfer.easy               = nullptr;
+            transfer.request            = &requests[i];
+            transfer.result             = &result;
+            transfer.was_stopped        = false;
+            transfer.error_buffer[0]    = '\0';
+            transfer.headers            = nullptr;
+            transfer.url                = requests[i].url;
+            transfer.is_redirect_cached = (impl_->options.redirect_cache_timeout_s > 0 && requests[i].post_body.empty() && FindRedirectTarget(requests[i].url, transfer.url));
+            transfer.is_prewarm         = is_prewarm;
+            transfer.is_started         = false;
+
+            CURL* easy = nullptr;
+            if (impl_->multi != nullptr)
+            {
+                if (impl_->idle_handles.empty())
+                {
+                    easy = curl_easy_init();
+                }
+                else
+                {
+                    easy = impl_->idle_handles.back();
+                    impl_->idle_handles.pop_back();
+                    curl_easy_reset(easy);
+                }
+            }
+
+            if (easy == nullptr)
+            {
+                result.error_message.append(kStringErrorFailedToInitializeTransport);
+                if (result_callback)
+                {
+                    result_callback(i, result);
+                }
+                continue;
+            }
+
+            ConfigureTransfer(easy, transfer, impl_->options, impl_->host_address_families);
+            transfer.easy = easy;
+            queue.push_back(i);
+            ++active_count;
+        }
+
+        // Drive all transfers on this thread until they are complete. Transfers beyond the
+        // limit of their server wait in the queue until a transfer to the server is complete.
+        std::vector<size_t> cancel_requests;
+
+        StartQueuedTransfers(impl_->multi, transfers, queue, running_counts, impl_->http1_servers, impl_->options, fetch_start);
+
+        while (active_count > 0)
+        {
+            // Stop the transfers that were cancelled. Removing a transfer that shares an
+            // HTTP/2 connection resets its stream, and leaves the connection open.
+            {
+                std::lock_guard<std::mutex> cancel_lock(impl_->cancel_mutex);
+                cancel_requests.swap(impl_->cancel_requests);
+
+                if (impl_->is_closing || impl_->is_cancelling_all)
+                {
+                    for (size_t i = 0; i < transfers.size(); ++i)
+                    {
+                        cancel_requests.push_back(i);
+                    }
+                }
+            }
+
+            for (size_t index : cancel_requests)
+            {
+                if (index < transfers.size() && transfers[index].easy != nullptr)
+                {
+                    ActiveTransfer& transfer = transfers[index];
+                    if (transfer.is_started)
+                    {
+                        --running_counts[transfer.connection_key];
+                    }
+
+                    ReleaseTransfer(impl_->multi, impl_->idle_handles, transfer);
+                    --active_count;
+
+                    TransferResult& result = *transfer.result;
+                    result.was_cancelled   = true;
+                    result.error_message.append(kStringErrorTransferFailed);
+                    result.error_message.append(transfer.request->url);
+                    result.error_message.append(": ");
+                    result.error_message.append(kStringErrorTransferCancelled);
+
+                    if (result_callback)
+                    {
+                        result_callback(index, result);
+                    }
+                }
+            }
+
+            cancel_requests.clear();
+
+            int running_count = 0;
+            curl_multi_perform(impl_->multi, &running_count);
+
+            CURLMsg* message       = nullptr;
+            int      message_count = 0;
+            while ((message = curl_multi_info_read(impl_->multi, &message_count)) != nullptr)
+            {
+                if (message->msg != CURLMSG_DONE)
+                {
+                    continue;
+                }
+
+                CURL*           easy     = message->easy_handle;
+                CURLcode        code     = message->data.result;
+                ActiveTransfer* transfer = nullptr;
+                curl_easy_getinfo(easy, CURLINFO_PRIVATE, reinterpret_cast<char**>(&transfer));
+
+                UpdateRedirectTarget(easy, code, *transfer, impl_->options);
+
+                if (transfer->is_redirect_cached && code != CURLE_OK && !transfer->was_stopped && transfer->result->body_size == 0)
+                {
+                    // Nothing was received from the cached redirect target; request the URL itself instead.
+                    curl_multi_remove_handle(impl_->multi, easy);
+                    --running_counts[transfer->connection_key];
+                    transfer->url                = transfer->request->url;
+                    transfer->is_redirect_cached = false;
+                    transfer->error_buffer[0]    = '\0';
+                    ConfigureTransfer(easy, *transfer, impl_->options, impl_->host_address_families);
+                    ++running_counts[transfer->connection_key];
+                    curl_multi_add_handle(impl_->multi, easy);
+                    continue;
+                }
+
+                CompleteTransfer(easy, code, *transfer);
+                UpdateAddressFamilyPreference(code, *transfer, impl_->options);
+
+                if (code == CURLE_COULDNT_RESOLVE_HOST || code == CURLE_COULDNT_CONNECT || code == CURLE_OPERATION_TIMEDOUT)
+                {
+                    // Let the next transfer to the host choose its address family again.
+                    impl_->host_address_families.erase(transfer->host);
+                }
+
+                // Limit the transfers to servers that do not speak HTTP/2 to one per connection. Transfers that
+                // were redirected received their last response from another server.
+                if (transfer->result->http_version != 0 && GetConnectionKey(transfer->result->effective_url) == transfer->connection_key)
+                {
+                    if (transfer->result->http_version < 20)
+                    {
+                        impl_->http1_servers.insert(transfer->connection_key);
+                    }
+                    else
+                    {
+                        impl_->http1_servers.erase(transfer->connection_key);
+                    }
+                }
+
+                --running_counts[transfer->connection_key];
+                ReleaseTransfer(impl_->multi, impl_->idle_handles, *transfer);
+                --active_count;
+                new_connection_count += transfer->result->new_connections;
+
+                if (result_callback)
+                {
+                    result_callback(transfer->index, *transfer->result);
+                }
+            }
+
+            StartQueuedTransfers(impl_->multi, transfers, queue, running_counts, impl_->http1_servers, impl_->options, fetch_start);
+
+            if (active_count > 0)
+            {
+                // CancelTransfer() wakes up the wait.
+                curl_multi_poll(impl_->multi, nullptr, 0, 1000, nullptr);
+            }
+        }
+
+        // New connections may have received new TLS sessions.
+        if (!impl_->options.tls_session_file.empty() && new_connection_count > 0)
+        {
+            ExportTlsSessions(impl_->options.tls_session_file);
+        }
+
+        if (is_prewarm)
+        {
+            SharedCurlState&            shared_state = SharedCurlState::Get();
+            std::lock_guard<std::mutex> statistics_lock(shared_state.statistics_mutex);
+            shared_state.statistics.prewarmed_connections += static_cast<uint64_t>(new_connection_count);
+        }
+
+        std::lock_guard<std::mutex> cancel_lock(impl_->cancel_mutex);
+        impl_->cancel_requests.clear();
+        impl_->is_cancelling_all = false;
+        impl_->is_fetching       = false;
+    }
+
+    void CurlTransport::CancelTransfer(size_t index)
+    {
+        std::lock_guard<std::mutex> cancel_lock(impl_->cancel_mutex);
+
+        if (impl_->is_fetching)
+        {
+            impl_->cancel_requests.push_back(index);
+            curl_multi_wakeup(impl_->multi);
+        }
+    }
+
+    void CurlTransport::CancelAllTransfers()
+    {
+        std::lock_guard<std::mutex> cancel_lock(impl_->cancel_mutex);
+
+        if (impl_->is_fetching)
+        {
+            impl_->is_cancelling_all = true;
+            curl_multi_wakeup(impl_->multi);
+        }
+    }
+
+    void CurlTransport::Prewarm(const std::string& url)
+    {
+        if (impl_->multi == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> prewarm_lock(impl_->prewarm_mutex);
+        impl_->prewarm_urls.push_back(url);
+
+        if (!impl_->is_prewarming)
+        {
+            // A previous prewarm thread has finished; it only needs to be joined.
+            if (impl_->prewarm_thread.joinable())
+            {
+                impl_->prewarm_thread.join();
+            }
+
+            impl_->is_prewarming  = true;
+            impl_->prewarm_thread = std::thread(&CurlTransport::RunPrewarm, this);
+        }
+    }
+
+    void CurlTransport::RunPrewarm()
+    {
+        for (;;)
+        {
+            std::vector<TransferRequest> requests;
+            std::vector<TransferResult>  results;
+
+            {
+                std::lock_guard<std::mutex> prewarm_lock(impl_->prewarm_mutex);
+                for (const std::string& url : impl_->prewarm_urls)
+                {
+                    TransferRequest request;
+                    request.url = url;
+                    requests.push_back(request);
+                }
+
+                impl_->prewarm_urls.clear();
+                if (requests.empty())
+                {
+                    impl_->is_prewarming = false;
+                    return;
+                }
+            }
+
+            FetchTransfers(requests, results, nullptr, true);
+        }
+    }
+
+    bool CurlTransport::Fetch(const TransferRequest& request, TransferResult& result)
+    {
+        std::vector<TransferRequest> requests(1, request);
+        std::vector<TransferResult>  results;
+
+        Fetch(requests, results, nullptr);
+        result = std::move(results[0]);
+
+        return result.was_successful;
+    }
+
+    TransportStatistics CurlTransport::GetStatistics()
+    {
+        SharedCurlState&            shared_state = SharedCurlState::Get();
+        std::lock_guard<std::mutex> statistics_lock(shared_state.statistics_mutex);
+        return shared_state.statistics;
+    }
+
+    CurlTransport& CurlTransport::GetDefault()
+    {
+        static CurlTransport default_transport((TransportOptions()));
+        return default_transport;
+    }
+}  // namespace UpdateCheck
@@ -0,0 +1,361 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief An in-process HTTP/HTTPS transport built on libcurl.
+///
+/// This transport is optional; it is only built when the UpdateCheckAPI is
+/// configured with UPDATECHECKAPI_ENABLE_CURL, which also defines
+/// UPDATECHECKAPI_CURL. In that case the UpdateCheckAPI downloads files
+/// through it instead of launching the Radeon Tools Download Assistant
+/// (rtda) once per file.
+///
+/// A CurlTransport drives any number of transfers concurrently on the thread
+/// that calls Fetch(), using libcurl's multi interface. Transfers beyond the
+/// connection limit of their server wait in a queue, which serves the groups
+/// of a batch in turn. Connections are kept open between calls for reuse
+/// until they have been idle too long, and resolved host names and TLS
+/// sessions are shared by all transports in the process, so that later
+/// checks resume TLS sessions with an abbreviated handshake. Connections race IPv6 and IPv4
+/// addresses (Happy Eyeballs), and hosts where IPv4 won are then connected to
+/// over IPv4 directly for a while. Responses are requested compressed and
+/// decompressed as they arrive. Where a URL redirects to, like the signed
+/// download URL of a GitHub release asset, is remembered until the target
+/// expires, so that later transfers skip the redirect. HTTP/2 is negotiated
+/// for https:// URLs, so that concurrent transfers to the same host, like the
+/// GitHub Release API calls for many products, share a single connection.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_CURL_TRANSPORT_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_CURL_TRANSPORT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "update_check_api_shared_buffer.h"
+
+namespace UpdateCheck
+{
+    /// @brief A function that receives the body of a transfer as it arrives.
+    ///
+    /// @param [in] data The bytes of the body.
+    /// @param [in] size The number of bytes.
+    ///
+    /// @return true to continue; false to stop the transfer, which then fails.
+    typedef std::function<bool(const char* data, size_t size)> TransferDataCallback;
+
+    /// @brief A file to download.
+    struct TransferRequest
+    {
+        /// The http:// or https:// URL of the file.
+        std::string url;
+
+        /// The function that receives the body as it arrives. If it is empty, the body is collected into TransferResult::body instead.
+        TransferDataCallback data_callback;
+
+        /// The body of a POST request, like a GraphQL query; empty for a GET request.
+        std::string post_body;
+
+        /// Additional request headers, like "Authorization: bearer <token>".
+        std::vector<std::string> headers;
+
+        /// The item of a batch that the request belongs to, like a product; may be empty. Fetch() starts the requests
+        /// of different groups in turn, so that when requests wait for a connection, a group with many files does not
+        /// hold up the others.
+        std::string group;
+    };
+
+    /// @brief The duration of each phase of a transfer, in milliseconds since the transfer started.
+    ///
+    /// The phases are cumulative, so each value includes the ones before it.
+    /// Phases that were skipped, like the TLS handshake of a plain HTTP transfer
+    /// or of a reused connection, have the value of the previous phase.
+    struct TransferTiming
+    {
+        /// Until the host name was resolved.
+        double name_lookup;
+
+        /// Until the TCP connection was established.
+        double connect;
+
+        /// Until the TLS handshake was complete.
+        double tls_handshake;
+
+        /// Until the first byte of the response was received.
+        double first_byte;
+
+        /// Until the transfer was complete.
+        double total;
+
+        /// The time spent following redirects, which is included in the other values.
+        double redirect;
+
+        /// The time that the transfer waited in the queue for its server before it started, which is not included in the other values.
+        double queue;
+    };
+
+    /// @brief The outcome of a transfer.
+    struct TransferResult
+    {
+        /// True if the file was downloaded completely with a successful HTTP status.
+        bool was_successful;
+
+        /// True if the transfer was stopped by CancelTransfer().
+        bool was_cancelled;
+
+        /// True if the file was downloaded from where the URL redirected to before, without requesting the URL itself.
+        bool used_cached_redirect;
+
+        /// The HTTP status of the last response, or 0 if no response was received.
+        long http_status;
+
+        /// The HTTP version of the last response: 10, 11, 20 or 30; or 0 if no response was received.
+        int http_version;
+
+        /// The URL that the file was downloaded from, after following redirects.
+        std::string effective_url;
+
+        /// The IP address of the server that the file was downloaded from, or empty if no connection was made.
+        std::string primary_ip;
+
+        /// The Link header of the last response, which paginated APIs like the GitHub Release API use to point to the other pages; empty if there was none.
+        std::string link_header;
+
+        /// The Content-Type header of the last response, which tells the encoding of a version file that was negotiated with the Accept header; empty if there was none.
+        std::string content_type;
+
+        /// The body of the response, unless the request had a data_callback.
+        UpdateCheckApiUtils::SharedBuffer body;
+
+        /// The number of bytes of the body.
+        uint64_t body_size;
+
+        /// The number of bytes of the body as it was sent by the server; smaller than body_size if it was compressed.
+        uint64_t wire_size;
+
+        /// The number of new connections that the transfer opened; 0 if it reused a connection.
+        long new_connections;
+
+        /// The duration of each phase of the transfer.
+        TransferTiming timing;
+
+        /// A description of the error if was_successful is false.
+        std::string error_message;
+    };
+
+    /// @brief Totals over the transfers of all transports in the process.
+    struct TransportStatistics
+    {
+        /// The number of transfers that completed, successfully or not.
+        uint64_t transfers;
+
+        /// The number of connections that were opened.
+        uint64_t new_connections;
+
+        /// The number of bytes of the bodies that were received.
+        uint64_t body_bytes;
+
+        /// The number of bytes of the bodies as they were sent by the servers, before decompression.
+        uint64_t wire_bytes;
+
+        /// The number of TLS handshakes, full or resumed.
+        uint64_t tls_handshakes;
+
+        /// The total duration of the TLS handshakes, in milliseconds.
+        double tls_handshake_time;
+
+        /// The number of TLS sessions that were loaded from a tls_session_file.
+        uint64_t tls_sessions_imported;
+
+        /// The number of TLS sessions that were saved to a tls_session_file.
+        uint64_t tls_sessions_exported;
+
+        /// The number of transfers that connected over IPv4 directly, because IPv4 won the previous race to their host.
+        uint64_t ipv4_preferred_transfers;
+
+        /// The number of transfers that went to a cached redirect target directly, skipping the redirect.
+        uint64_t redirects_skipped;
+
+        /// The number of cached redirect targets that failed, after which their URLs were requested again.
+        uint64_t redirect_targets_failed;
+
+        /// The number of connections that were opened ahead of time by Prewarm().
+        uint64_t prewarmed_connections;
+    };
+
+    /// @brief Settings of a CurlTransport.
+    struct TransportOptions
+    {
+        /// @brief Constructor that sets the default values.
+        TransportOptions();
+
+        /// The maximum number of open connections; further transfers wait for one to become available. 0 for no limit. Default 64.
+        long max_connections;
+
+        /// The maximum number of open connections to a single host. 0 for no limit. Default 8.
+        /// Transfers beyond this limit wait in a queue until a connection to the host is available.
+        long max_host_connections;
+
+        /// The maximum number of idle connections that are kept open for reuse; the least recently used ones are closed first. Default 16.
+        long max_idle_connections;
+
+        /// How long a connection may be idle and still be reused, in seconds; older connections are closed instead. Default 60.
+        /// Before a connection is reused, libcurl also checks that the server has not closed it.
+        long max_idle_time_s;
+
+        /// The time allowed to establish a connection, in milliseconds. 0 for libcurl's default. Default 15000.
+        long connect_timeout_ms;
+
+        /// The time allowed for an entire transfer, including waiting for a connection, in milliseconds. 0 for no limit. Default 60000.
+        long transfer_timeout_ms;
+
+        /// The maximum number of redirects to follow. Default 10.
+        long max_redirects;
+
+        /// How long a connection attempt to the first IPv6 address may take before an IPv4 address is tried in parallel,
+        /// in milliseconds. Default 250, the Connection Attempt Delay that RFC 8305 recommends.
+        long happy_eyeballs_delay_ms;
+
+        /// How long resolved host names are kept, in seconds; -1 to keep them forever. Default 60.
+        long dns_cache_timeout_s;
+
+        /// How long to connect to a host over IPv4 only after IPv4 won the race to it, in seconds; 0 to always race. Default 600.
+        long ipv4_preference_timeout_s;
+
+        /// How long to remember where a URL redirected to, in seconds; 0 to always follow redirects. Default 300.
+        /// A target is forgotten sooner when the redirect response or the signed target URL expires, and if downloading
+        /// from a remembered target fails, the URL is requested again.
+        long redirect_cache_timeout_s;
+
+        /// True to ask servers to compress responses with any encoding that libcurl can decode, such as gzip and zstd.
+        /// Bodies are decompressed as they arrive, so TransferResult::body and the data_callback receive the original bytes.
+        /// Default true.
+        bool accept_compressed;
+
+        /// True to negotiate HTTP/2 for https:// URLs, and to send concurrent transfers to the same host over one connection. Default true.
+        bool use_http2;
+
+        /// The maximum number of concurrent transfers over one HTTP/2 connection. Default 100.
+        long max_streams_per_connection;
+
+        /// The proxy to use, for example "http://proxy:8080". If empty, the http_proxy, https_proxy and no_proxy environment variables apply.
+        std::string proxy;
+
+        /// The User-Agent header to send. GitHub rejects API requests without one.
+        std::string user_agent;
+
+        /// A file of certificate authorities to verify servers with, in PEM format. If empty, the system's certificate authorities are used.
+        std::string ca_file;
+
+        /// A file to keep TLS sessions in between processes, so that the first connection of a later process resumes a session
+        /// with an abbreviated handshake. The sessions are keyed by a salted hash instead of the host name, but they allow
+        /// resuming connections, so the file should be private to the user. If empty, TLS sessions are only kept in memory.
+        /// The file is only used with libcurl 8.12 or newer, built with SSL session export.
+        std::string tls_session_file;
+    };
+
+    /// @brief Downloads files over HTTP and HTTPS within the process.
+    ///
+    /// A transport may be used by one thread at a time; concurrent calls to
+    /// Fetch() on the same transport are serialized.
+    class CurlTransport
+    {
+    public:
+        /// @brief Constructor.
+        ///
+        /// @param [in] options The settings of the transport.
+        explicit CurlTransport(const TransportOptions& options);
+
+        /// @brief Destructor. Closes all connections.
+        ~CurlTransport();
+
+        /// @brief Check whether the transport was initialized successfully.
+        ///
+        /// @return true if the transport can be used; false if libcurl could not be initialized.
+        bool IsValid() const;
+
+        /// @brief Download several files concurrently, and wait until all of them are complete.
+        ///
+        /// @param [in]  requests        The files to download.
+        /// @param [out] results         The outcome of each request, in the same order as the requests.
+        /// @param [in]  result_callback A function to call as soon as each transfer is complete, with the index of its request; may be empty.
+        void Fetch(const std::vector<TransferRequest>&                                requests,
+                   std::vector<TransferResult>&                                       results,
+                   const std::function<void(size_t index, const TransferResult& result)>& result_callback);
+
+        /// @brief Stop a transfer of the Fetch() call that is in progress.
+        ///
+        /// This may be called from any thread, including from a callback of
+        /// Fetch(). The transfer completes with was_cancelled set. If it shares
+        /// an HTTP/2 connection, only its stream is reset, and the other
+        /// transfers continue on the connection. Returning false from a
+        /// data_callback stops a transfer in the same way.
+        ///
+        /// @param [in] index The index of the request; requests that are already complete, or out of range, are ignored.
+        void CancelTransfer(size_t index);
+
+        /// @brief Stop all transfers of the Fetch() call that is in progress, like CancelTransfer() does for one.
+        ///
+        /// Calls to Fetch() that start afterwards are not affected.
+        void CancelAllTransfers();
+
+        /// @brief Start opening a connection to the server of a URL in the background, for a later Fetch() of the URL.
+        ///
+        /// This returns immediately. The host name is resolved, and a connection
+        /// is established with a HEAD request for the URL, on a thread that the
+        /// transport owns; the connection then stays open for reuse, so that a
+        /// Fetch() that follows starts without waiting for DNS, TCP and TLS.
+        /// Servers may count the HEAD request like any other request. A Fetch()
+        /// that is called while the connection is still being established waits
+        /// for it instead of opening another one.
+        ///
+        /// @param [in] url The http:// or https:// URL that is going to be fetched.
+        void Prewarm(const std::string& url);
+
+        /// @brief Download a single file.
+        ///
+        /// @param [in]  request The file to download.
+        /// @param [out] result  The outcome of the request.
+        ///
+        /// @return The value of result.was_successful.
+        bool Fetch(const TransferRequest& request, TransferResult& result);
+
+        /// @brief Get the totals over the transfers of all transports in the process.
+        ///
+        /// @return The statistics.
+        static TransportStatistics GetStatistics();
+
+        /// @brief Get the transport that the UpdateCheckAPI uses for its own downloads.
+        ///
+        /// @return The transport, which is created with the default options on first use.
+        static CurlTransport& GetDefault();
+
+    private:
+        CurlTransport(const CurlTransport&)            = delete;
+        CurlTransport& operator=(const CurlTransport&) = delete;
+
+        /// @brief Run transfers until all of them are complete.
+        ///
+        /// @param [in]  requests        The files to download.
+        /// @param [out] results         The outcome of each request.
+        /// @param [in]  result_callback A function to call as soon as each transfer is complete; may be empty.
+        /// @param [in]  is_prewarm      True to only request the headers, to open connections for Prewarm().
+        void FetchTransfers(const std::vector<TransferRequest>&                                requests,
+                            std::vector<TransferResult>&                                       results,
+                            const std::function<void(size_t index, const TransferResult& result)>& result_callback,
+                            bool                                                               is_prewarm);
+
+        /// @brief Open the connections that Prewarm() was called for; runs on the prewarm thread.
+        void RunPrewarm();
+
+        struct Impl;
+
+        /// The libcurl state.
+        std::unique_ptr<Impl> impl_;
+    };
+}  // namespace UpdateCheck
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_CURL_TRANSPORT_H_
@@ -0,0 +1,411 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Resolves the JSON files of many GitHub releases with one GraphQL query.
+//==============================================================================
+#include "update_check_api_github_graphql.h"
+#include "update_check_api_curl_transport.h"
+#include "update_check_api_json_tape.h"
+#include "update_check_api_strings.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+using UpdateCheckApiJson::JsonTape;
+using UpdateCheckApiJson::JsonValue;
+
+namespace UpdateCheck
+{
+    /// @brief A download URL that a GraphQL query resolved.
+    struct ResolvedAsset
+    {
+        /// The URL to download the JSON file from.
+        std::string download_url;
+
+        /// When CheckForUpdates() stops using the URL.
+        std::chrono::steady_clock::time_point valid_until;
+    };
+
+    // The resolved download URLs, by latest releases url and json file name.
+    static std::map<std::string, ResolvedAsset> resolved_assets;
+
+    // The mutex that protects resolved_assets.
+    static std::mutex resolved_assets_mutex;
+
+    GithubGraphqlOptions::GithubGraphqlOptions()
+        : graphql_url(kStringGithubGraphqlUrl)
+        , max_repositories_per_query(50)
+        , resolved_asset_timeout_s(300)
+    {
+    }
+
+    /// @brief Get the key of a check in resolved_assets.
+    static std::string GetResolvedAssetKey(const std::string& latest_releases_url, const std::string& json_filename)
+    {
+        return latest_releases_url + '\n' + json_filename;
+    }
+
+    /// @brief Append a string to a JSON document as a quoted and escaped JSON string.
+    ///
+    /// @param [in,out] json  The JSON document.
+    /// @param [in]     value The string.
+    static void AppendJsonString(std::string& json, const std::string& value)
+    {
+        json.push_back('"');
+
+        for (char c : value)
+        {
+            if (c == '"' || c == '\\')
+            {
+                json.push_back('\\');
+                json.push_back(c);
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+                json.append(escaped);
+            }
+            else
+            {
+                json.push_back(c);
+            }
+        }
+
+        json.push_back('"');
+    }
+
+    /// @brief Get the owner and name of the repository of a GitHub latest releases url.
+    ///
+    /// @param [in]  latest_releases_url A URL like https://api.github.com/repos/OWNER/REPOSITORY/releases/latest.
+    /// @param [out] owner               The owner of the repository.
+    /// @param [out] name                The name of the repository.
+    ///
+    /// @return true if the URL names a repository; false otherwise.
+    static bool GetRepositoryFromUrl(const std::string& latest_releases_url, std::string& owner, std::string& name)
+    {
+        bool   is_repository_url = false;
+        size_t path_start        = latest_releases_url.find(kStringGithubRepositoriesPath);
+        size_t path_end          = latest_releases_url.rfind(kStringGithubReleasesLatest);
+
+        if (path_start != std::string::npos && path_end != std::string::npos)
+        {
+            path_start += strlen(kStringGithubRepositoriesPath);
+
+            if (path_start < path_end)
+            {
+                const std::string path      = latest_releases_url.substr(path_start, path_end - path_start);
+                const size_t      separator = path.find('/');
+
+                if (separator != std::string::npos && path.find('/', separator + 1) == std::string::npos)
+                {
+                    owner             = path.substr(0, separator);
+                    name              = path.substr(separator + 1);
+                    is_repository_url = !owner.empty() && !name.empty();
+                }
+            }
+        }
+
+        return is_repository_url;
+    }
+
+    /// @brief Build the body of a GraphQL query for the latest release assets of some repositories.
+    ///
+    /// Each repository gets the alias rN, where N is its position in the query. The owners, names
+    /// and asset names are passed as variables, so they never need to be escaped inside the query.
+    ///
+    /// @param [in] owners      The owners of the repositories.
+    /// @param [in] names       The names of the repositories.
+    /// @param [in] asset_names The names of the assets.
+    ///
+    /// @return The JSON body of the POST request.
+    static std::string BuildQueryBody(const std::vector<std::string>& owners, const std::vector<std::string>& names, const std::vector<std::string>& asset_names)
+    {
+        std::string parameters;
+        std::string selections;
+        std::string variables;
+
+        for (size_t i = 0; i < owners.size(); ++i)
+        {
+            const std::string n = std::to_string(i);
+
+            parameters += (i == 0 ? "" : ",") + std::string("$o") + n + ":String!,$n" + n + ":String!,$a" + n + ":String!";
+            selections += "r" + n + ":repository(owner:$o" + n + ",name:$n" + n + "){latestRelease{tagName releaseAssets(first:1,name:$a" + n +
+                          "){nodes{downloadUrl}}}}";
+
+            for (const std::pair<const char*, const std::string*>& variable :
+                 {std::make_pair("o", &owners[i]), std::make_pair("n", &names[i]), std::make_pair("a", &asset_names[i])})
+            {
+                variables += variables.empty() ? "\"" : ",\"";
+                variables += variable.first + n + "\":";
+                AppendJsonString(variables, *variable.second);
+            }
+        }
+
+        std::string body = "{\"query\":";
+        AppendJsonString(body, "query(" + parameters + "){" + selections + "}");
+        body += ",\"variables\":{" + variables + "}}";
+
+        return body;
+    }
+
+    /// @brief Fill in the assets of the repositories of a query from its response.
+    ///
+    /// @param [in]  result        The response to the query.
+    /// @param [in]  indices       The index of the request of each repository of the query.
+    /// @param [out] assets        The assets of all requests.
+    /// @param [out] error_message Any error messages if the query failed as a whole.
+    ///
+    /// @return true if the query was answered; false otherwise.
+    static bool ParseQueryResponse(const TransferResult& result, const std::vector<size_t>& indices, std::vector<LatestReleaseAsset>& assets, std::string& error_message)
+    {
+        JsonTape    response_tape;
+        std::string parse_error_message;
+        std::string query_error_message;
+
+        bool      is_parsed = response_tape.Parse(result.body.Data(), result.body.Size(), false, parse_error_message);
+        JsonValue data      = is_parsed ? response_tape.Root().Find(kStringTagData) : JsonValue();
+
+        if (!result.was_successful || !data.IsObject())
+        {
+            query_error_message = result.was_successful ? parse_error_message : result.error_message;
+
+            // Errors like a missing or rejected token come with a message, like those of the REST API.
+            std::string message;
+            JsonValue   root = is_parsed ? response_tape.Root() : JsonValue();
+
+            if (root.Find(kStringTagMessage).GetString(message))
+            {
+                query_error_message += (query_error_message.empty() ? "" : " ") + message;
+            }
+
+            for (const JsonValue& error : root.Find(kStringTagErrors))
+            {
+                if (error.Find(kStringTagMessage).GetString(message))
+                {
+                    query_error_message += (query_error_message.empty() ? "" : " ") + message;
+                }
+            }
+        }
+
+        if (!query_error_message.empty() || !data.IsObject())
+        {
+            for (size_t index : indices)
+            {
+                assets[index].error_message = kStringErrorGraphqlQueryFailed + query_error_message;
+            }
+
+            error_message.append(kStringErrorGraphqlQueryFailed);
+            error_message.append(query_error_message);
+            return false;
+        }
+
+        // Repositories that do not exist are null, and come with an error whose path is their alias.
+        std::vector<std::string> repository_errors(indices.size());
+
+        for (const JsonValue& error : response_tape.Root().Find(kStringTagErrors))
+        {
+            JsonValue::Iterator path = error.Find(kStringTagPath).begin();
+            std::string         alias;
+
+            if (path != error.Find(kStringTagPath).end() && (*path).GetString(alias) && alias.size() > 1 && alias[0] == 'r')
+            {
+                size_t position = strtoul(alias.c_str() + 1, nullptr, 10);
+
+                if (position < indices.size())
+                {
+                    error.Find(kStringTagMessage).GetString(repository_errors[position]);
+                }
+            }
+        }
+
+        std::vector<bool> is_answered(indices.size(), false);
+
+        for (JsonValue::Iterator member = data.begin(); member != data.end(); ++member)
+        {
+            std::string alias;
+            if (!member.Key().GetString(alias) || alias.size() < 2 || alias[0] != 'r')
+            {
+                continue;
+            }
+
+            size_t position = strtoul(alias.c_str() + 1, nullptr, 10);
+            if (position >= indices.size())
+            {
+                continue;
+            }
+
+            LatestReleaseAsset& asset   = assets[indices[position]];
+            JsonValue           release = (*member).Find(kStringTagLatestRelease);
+            is_answered[position]       = (*member).IsObject();
+
+            if (!is_answered[position])
+            {
+                continue;
+            }
+
+            if (!release.IsObject())
+            {
+                asset.error_message = kStringErrorRepositoryHasNoLatestRelease;
+                continue;
+            }
+
+            release.Find(kStringTagTagName).GetString(asset.tag_name);
+
+            JsonValue nodes = release.Find(kStringTagReleaseAssets).Find(kStringTagNodes);
+
+            if (nodes.begin() != nodes.end() && (*nodes.begin()).Find(kStringTagDownloadUrl).GetString(asset.download_url))
+            {
+                asset.was_resolved = true;
+            }
+            else
+            {
+                asset.error_message = kStringErrorAssetNotFound;
+            }
+        }
+
+        for (size_t position = 0; position < indices.size(); ++position)
+        {
+            if (!is_answered[position])
+            {
+                assets[indices[position]].error_message = repository_errors[position].empty() ? kStringErrorRepositoryNotInResponse : repository_errors[position];
+            }
+        }
+
+        return true;
+    }
+
+    bool ResolveLatestReleaseAssets(const std::vector<LatestReleaseAssetRequest>& requests,
+                                    const GithubGraphqlOptions&                   options,
+                                    std::vector<LatestReleaseAsset>&              assets,
+                                    std::string&                                  error_message)
+    {
+        bool is_answered = true;
+
+        assets.clear();
+        assets.resize(requests.size());
+
+        // Group the requests into queries of at most max_repositories_per_query repositories.
+        std::vector<TransferRequest>     queries;
+        std::vector<std::vector<size_t>> query_indices;
+        std::vector<std::string>         owners;
+        std::vector<std::string>         names;
+        std::vector<std::string>         asset_names;
+        const size_t                     batch_size = (options.max_repositories_per_query > 0) ? options.max_repositories_per_query : 1;
+
+        for (size_t i = 0; i <= requests.size(); ++i)
+        {
+            if (i == requests.size() || owners.size() == batch_size)
+            {
+                if (!owners.empty())
+                {
+                    TransferRequest query;
+                    query.url       = options.graphql_url;
+                    query.post_body = BuildQueryBody(owners, names, asset_names);
+                    query.headers.push_back("Content-Type: application/json");
+
+                    if (!options.access_token.empty())
+                    {
+                        query.headers.push_back("Authorization: bearer " + options.access_token);
+                    }
+
+                    queries.push_back(query);
+                    owners.clear();
+                    names.clear();
+                    asset_names.clear();
+                }
+
+                if (i == requests.size())
+                {
+                    break;
+                }
+            }
+
+            LatestReleaseAsset& asset = assets[i];
+            asset.was_resolved        = false;
+
+            std::string owner;
+            std::string name;
+
+            if (!GetRepositoryFromUrl(requests[i].latest_releases_url, owner, name))
+            {
+                asset.error_message = kStringErrorNotALatestReleaseUrl + requests[i].latest_releases_url;
+                continue;
+            }
+
+            if (owners.empty())
+            {
+                query_indices.push_back(std::vector<size_t>());
+            }
+
+            owners.push_back(owner);
+            names.push_back(name);
+            asset_names.push_back(requests[i].json_filename);
+            query_indices.back().push_back(i);
+        }
+
+        // Send the queries concurrently; over HTTP/2 they share one connection.
+        std::vector<TransferResult> results;
+        CurlTransport::GetDefault().Fetch(queries, results, nullptr);
+
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            if (!ParseQueryResponse(results[i], query_indices[i], assets, error_message))
+            {
+                is_answered = false;
+            }
+        }
+
+        if (options.resolved_asset_timeout_s > 0)
+        {
+            const auto                  valid_until = std::chrono::steady_clock::now() + std::chrono::seconds(options.resolved_asset_timeout_s);
+            std::lock_guard<std::mutex> lock(resolved_assets_mutex);
+
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                if (assets[i].was_resolved)
+                {
+                    ResolvedAsset& resolved_asset = resolved_assets[GetResolvedAssetKey(requests[i].latest_releases_url, requests[i].json_filename)];
+                    resolved_asset.download_url   = assets[i].download_url;
+                    resolved_asset.valid_until    = valid_until;
+                }
+            }
+        }
+
+        return is_answered;
+    }
+
+    bool FindResolvedLatestReleaseAsset(const std::string& latest_releases_url, const std::string& json_filename, std::string& download_url)
+    {
+        bool                        is_found = false;
+        std::lock_guard<std::mutex> lock(resolved_assets_mutex);
+
+        auto resolved_asset = resolved_assets.find(GetResolvedAssetKey(latest_releases_url, json_filename));
+
+        if (resolved_asset != resolved_assets.end())
+        {
+            if (resolved_asset->second.valid_until > std::chrono::steady_clock::now())
+            {
+                download_url = resolved_asset->second.download_url;
+                is_found     = true;
+            }
+            else
+            {
+                resolved_assets.erase(resolved_asset);
+            }
+        }
+
+        return is_found;
+    }
+
+    void ForgetResolvedLatestReleaseAsset(const std::string& latest_releases_url, const std::string& json_filename)
+    {
+        std::lock_guard<std::mutex> lock(resolved_assets_mutex);
+        resolved_assets.erase(GetResolvedAssetKey(latest_releases_url, json_filename));
+    }
+}  // namespace UpdateCheck
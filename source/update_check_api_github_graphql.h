@@ -0,0 +1,104 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Resolves the JSON files of many GitHub releases with one GraphQL query.
+///
+/// A check of a GitHub latest releases URL first requests the latest release
+/// from the REST API to find the download URL of its JSON file, so checking N
+/// products costs N requests that count against the rate limit. The GraphQL
+/// API returns the matching asset of the latest release of many repositories
+/// in a single query. ResolveLatestReleaseAssets() sends that query, and
+/// remembers the download URLs it finds for a while; CheckForUpdates() then
+/// downloads the JSON files of those checks directly, without the REST request.
+///
+/// This needs the in-process transport, because the query is a POST request.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_GITHUB_GRAPHQL_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_GITHUB_GRAPHQL_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace UpdateCheck
+{
+    /// @brief A check whose JSON file is an asset of the latest release of a GitHub repository.
+    struct LatestReleaseAssetRequest
+    {
+        /// The latest releases url, like https://api.github.com/repos/OWNER/REPOSITORY/releases/latest.
+        std::string latest_releases_url;
+
+        /// The json file name, which is the name of the asset.
+        std::string json_filename;
+    };
+
+    /// @brief Where the JSON file of a check can be downloaded from.
+    struct LatestReleaseAsset
+    {
+        /// True if the asset was found in the latest release.
+        bool was_resolved;
+
+        /// The tag of the latest release.
+        std::string tag_name;
+
+        /// The URL to download the asset from.
+        std::string download_url;
+
+        /// A description of the error if was_resolved is false.
+        std::string error_message;
+    };
+
+    /// @brief Options for querying the GitHub GraphQL API.
+    struct GithubGraphqlOptions
+    {
+        /// @brief Constructor that sets the default values.
+        GithubGraphqlOptions();
+
+        /// The URL of the GraphQL API. Default https://api.github.com/graphql.
+        std::string graphql_url;
+
+        /// The token that authorizes the query; the GraphQL API does not answer anonymous queries.
+        std::string access_token;
+
+        /// The largest number of repositories in one query; larger batches are split into queries that are sent concurrently. Default 50.
+        size_t max_repositories_per_query;
+
+        /// How long CheckForUpdates() downloads a resolved asset directly, in seconds; 0 to not remember it. Default 300.
+        /// If downloading it fails, the latest release is requested from the REST API as before.
+        long resolved_asset_timeout_s;
+    };
+
+    /// @brief Resolve the JSON files of many checks of GitHub latest releases URLs with batched GraphQL queries.
+    ///
+    /// The assets are looked up by name in the latest release of each repository,
+    /// which is the release that the REST API returns for the latest releases URL.
+    ///
+    /// @param [in]  requests      The checks to resolve.
+    /// @param [in]  options       The endpoint, token and limits of the queries.
+    /// @param [out] assets        The asset of each request, in the same order.
+    /// @param [out] error_message Any error messages of queries that failed as a whole.
+    ///
+    /// @return true if all queries were answered, even if some repositories or assets were not found; false otherwise.
+    bool ResolveLatestReleaseAssets(const std::vector<LatestReleaseAssetRequest>& requests,
+                                    const GithubGraphqlOptions&                   options,
+                                    std::vector<LatestReleaseAsset>&              assets,
+                                    std::string&                                  error_message);
+
+    /// @brief Find the download URL of the JSON file of a check that ResolveLatestReleaseAssets() resolved recently.
+    ///
+    /// @param [in]  latest_releases_url The latest releases url.
+    /// @param [in]  json_filename       The json file name.
+    /// @param [out] download_url        The URL to download the JSON file from.
+    ///
+    /// @return true if the check was resolved and has not expired; false otherwise.
+    bool FindResolvedLatestReleaseAsset(const std::string& latest_releases_url, const std::string& json_filename, std::string& download_url);
+
+    /// @brief Forget the resolved download URL of a check, for example because downloading from it failed.
+    ///
+    /// @param [in] latest_releases_url The latest releases url.
+    /// @param [in] json_filename       The json file name.
+    void ForgetResolvedLatestReleaseAsset(const std::string& latest_releases_url, const std::string& json_filename);
+}  // namespace UpdateCheck
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_GITHUB_GRAPHQL_H_
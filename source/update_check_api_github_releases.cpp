@@ -0,0 +1,496 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Finds the newest release of each channel in the release list of a GitHub repository.
+//==============================================================================
+#include "update_check_api_github_releases.h"
+#include "update_check_api_curl_transport.h"
+#include "update_check_api_json_tape.h"
+#include "update_check_api_strings.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+using UpdateCheckApiJson::JsonSpan;
+using UpdateCheckApiJson::JsonStreamScanner;
+using UpdateCheckApiJson::JsonTape;
+using UpdateCheckApiJson::JsonValue;
+
+namespace UpdateCheck
+{
+    // The page of a channel that has not been found.
+    static const size_t kNoPage = std::numeric_limits<size_t>::max();
+
+    // The most releases that the GitHub Release API returns per page.
+    static const size_t kMaxReleasesPerPage = 100;
+
+    /// @brief A page of the release list, which is searched while it is being received.
+    struct ReleasePage
+    {
+        /// @brief Constructor.
+        ReleasePage()
+            : scanner("")
+            , searched_elements(0)
+            , is_complete(false)
+        {
+        }
+
+        /// The contents of the page received so far.
+        std::string body;
+
+        /// Locates the releases of the page in the body.
+        JsonStreamScanner scanner;
+
+        /// The number of releases of the page that have been searched.
+        size_t searched_elements;
+
+        /// True once the page has been received in full.
+        bool is_complete;
+    };
+
+    /// @brief Where the newest release of a channel with an asset was found so far.
+    struct ChannelMatch
+    {
+        /// The index of the page, or kNoPage if no release of the channel with the asset has been found.
+        size_t page;
+
+        /// The index of the release on the page.
+        size_t element;
+    };
+
+    /// @brief The state of a search of the release list.
+    ///
+    /// The search looks for several releases at once, each the newest release of a
+    /// channel that carries a JSON file.
+    struct ReleaseListSearch
+    {
+        /// The channel of each release to find.
+        std::vector<std::string> channels;
+
+        /// The json file name that each release to find carries, which is the name of an asset.
+        std::vector<std::string> json_filenames;
+
+        /// Where each release was found so far.
+        std::vector<ChannelMatch> matches;
+
+        /// Each release, which is final once it is settled.
+        std::vector<ChannelRelease>* releases;
+
+        /// The pages, by page number minus one.
+        std::vector<ReleasePage> pages;
+
+        /// True once every release has been found on a page that no earlier page can outrank.
+        bool is_settled;
+    };
+
+    GithubReleasesOptions::GithubReleasesOptions()
+        : releases_per_page(kMaxReleasesPerPage)
+        , max_pages(10)
+        , max_concurrent_pages(4)
+    {
+    }
+
+    std::string GetReleaseChannel(const std::string& tag_name, bool is_prerelease)
+    {
+        std::string channel = is_prerelease ? kStringPrereleaseChannel : kStringStableChannel;
+
+        for (size_t i = 1; is_prerelease && i < tag_name.size(); ++i)
+        {
+            if (tag_name[i] == '-' && std::isdigit(static_cast<unsigned char>(tag_name[i - 1])))
+            {
+                size_t end = i + 1;
+                while (end < tag_name.size() && std::isalpha(static_cast<unsigned char>(tag_name[end])))
+                {
+                    ++end;
+                }
+
+                if (end > i + 1)
+                {
+                    channel = tag_name.substr(i + 1, end - i - 1);
+                    std::transform(channel.begin(), channel.end(), channel.begin(), ::tolower);
+                }
+
+                break;
+            }
+        }
+
+        return channel;
+    }
+
+    /// @brief Get the number of the page that a relation of a Link header points to.
+    ///
+    /// @param [in] link_header The Link header, like <https://api.github.com/...?per_page=100&page=5>; rel="last".
+    /// @param [in] relation    The relation, like rel="last".
+    ///
+    /// @return The page number; 0 if the header does not have the relation.
+    static size_t GetLinkedPage(const std::string& link_header, const char* relation)
+    {
+        size_t page              = 0;
+        size_t relation_position = link_header.find(relation);
+
+        if (relation_position != std::string::npos)
+        {
+            size_t url_start = link_header.rfind('<', relation_position);
+            size_t url_end   = link_header.find('>', url_start);
+
+            if (url_start != std::string::npos && url_end != std::string::npos && url_end < relation_position)
+            {
+                const std::string url = link_header.substr(url_start + 1, url_end - url_start - 1);
+
+                for (const char* parameter : {"?page=", "&page="})
+                {
+                    size_t parameter_position = url.find(parameter);
+                    if (parameter_position != std::string::npos)
+                    {
+                        page = strtoul(url.c_str() + parameter_position + strlen(parameter), nullptr, 10);
+                    }
+                }
+            }
+        }
+
+        return page;
+    }
+
+    /// @brief Search the releases of a page that have been received since the previous call.
+    ///
+    /// @param [in,out] search The search.
+    /// @param [in]     page   The index of the page.
+    static void SearchReceivedReleases(ReleaseListSearch& search, size_t page)
+    {
+        ReleasePage& release_page = search.pages[page];
+        release_page.scanner.Scan(release_page.body.data(), release_page.body.size());
+
+        for (; release_page.searched_elements < release_page.scanner.GetElementCount(); ++release_page.searched_elements)
+        {
+            const size_t    element = release_page.searched_elements;
+            const JsonSpan& span    = release_page.scanner.GetElement(element);
+            JsonTape        release_tape;
+            std::string     parse_error_message;
+
+            if (!release_tape.Parse(release_page.body.data() + span.offset, span.length, false, parse_error_message))
+            {
+                continue;
+            }
+
+            JsonValue   release       = release_tape.Root();
+            bool        is_draft      = false;
+            bool        is_prerelease = false;
+            std::string tag_name;
+
+            release.Find(kStringTagDraft).GetBool(is_draft);
+            release.Find(kStringTagPrerelease).GetBool(is_prerelease);
+
+            if (is_draft || !release.Find(kStringTagReleaseTagName).GetString(tag_name))
+            {
+                continue;
+            }
+
+            const std::string channel = GetReleaseChannel(tag_name, is_prerelease);
+
+            for (size_t i = 0; i < search.channels.size(); ++i)
+            {
+                // Releases are listed newest first, so only a release on an earlier page can replace a match.
+                ChannelMatch& match = search.matches[i];
+                if (search.channels[i] != channel || (match.page != kNoPage && match.page <= page))
+                {
+                    continue;
+                }
+
+                for (const JsonValue& asset : release.Find(kStringTagAssets))
+                {
+                    ChannelRelease& channel_release = (*search.releases)[i];
+
+                    if (asset.Find(kStringTagAssetName).Equals(search.json_filenames[i].c_str()) &&
+                        asset.Find(kStringTagAssetBrowserDownloadUrl).GetString(channel_release.download_url))
+                    {
+                        channel_release.is_prerelease = is_prerelease;
+                        channel_release.tag_name      = tag_name;
+                        match.page                    = page;
+                        match.element                 = element;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    /// @brief Check whether a release was found on a page that no earlier page can outrank.
+    ///
+    /// @return true if the release was found, and all earlier pages have been received in full.
+    static bool IsChannelSettled(const ReleaseListSearch& search, size_t release)
+    {
+        const size_t page       = search.matches[release].page;
+        bool         is_settled = (page != kNoPage);
+
+        for (size_t i = 0; is_settled && i < page; ++i)
+        {
+            is_settled = search.pages[i].is_complete;
+        }
+
+        return is_settled;
+    }
+
+    /// @brief Check whether every release is settled.
+    ///
+    /// @return true if no page that is still in flight, or not requested yet, can contain a newer release of any channel.
+    static bool IsSearchSettled(const ReleaseListSearch& search)
+    {
+        bool is_settled = true;
+
+        for (size_t i = 0; is_settled && i < search.channels.size(); ++i)
+        {
+            is_settled = IsChannelSettled(search, i);
+        }
+
+        return is_settled;
+    }
+
+    /// @brief Download some pages of the release list concurrently, and search them as they arrive.
+    ///
+    /// The downloads that are still in flight are cancelled as soon as the search is settled.
+    ///
+    /// @param [in,out] search        The search.
+    /// @param [in]     page_urls     The URL of each page.
+    /// @param [in]     first_page    The index of the first page.
+    /// @param [in]     options       The token of the requests.
+    /// @param [out]    link_header   The Link header of the first page.
+    /// @param [out]    is_end        true if a page was empty, which means that the list ended.
+    /// @param [out]    error_message Any error messages of pages that could not be downloaded.
+    ///
+    /// @return true if all pages were received or cancelled; false otherwise.
+    static bool FetchReleasePages(ReleaseListSearch&              search,
+                                  const std::vector<std::string>& page_urls,
+                                  size_t                          first_page,
+                                  const GithubReleasesOptions&    options,
+                                  std::string&                    link_header,
+                                  bool&                           is_end,
+                                  std::string&                    error_message)
+    {
+        bool           is_listed = true;
+        CurlTransport& transport = CurlTransport::GetDefault();
+
+        search.pages.resize(first_page + page_urls.size());
+
+        std::vector<TransferRequest> requests(page_urls.size());
+
+        // Once the search is settled, the pages that are still in flight can only contain older releases.
+        auto cancel_if_settled = [&search, &transport, &requests, first_page]() {
+            if (!search.is_settled && IsSearchSettled(search))
+            {
+                search.is_settled = true;
+
+                for (size_t i = 0; i < requests.size(); ++i)
+                {
+                    if (!search.pages[first_page + i].is_complete)
+                    {
+                        transport.CancelTransfer(i);
+                    }
+                }
+            }
+        };
+
+        for (size_t i = 0; i < page_urls.size(); ++i)
+        {
+            const size_t page = first_page + i;
+
+            requests[i].url = page_urls[i];
+            requests[i].headers.push_back("Accept: application/vnd.github+json");
+
+            if (!options.access_token.empty())
+            {
+                requests[i].headers.push_back("Authorization: bearer " + options.access_token);
+            }
+
+            requests[i].data_callback = [&search, &cancel_if_settled, page](const char* data, size_t size) {
+                if (search.is_settled)
+                {
+                    return false;
+                }
+
+                search.pages[page].body.append(data, size);
+                SearchReceivedReleases(search, page);
+                cancel_if_settled();
+
+                return true;
+            };
+        }
+
+        std::vector<TransferResult> results;
+        transport.Fetch(requests, results, [&search, &cancel_if_settled, first_page](size_t index, const TransferResult& result) {
+            ReleasePage& release_page = search.pages[first_page + index];
+
+            if (result.was_successful && release_page.scanner.GetElementCount() == 0)
+            {
+                // The page is either an empty list, which ends the list, or not a list at all.
+                JsonTape    page_tape;
+                std::string parse_error_message;
+                release_page.is_complete = page_tape.Parse(release_page.body.data(), release_page.body.size(), false, parse_error_message) &&
+                                           page_tape.Root().IsArray();
+            }
+            else
+            {
+                release_page.is_complete = result.was_successful;
+            }
+
+            cancel_if_settled();
+        });
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            ReleasePage& release_page = search.pages[first_page + i];
+
+            if (release_page.is_complete && release_page.scanner.GetElementCount() == 0)
+            {
+                is_end = true;
+            }
+            else if (!release_page.is_complete && !search.is_settled)
+            {
+                // An error response, like the one for an exceeded rate limit, is an object with a message instead of a list.
+                JsonSpan    message_span;
+                JsonTape    message_tape;
+                std::string message;
+                std::string parse_error_message;
+
+                if (release_page.scanner.FindMember(kStringTagMessage, message_span) &&
+                    message_tape.Parse(release_page.body.data() + message_span.offset, message_span.length, false, parse_error_message))
+                {
+                    message_tape.Root().GetString(message);
+                }
+
+                error_message.append(kStringErrorFailedToListReleases);
+                error_message.append(results[i].was_successful ? kStringErrorResponseIsNotAReleaseList : results[i].error_message);
+                error_message.append(message.empty() ? "" : " " + message);
+                is_listed = false;
+            }
+        }
+
+        if (!results.empty())
+        {
+            link_header = results[0].link_header;
+        }
+
+        return is_listed;
+    }
+
+    /// @brief Get the URL of a page of the release list.
+    ///
+    /// @param [in] releases_url      The releases URL.
+    /// @param [in] releases_per_page The number of releases per page.
+    /// @param [in] page_number       The number of the page, starting at 1.
+    ///
+    /// @return The URL.
+    static std::string GetPageUrl(const std::string& releases_url, size_t releases_per_page, size_t page_number)
+    {
+        return releases_url + (releases_url.find('?') == std::string::npos ? "?" : "&") + "per_page=" + std::to_string(releases_per_page) +
+               "&page=" + std::to_string(page_number);
+    }
+
+    /// @brief Find the newest release of each of some channels that carries a JSON file, in one listing of the releases.
+    ///
+    /// @param [in]  releases_url   The releases URL.
+    /// @param [in]  channels       The channel of each release to find.
+    /// @param [in]  json_filenames The json file name that each release to find carries.
+    /// @param [in]  options        The token and limits of the listing.
+    /// @param [out] releases       Each release, in the same order.
+    /// @param [out] error_message  Any error messages of pages that could not be downloaded.
+    ///
+    /// @return true if the pages that were needed were listed; false otherwise.
+    static bool FindReleases(const std::string&              releases_url,
+                             const std::vector<std::string>& channels,
+                             const std::vector<std::string>& json_filenames,
+                             const GithubReleasesOptions&    options,
+                             std::vector<ChannelRelease>&    releases,
+                             std::string&                    error_message)
+    {
+        releases.clear();
+        releases.resize(channels.size());
+
+        for (size_t i = 0; i < channels.size(); ++i)
+        {
+            releases[i].channel       = channels[i];
+            releases[i].was_found     = false;
+            releases[i].is_prerelease = false;
+        }
+
+        ReleaseListSearch search;
+        search.channels       = channels;
+        search.json_filenames = json_filenames;
+        search.releases       = &releases;
+        search.is_settled     = channels.empty();
+        search.matches.assign(channels.size(), ChannelMatch{kNoPage, 0});
+
+        const size_t releases_per_page    = std::min(std::max(options.releases_per_page, static_cast<size_t>(1)), kMaxReleasesPerPage);
+        const size_t max_concurrent_pages = std::max(options.max_concurrent_pages, static_cast<size_t>(1));
+        std::string  list_error_message;
+        std::string  link_header;
+        bool         is_end = false;
+
+        // The first page tells how many pages there are.
+        bool is_listed = search.is_settled ||
+                         FetchReleasePages(search, {GetPageUrl(releases_url, releases_per_page, 1)}, 0, options, link_header, is_end, list_error_message);
+
+        size_t last_page = GetLinkedPage(link_header, kStringLinkRelationLast);
+        if (last_page == 0 && GetLinkedPage(link_header, kStringLinkRelationNext) != 0)
+        {
+            // Without a last page, keep listing until a page is empty.
+            last_page = options.max_pages;
+        }
+
+        last_page = std::min(last_page, options.max_pages);
+
+        for (size_t next_page = 2; is_listed && !is_end && !search.is_settled && next_page <= last_page;)
+        {
+            std::vector<std::string> page_urls;
+
+            for (; page_urls.size() < max_concurrent_pages && next_page <= last_page; ++next_page)
+            {
+                page_urls.push_back(GetPageUrl(releases_url, releases_per_page, next_page));
+            }
+
+            is_listed = FetchReleasePages(search, page_urls, next_page - page_urls.size() - 1, options, link_header, is_end, list_error_message);
+        }
+
+        for (size_t i = 0; i < channels.size(); ++i)
+        {
+            ChannelRelease& release = releases[i];
+            release.was_found       = IsChannelSettled(search, i);
+
+            if (!release.was_found)
+            {
+                // A release that was found after a page that failed may not be the newest one.
+                release.is_prerelease = false;
+                release.tag_name.clear();
+                release.download_url.clear();
+                release.error_message = is_listed ? kStringErrorChannelReleaseNotFound : list_error_message;
+            }
+        }
+
+        error_message.append(list_error_message);
+
+        return is_listed;
+    }
+
+    bool FindChannelReleases(const std::string&              releases_url,
+                             const std::string&              json_filename,
+                             const std::vector<std::string>& channels,
+                             const GithubReleasesOptions&    options,
+                             std::vector<ChannelRelease>&    releases,
+                             std::string&                    error_message)
+    {
+        return FindReleases(releases_url, channels, std::vector<std::string>(channels.size(), json_filename), options, releases, error_message);
+    }
+
+    bool FindChannelReleaseAssets(const std::string&              releases_url,
+                                  const std::string&              channel,
+                                  const std::vector<std::string>& json_filenames,
+                                  const GithubReleasesOptions&    options,
+                                  std::vector<ChannelRelease>&    releases,
+                                  std::string&                    error_message)
+    {
+        return FindReleases(releases_url, std::vector<std::string>(json_filenames.size(), channel), json_filenames, options, releases, error_message);
+    }
+}  // namespace UpdateCheck
@@ -0,0 +1,124 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Finds the newest release of each channel in the release list of a GitHub repository.
+///
+/// The latest release that the GitHub Release API returns is never a
+/// prerelease, so the JSON files of beta and alpha channels, which are
+/// attached to prerelease tags, cannot be found through it. This lists the
+/// releases of the repository instead. The list is paginated: once the Link
+/// header of the first page tells how many pages there are, the following
+/// pages are downloaded concurrently, and each page is searched while it is
+/// being received. The list is sorted newest first, so the search stops, and
+/// cancels the pages still in flight, as soon as every channel has been found
+/// on a page that no earlier page can outrank.
+///
+/// This needs the in-process transport, because it reads the Link header.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_GITHUB_RELEASES_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_GITHUB_RELEASES_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace UpdateCheck
+{
+    /// @brief The newest release of a channel that carries the JSON file of a check.
+    struct ChannelRelease
+    {
+        /// The channel, like "stable" or "beta".
+        std::string channel;
+
+        /// True if a release of the channel with the asset was found.
+        bool was_found;
+
+        /// True if the release is marked as a prerelease.
+        bool is_prerelease;
+
+        /// The tag of the release.
+        std::string tag_name;
+
+        /// The URL to download the asset from.
+        std::string download_url;
+
+        /// A description of the error if was_found is false.
+        std::string error_message;
+    };
+
+    /// @brief Options for listing the releases of a GitHub repository.
+    struct GithubReleasesOptions
+    {
+        /// @brief Constructor that sets the default values.
+        GithubReleasesOptions();
+
+        /// A token to authorize the requests with, which raises the rate limit; may be empty.
+        std::string access_token;
+
+        /// The number of releases per page, at most 100. Default 100.
+        size_t releases_per_page;
+
+        /// The largest number of pages to search. Default 10.
+        size_t max_pages;
+
+        /// The largest number of pages to download at the same time. Default 4.
+        size_t max_concurrent_pages;
+    };
+
+    /// @brief Get the channel of a release.
+    ///
+    /// A release that is not a prerelease belongs to the "stable" channel. The
+    /// channel of a prerelease is the run of letters after the first hyphen that
+    /// follows a digit in its tag, in lower case, so "v2.1.0-beta.3" and
+    /// "rgp-v2.1-Beta2" are "beta" releases. A prerelease without such a suffix
+    /// belongs to the "prerelease" channel.
+    ///
+    /// @param [in] tag_name      The tag of the release.
+    /// @param [in] is_prerelease True if the release is marked as a prerelease.
+    ///
+    /// @return The channel.
+    std::string GetReleaseChannel(const std::string& tag_name, bool is_prerelease);
+
+    /// @brief Find the newest release of each of some channels that carries the JSON file of a check.
+    ///
+    /// Draft releases are skipped.
+    ///
+    /// @param [in]  releases_url  The releases URL, like https://api.github.com/repos/OWNER/REPOSITORY/releases.
+    /// @param [in]  json_filename The json file name, which is the name of the asset.
+    /// @param [in]  channels      The channels to find.
+    /// @param [in]  options       The token and limits of the listing.
+    /// @param [out] releases      The release of each channel, in the same order.
+    /// @param [out] error_message Any error messages of pages that could not be downloaded.
+    ///
+    /// @return true if the pages that were needed were listed, even if some channels were not found; false otherwise.
+    bool FindChannelReleases(const std::string&              releases_url,
+                             const std::string&              json_filename,
+                             const std::vector<std::string>& channels,
+                             const GithubReleasesOptions&    options,
+                             std::vector<ChannelRelease>&    releases,
+                             std::string&                    error_message);
+
+    /// @brief Find the newest release of a channel that carries each of some JSON files.
+    ///
+    /// The releases of all JSON files are found in one listing of the releases, so
+    /// checking several products of a repository costs no more requests than one.
+    /// Draft releases are skipped.
+    ///
+    /// @param [in]  releases_url   The releases URL, like https://api.github.com/repos/OWNER/REPOSITORY/releases.
+    /// @param [in]  channel        The channel, like "beta".
+    /// @param [in]  json_filenames The json file names, which are the names of the assets.
+    /// @param [in]  options        The token and limits of the listing.
+    /// @param [out] releases       The release that carries each json file, in the same order.
+    /// @param [out] error_message  Any error messages of pages that could not be downloaded.
+    ///
+    /// @return true if the pages that were needed were listed, even if some files were not found; false otherwise.
+    bool FindChannelReleaseAssets(const std::string&              releases_url,
+                                  const std::string&              channel,
+                                  const std::vector<std::string>& json_filenames,
+                                  const GithubReleasesOptions&    options,
+                                  std::vector<ChannelRelease>&    releases,
+                                  std::string&                    error_message);
+}  // namespace UpdateCheck
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_GITHUB_RELEASES_H_
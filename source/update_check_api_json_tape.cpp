@@ -0,0 +1,1107 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A two-stage JSON parser that indexes a document onto a flat tape.
+//==============================================================================
+#include "update_check_api_json_tape.h"
+#include "update_check_api_strings.h"
+#include "update_check_api_utf8.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UPDATECHECKAPI_JSON_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace UpdateCheckApiJson
+{
+    // Tape entries store 32-bit offsets into the source buffer.
+    static const size_t kMaxDocumentSize = UINT32_MAX;
+
+    // The number of bytes processed per SIMD block.
+    static const size_t kBlockSize = 16;
+
+    // The UTF-8 encoding of the byte order mark.
+    static const char   kUtf8ByteOrderMark[]   = "\xEF\xBB\xBF";
+    static const size_t kUtf8ByteOrderMarkSize = 3;
+
+    /// The tokens that the tape builder expects to see next.
+    enum class Expect
+    {
+        kValue,
+        kValueOrEnd,
+        kKey,
+        kKeyOrEnd,
+        kColon,
+        kCommaOrEnd,
+        kDone
+    };
+
+    /// @brief Get the index of the lowest set bit.
+    ///
+    /// @param [in] mask A non-zero bit mask.
+    ///
+    /// @return The index of the lowest set bit.
+    static inline uint32_t CountTrailingZeros(uint32_t mask)
+    {
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+    }
+
+    static inline bool IsWhitespace(char c)
+    {
+        return (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+    }
+
+    static inline bool IsStructural(char c)
+    {
+        return (c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',');
+    }
+
+    static inline bool IsHexDigit(char c)
+    {
+        return ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'));
+    }
+
+    static inline uint32_t HexDigitValue(char c)
+    {
+        uint32_t value = 0;
+
+        if (c >= '0' && c <= '9')
+        {
+            value = c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            value = c - 'a' + 10;
+        }
+        else
+        {
+            value = c - 'A' + 10;
+        }
+
+        return value;
+    }
+
+    /// @brief Find the first non-whitespace byte at or after pos.
+    ///
+    /// @return The offset of the byte, or size if there is none.
+    static size_t SkipWhitespace(const char* data, size_t size, size_t pos)
+    {
+        // Most tokens are separated by at most a single whitespace byte, so check that before going wide.
+        if (pos < size && !IsWhitespace(data[pos]))
+        {
+            return pos;
+        }
+
+#ifdef UPDATECHECKAPI_JSON_USE_SSE2
+        const __m128i space   = _mm_set1_epi8(' ');
+        const __m128i newline = _mm_set1_epi8('\n');
+        const __m128i cr      = _mm_set1_epi8('\r');
+        const __m128i tab     = _mm_set1_epi8('\t');
+
+        while (pos + kBlockSize <= size)
+        {
+            __m128i block      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+            __m128i whitespace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, space), _mm_cmpeq_epi8(block, newline)),
+                                              _mm_or_si128(_mm_cmpeq_epi8(block, cr), _mm_cmpeq_epi8(block, tab)));
+            uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(whitespace)) & 0xFFFF;
+
+            if (mask != 0)
+            {
+                return pos + CountTrailingZeros(mask);
+            }
+
+            pos += kBlockSize;
+        }
+#endif
+
+        while (pos < size && IsWhitespace(data[pos]))
+        {
+            ++pos;
+        }
+
+        return pos;
+    }
+
+    /// @brief Validate the escape sequence that starts with the backslash at pos.
+    ///
+    /// @return The length of the escape sequence, or 0 if it is invalid.
+    static size_t ValidateEscape(const char* data, size_t size, size_t pos)
+    {
+        size_t length = 0;
+
+        if (pos + 1 < size)
+        {
+            switch (data[pos + 1])
+            {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                length = 2;
+                break;
+            case 'u':
+                if (pos + 5 < size && IsHexDigit(data[pos + 2]) && IsHexDigit(data[pos + 3]) && IsHexDigit(data[pos + 4]) && IsHexDigit(data[pos + 5]))
+                {
+                    length = 6;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        return length;
+    }
+
+    /// @brief Find the closing quote of a string.
+    ///
+    /// @param [in]  data         The source buffer.
+    /// @param [in]  size         The size of the source buffer.
+    /// @param [in]  pos          The offset of the first byte after the opening quote.
+    /// @param [out] end          The offset of the closing quote.
+    /// @param [out] error_offset The offset of the offending byte if the string is malformed.
+    ///
+    /// @return true if the string is terminated and well-formed; false otherwise.
+    static bool FindStringEnd(const char* data, size_t size, size_t pos, size_t& end, size_t& error_offset)
+    {
+#ifdef UPDATECHECKAPI_JSON_USE_SSE2
+        const __m128i quote       = _mm_set1_epi8('"');
+        const __m128i backslash   = _mm_set1_epi8('\\');
+        const __m128i control_max = _mm_set1_epi8(0x1F);
+
+        while (pos + kBlockSize <= size)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+
+            // A byte is a control character if it is unchanged by an unsigned min against 0x1F.
+            __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)),
+                                           _mm_cmpeq_epi8(_mm_min_epu8(block, control_max), block));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+
+            if (mask == 0)
+            {
+                pos += kBlockSize;
+                continue;
+            }
+
+            pos += CountTrailingZeros(mask);
+
+            if (data[pos] == '"')
+            {
+                end = pos;
+                return true;
+            }
+            else if (data[pos] == '\\')
+            {
+                size_t escape_length = ValidateEscape(data, size, pos);
+                if (escape_length == 0)
+                {
+                    error_offset = pos;
+                    return false;
+                }
+
+                pos += escape_length;
+            }
+            else
+            {
+                // Unescaped control characters are not allowed in JSON strings.
+                error_offset = pos;
+                return false;
+            }
+        }
+#endif
+
+        while (pos < size)
+        {
+            unsigned char c = static_cast<unsigned char>(data[pos]);
+
+            if (c == '"')
+            {
+                end = pos;
+                return true;
+            }
+            else if (c == '\\')
+            {
+                size_t escape_length = ValidateEscape(data, size, pos);
+                if (escape_length == 0)
+                {
+                    error_offset = pos;
+                    return false;
+                }
+
+                pos += escape_length;
+            }
+            else if (c < 0x20)
+            {
+                error_offset = pos;
+                return false;
+            }
+            else
+            {
+                ++pos;
+            }
+        }
+
+        error_offset = size;
+        return false;
+    }
+
+    /// @brief Check that a scalar token is a valid JSON literal or number.
+    ///
+    /// @param [in]  token  The first byte of the token.
+    /// @param [in]  length The length of the token in bytes.
+    /// @param [out] type   The tape type of the token.
+    ///
+    /// @return true if the token is a valid scalar; false otherwise.
+    static bool ValidateScalar(const char* token, size_t length, TapeType& type)
+    {
+        bool is_valid = false;
+
+        if (length == 4 && memcmp(token, "true", 4) == 0)
+        {
+            type     = TapeType::kTrue;
+            is_valid = true;
+        }
+        else if (length == 5 && memcmp(token, "false", 5) == 0)
+        {
+            type     = TapeType::kFalse;
+            is_valid = true;
+        }
+        else if (length == 4 && memcmp(token, "null", 4) == 0)
+        {
+            type     = TapeType::kNull;
+            is_valid = true;
+        }
+        else if (length > 0)
+        {
+            // Number: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+            size_t pos = 0;
+
+            if (token[pos] == '-')
+            {
+                ++pos;
+            }
+
+            if (pos < length && token[pos] == '0')
+            {
+                is_valid = true;
+                ++pos;
+            }
+            else
+            {
+                while (pos < length && token[pos] >= '0' && token[pos] <= '9')
+                {
+                    is_valid = true;
+                    ++pos;
+                }
+            }
+
+            if (is_valid && pos < length && token[pos] == '.')
+            {
+                ++pos;
+                is_valid = false;
+                while (pos < length && token[pos] >= '0' && token[pos] <= '9')
+                {
+                    is_valid = true;
+                    ++pos;
+                }
+            }
+
+            if (is_valid && pos < length && (token[pos] == 'e' || token[pos] == 'E'))
+            {
+                ++pos;
+                if (pos < length && (token[pos] == '+' || token[pos] == '-'))
+                {
+                    ++pos;
+                }
+
+                is_valid = false;
+                while (pos < length && token[pos] >= '0' && token[pos] <= '9')
+                {
+                    is_valid = true;
+                    ++pos;
+                }
+            }
+
+            is_valid = is_valid && (pos == length);
+            type     = TapeType::kNumber;
+        }
+
+        return is_valid;
+    }
+
+    /// @brief Append the UTF-8 encoding of a code point to a string.
+    static void AppendUtf8(uint32_t code_point, std::string& value)
+    {
+        if (code_point < 0x80)
+        {
+            value.push_back(static_cast<char>(code_point));
+        }
+        else if (code_point < 0x800)
+        {
+            value.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+            value.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+        else if (code_point < 0x10000)
+        {
+            value.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+            value.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            value.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+        else
+        {
+            value.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+            value.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+            value.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            value.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+    }
+
+    /// @brief Read the 4 hex digits of a \\u escape sequence.
+    static uint32_t ReadCodeUnit(const char* digits)
+    {
+        return (HexDigitValue(digits[0]) << 12) | (HexDigitValue(digits[1]) << 8) | (HexDigitValue(digits[2]) << 4) | HexDigitValue(digits[3]);
+    }
+
+    /// @brief Decode a raw string that contains escape sequences.
+    ///
+    /// Escape sequences have already been validated by stage one, so only surrogate pairs need to be checked here.
+    ///
+    /// @return true if the string was decoded; false if it contains an unpaired surrogate.
+    static bool DecodeEscapedString(const char* raw, size_t length, std::string& value)
+    {
+        value.clear();
+        value.reserve(length);
+
+        size_t pos = 0;
+        while (pos < length)
+        {
+            const char* backslash = static_cast<const char*>(memchr(raw + pos, '\\', length - pos));
+            if (backslash == nullptr)
+            {
+                value.append(raw + pos, length - pos);
+                break;
+            }
+
+            size_t escape_pos = backslash - raw;
+            value.append(raw + pos, escape_pos - pos);
+
+            char escaped = raw[escape_pos + 1];
+            pos          = escape_pos + 2;
+
+            switch (escaped)
+            {
+            case 'b':
+                value.push_back('\b');
+                break;
+            case 'f':
+                value.push_back('\f');
+                break;
+            case 'n':
+                value.push_back('\n');
+                break;
+            case 'r':
+                value.push_back('\r');
+                break;
+            case 't':
+                value.push_back('\t');
+                break;
+            case 'u':
+            {
+                uint32_t code_point = ReadCodeUnit(raw + pos);
+                pos += 4;
+
+                if (code_point >= 0xD800 && code_point <= 0xDBFF)
+                {
+                    // A high surrogate must be followed by an escaped low surrogate.
+                    if (pos + 6 > length || raw[pos] != '\\' || raw[pos + 1] != 'u')
+                    {
+                        return false;
+                    }
+
+                    uint32_t low_surrogate = ReadCodeUnit(raw + pos + 2);
+                    if (low_surrogate < 0xDC00 || low_surrogate > 0xDFFF)
+                    {
+                        return false;
+                    }
+
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+                    pos += 6;
+                }
+                else if (code_point >= 0xDC00 && code_point <= 0xDFFF)
+                {
+                    return false;
+                }
+
+                AppendUtf8(code_point, value);
+                break;
+            }
+            default:
+                // '"', '\\' and '/' stand for themselves.
+                value.push_back(escaped);
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    JsonValue::Iterator::Iterator(const JsonTape* tape, uint32_t index, bool is_object)
+        : tape_(tape)
+        , index_(index)
+        , is_object_(is_object)
+    {
+    }
+
+    JsonValue JsonValue::Iterator::operator*() const
+    {
+        return JsonValue(tape_, is_object_ ? index_ + 1 : index_);
+    }
+
+    JsonValue JsonValue::Iterator::Key() const
+    {
+        return is_object_ ? JsonValue(tape_, index_) : JsonValue();
+    }
+
+    JsonValue::Iterator& JsonValue::Iterator::operator++()
+    {
+        // Object members are a key entry followed by the value, so step over both.
+        uint32_t value_index = is_object_ ? index_ + 1 : index_;
+        index_               = tape_->tape_[value_index].next;
+        return *this;
+    }
+
+    bool JsonValue::Iterator::operator!=(const Iterator& other) const
+    {
+        return index_ != other.index_ || tape_ != other.tape_;
+    }
+
+    JsonValue::JsonValue()
+        : tape_(nullptr)
+        , index_(0)
+    {
+    }
+
+    JsonValue::JsonValue(const JsonTape* tape, uint32_t index)
+        : tape_(tape)
+        , index_(index)
+    {
+    }
+
+    const TapeEntry& JsonValue::Entry() const
+    {
+        return tape_->tape_[index_];
+    }
+
+    bool JsonValue::IsValid() const
+    {
+        return tape_ != nullptr && index_ < tape_->tape_.size();
+    }
+
+    bool JsonValue::IsObject() const
+    {
+        return IsValid() && Entry().type == TapeType::kObject;
+    }
+
+    bool JsonValue::IsArray() const
+    {
+        return IsValid() && Entry().type == TapeType::kArray;
+    }
+
+    bool JsonValue::IsString() const
+    {
+        return IsValid() && Entry().type == TapeType::kString;
+    }
+
+    bool JsonValue::Empty() const
+    {
+        bool is_empty = true;
+
+        if (IsValid())
+        {
+            const TapeEntry& entry = Entry();
+            if (entry.type == TapeType::kObject || entry.type == TapeType::kArray)
+            {
+                is_empty = (entry.next == index_ + 1);
+            }
+            else
+            {
+                is_empty = (entry.type == TapeType::kNull);
+            }
+        }
+
+        return is_empty;
+    }
+
+    JsonValue JsonValue::Find(const char* key) const
+    {
+        if (IsObject())
+        {
+            for (Iterator member = begin(); member != end(); ++member)
+            {
+                if (member.Key().Equals(key))
+                {
+                    return *member;
+                }
+            }
+        }
+
+        return JsonValue();
+    }
+
+    JsonValue::Iterator JsonValue::begin() const
+    {
+        if (!IsValid())
+        {
+            return Iterator(nullptr, 0, false);
+        }
+
+        const TapeEntry& entry = Entry();
+        if (entry.type == TapeType::kObject || entry.type == TapeType::kArray)
+        {
+            return Iterator(tape_, index_ + 1, entry.type == TapeType::kObject);
+        }
+
+        return Iterator(tape_, entry.next, false);
+    }
+
+    JsonValue::Iterator JsonValue::end() const
+    {
+        if (!IsValid())
+        {
+            return Iterator(nullptr, 0, false);
+        }
+
+        const TapeEntry& entry = Entry();
+        return Iterator(tape_, entry.next, entry.type == TapeType::kObject);
+    }
+
+    bool JsonValue::GetString(std::string& value) const
+    {
+        bool is_string = IsString();
+
+        if (is_string)
+        {
+            const char* raw    = RawData();
+            size_t      length = RawSize();
+
+            if (memchr(raw, '\\', length) == nullptr)
+            {
+                value.assign(raw, length);
+            }
+            else
+            {
+                is_string = DecodeEscapedString(raw, length, value);
+            }
+        }
+
+        return is_string;
+    }
+
+    bool JsonValue::GetUint32(uint32_t& value) const
+    {
+        bool is_valid = IsValid() && Entry().type == TapeType::kNumber;
+
+        if (is_valid)
+        {
+            const char* raw    = RawData();
+            size_t      length = RawSize();
+            uint64_t    number = 0;
+
+            // Reject signs, fractions and exponents, as well as anything that cannot fit into 32 bits.
+            is_valid = (length <= 10);
+            for (size_t i = 0; is_valid && i < length; ++i)
+            {
+                is_valid = (raw[i] >= '0' && raw[i] <= '9');
+                number   = number * 10 + (raw[i] - '0');
+            }
+
+            if (is_valid && number <= UINT32_MAX)
+            {
+                value = static_cast<uint32_t>(number);
+            }
+            else
+            {
+                is_valid = false;
+            }
+        }
+
+        return is_valid;
+    }
+
+    bool JsonValue::GetBool(bool& value) const
+    {
+        bool is_valid = IsValid() && (Entry().type == TapeType::kTrue || Entry().type == TapeType::kFalse);
+
+        if (is_valid)
+        {
+            value = (Entry().type == TapeType::kTrue);
+        }
+
+        return is_valid;
+    }
+
+    bool JsonValue::Equals(const char* text) const
+    {
+        bool is_equal = false;
+
+        if (IsString())
+        {
+            const char* raw         = RawData();
+            size_t      length      = RawSize();
+            size_t      text_length = strlen(text);
+
+            if (memchr(raw, '\\', length) == nullptr)
+            {
+                is_equal = (length == text_length && memcmp(raw, text, length) == 0);
+            }
+            else
+            {
+                std::string decoded;
+                is_equal = DecodeEscapedString(raw, length, decoded) && decoded.compare(text) == 0;
+            }
+        }
+
+        return is_equal;
+    }
+
+    const char* JsonValue::RawData() const
+    {
+        return IsValid() ? tape_->data_ + Entry().offset : nullptr;
+    }
+
+    size_t JsonValue::RawSize() const
+    {
+        return IsValid() ? Entry().length : 0;
+    }
+
+    const char* JsonValue::JsonData() const
+    {
+        const char* data = RawData();
+
+        if (IsString())
+        {
+            // Include the opening quote.
+            --data;
+        }
+
+        return data;
+    }
+
+    size_t JsonValue::JsonSize() const
+    {
+        return IsString() ? RawSize() + 2 : RawSize();
+    }
+
+    JsonTape::JsonTape()
+        : data_(nullptr)
+        , size_(0)
+    {
+    }
+
+    bool JsonTape::Parse(const char* data, size_t size, bool is_valid_utf8, std::string& error_message)
+    {
+        data_ = data;
+        size_ = size;
+        structural_index_.clear();
+        tape_.clear();
+
+        size_t error_offset = 0;
+        bool   is_parsed    = false;
+
+        if (size > kMaxDocumentSize)
+        {
+            error_message.append(kStringErrorJsonDocumentTooLarge);
+        }
+        else if (!is_valid_utf8 && !UpdateCheckApiUtils::IsValidUtf8(data, size))
+        {
+            error_message.append(kStringErrorInvalidUtf8);
+        }
+        else if (!BuildStructuralIndex(error_offset) || !BuildTape(error_offset))
+        {
+            tape_.clear();
+            error_message.append(kStringErrorMalformedJson);
+            error_message.append(std::to_string(error_offset));
+            error_message.append(". ");
+        }
+        else
+        {
+            is_parsed = true;
+        }
+
+        return is_parsed;
+    }
+
+    JsonValue JsonTape::Root() const
+    {
+        return tape_.empty() ? JsonValue() : JsonValue(this, 0);
+    }
+
+    bool JsonTape::BuildStructuralIndex(size_t& error_offset)
+    {
+        size_t pos = 0;
+
+        if (size_ >= kUtf8ByteOrderMarkSize && memcmp(data_, kUtf8ByteOrderMark, kUtf8ByteOrderMarkSize) == 0)
+        {
+            pos = kUtf8ByteOrderMarkSize;
+        }
+
+        while (true)
+        {
+            pos = SkipWhitespace(data_, size_, pos);
+            if (pos >= size_)
+            {
+                break;
+            }
+
+            structural_index_.push_back(static_cast<uint32_t>(pos));
+
+            char c = data_[pos];
+            if (c == '"')
+            {
+                // Strings contribute both quotes so that stage two does not need to search for the end again.
+                size_t end = 0;
+                if (!FindStringEnd(data_, size_, pos + 1, end, error_offset))
+                {
+                    return false;
+                }
+
+                structural_index_.push_back(static_cast<uint32_t>(end));
+                pos = end + 1;
+            }
+            else if (IsStructural(c))
+            {
+                ++pos;
+            }
+            else
+            {
+                // Scalars are validated in stage two, so skip ahead to the next delimiter.
+                ++pos;
+                while (pos < size_ && !IsWhitespace(data_[pos]) && !IsStructural(data_[pos]) && data_[pos] != '"')
+                {
+                    ++pos;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool JsonTape::BuildTape(size_t& error_offset)
+    {
+        std::vector<uint32_t> open_containers;
+        Expect                expect = Expect::kValue;
+
+        const size_t count = structural_index_.size();
+        size_t       i     = 0;
+
+        while (i < count)
+        {
+            uint32_t offset = structural_index_[i];
+            char     c      = data_[offset];
+            error_offset    = offset;
+
+            if (expect == Expect::kDone)
+            {
+                // Trailing content after the root value.
+                return false;
+            }
+            else if (expect == Expect::kColon)
+            {
+                if (c != ':')
+                {
+                    return false;
+                }
+
+                expect = Expect::kValue;
+                ++i;
+                continue;
+            }
+
+            // Check for the end of the innermost container.
+            bool is_object = !open_containers.empty() && tape_[open_containers.back()].type == TapeType::kObject;
+            bool is_close  = (is_object && c == '}' && (expect == Expect::kKeyOrEnd || expect == Expect::kCommaOrEnd)) ||
+                            (!is_object && c == ']' && (expect == Expect::kValueOrEnd || expect == Expect::kCommaOrEnd));
+
+            if (is_close)
+            {
+                TapeEntry& container = tape_[open_containers.back()];
+                container.length     = offset - container.offset + 1;
+                container.next       = static_cast<uint32_t>(tape_.size());
+                open_containers.pop_back();
+
+                expect = open_containers.empty() ? Expect::kDone : Expect::kCommaOrEnd;
+                ++i;
+                continue;
+            }
+
+            if (expect == Expect::kCommaOrEnd)
+            {
+                if (c != ',')
+                {
+                    return false;
+                }
+
+                expect = is_object ? Expect::kKey : Expect::kValue;
+                ++i;
+                continue;
+            }
+
+            if (expect == Expect::kKey || expect == Expect::kKeyOrEnd)
+            {
+                if (c != '"')
+                {
+                    return false;
+                }
+
+                TapeEntry key = {TapeType::kString, offset + 1, structural_index_[i + 1] - offset - 1, static_cast<uint32_t>(tape_.size() + 1)};
+                tape_.push_back(key);
+
+                expect = Expect::kColon;
+                i += 2;
+                continue;
+            }
+
+            // Expecting a value.
+            TapeEntry entry = {TapeType::kNull, offset, 0, static_cast<uint32_t>(tape_.size() + 1)};
+
+            if (c == '{' || c == '[')
+            {
+                entry.type = (c == '{') ? TapeType::kObject : TapeType::kArray;
+                open_containers.push_back(static_cast<uint32_t>(tape_.size()));
+                tape_.push_back(entry);
+
+                expect = (c == '{') ? Expect::kKeyOrEnd : Expect::kValueOrEnd;
+                ++i;
+                continue;
+            }
+            else if (c == '"')
+            {
+                entry.type   = TapeType::kString;
+                entry.offset = offset + 1;
+                entry.length = structural_index_[i + 1] - offset - 1;
+                i += 2;
+            }
+            else
+            {
+                size_t end = offset;
+                while (end < size_ && !IsWhitespace(data_[end]) && !IsStructural(data_[end]) && data_[end] != '"')
+                {
+                    ++end;
+                }
+
+                entry.length = static_cast<uint32_t>(end - offset);
+                if (!ValidateScalar(data_ + offset, entry.length, entry.type))
+                {
+                    return false;
+                }
+
+                ++i;
+            }
+
+            tape_.push_back(entry);
+            expect = open_containers.empty() ? Expect::kDone : Expect::kCommaOrEnd;
+        }
+
+        error_offset = size_;
+        return (expect == Expect::kDone);
+    }
+
+    JsonStreamScanner::JsonStreamScanner(const char* array_key)
+        : array_key_(array_key)
+        , scanned_(0)
+        , depth_(0)
+        , in_string_(false)
+        , is_escaped_(false)
+        , in_scalar_(false)
+        , is_root_object_(false)
+        , expect_key_(false)
+        , in_array_(false)
+        , array_depth_(array_key_.empty() ? 1 : 2)
+        , key_start_(0)
+        , value_start_(0)
+        , element_start_(0)
+    {
+    }
+
+    void JsonStreamScanner::Scan(const char* data, size_t size)
+    {
+        size_t pos = scanned_;
+
+        while (pos < size)
+        {
+            char c = data[pos];
+
+            if (in_string_)
+            {
+                if (is_escaped_)
+                {
+                    is_escaped_ = false;
+                }
+                else if (c == '\\')
+                {
+                    is_escaped_ = true;
+                }
+                else if (c == '"')
+                {
+                    in_string_ = false;
+
+                    if (depth_ == 1 && expect_key_)
+                    {
+                        current_key_.assign(data + key_start_, pos - key_start_);
+                        expect_key_ = false;
+                    }
+                    else
+                    {
+                        EndValue(pos + 1);
+                    }
+                }
+
+                ++pos;
+                continue;
+            }
+
+            // Numbers and literals end at the first whitespace or structural byte.
+            if (in_scalar_ && (IsWhitespace(c) || IsStructural(c)))
+            {
+                in_scalar_ = false;
+                EndValue(pos);
+            }
+
+            switch (c)
+            {
+            case '"':
+                BeginValue(pos);
+                in_string_ = true;
+                break;
+
+            case '{':
+            case '[':
+                BeginValue(pos);
+                ++depth_;
+
+                if (depth_ == 1)
+                {
+                    is_root_object_ = (c == '{');
+                    expect_key_     = is_root_object_;
+                    in_array_       = (c == '[' && array_key_.empty());
+                }
+                else if (depth_ == 2 && c == '[' && is_root_object_ && current_key_ == array_key_)
+                {
+                    in_array_ = true;
+                }
+                break;
+
+            case '}':
+            case ']':
+                if (depth_ > 0)
+                {
+                    --depth_;
+                    EndValue(pos + 1);
+
+                    if (depth_ < array_depth_)
+                    {
+                        in_array_ = false;
+                    }
+                }
+                break;
+
+            case ',':
+                if (depth_ == 1)
+                {
+                    expect_key_ = is_root_object_;
+                }
+                break;
+
+            default:
+                if (!in_scalar_ && !IsWhitespace(c) && !IsStructural(c))
+                {
+                    BeginValue(pos);
+                    in_scalar_ = true;
+                }
+                break;
+            }
+
+            ++pos;
+        }
+
+        scanned_ = size;
+    }
+
+    bool JsonStreamScanner::FindMember(const char* key, JsonSpan& span) const
+    {
+        bool is_found = false;
+
+        for (size_t i = 0; i < members_.size() && !is_found; ++i)
+        {
+            if (members_[i].first == key)
+            {
+                span     = members_[i].second;
+                is_found = true;
+            }
+        }
+
+        return is_found;
+    }
+
+    size_t JsonStreamScanner::GetElementCount() const
+    {
+        return elements_.size();
+    }
+
+    const JsonSpan& JsonStreamScanner::GetElement(size_t index) const
+    {
+        return elements_[index];
+    }
+
+    void JsonStreamScanner::BeginValue(size_t pos)
+    {
+        if (depth_ == 1)
+        {
+            if (expect_key_)
+            {
+                key_start_ = pos + 1;
+            }
+            else
+            {
+                value_start_ = pos;
+            }
+        }
+
+        if (depth_ == array_depth_ && in_array_)
+        {
+            element_start_ = pos;
+        }
+    }
+
+    void JsonStreamScanner::EndValue(size_t end)
+    {
+        if (depth_ == 1 && is_root_object_)
+        {
+            JsonSpan span = {value_start_, end - value_start_};
+            members_.push_back(std::make_pair(current_key_, span));
+        }
+        else if (depth_ == array_depth_ && in_array_)
+        {
+            JsonSpan span = {element_start_, end - element_start_};
+            elements_.push_back(span);
+        }
+    }
+}  // namespace UpdateCheckApiJson
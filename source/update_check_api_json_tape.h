@@ -0,0 +1,394 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A two-stage JSON parser that indexes a document onto a flat tape.
+///
+/// Stage one scans the input buffer (16 bytes at a time where SSE2 is
+/// available) and records the byte offset of every structural token. Stage
+/// two validates the token stream and turns it into a tape of entries that
+/// can be navigated with lightweight JsonValue cursors. Strings and numbers
+/// are only decoded when a cursor asks for them.
+///
+/// A JsonStreamScanner can be used ahead of the tape to pick complete values
+/// out of a document that is still being received.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_JSON_TAPE_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_JSON_TAPE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace UpdateCheckApiJson
+{
+    /// The kinds of values that can appear on the tape.
+    enum class TapeType : uint8_t
+    {
+        kNull = 0,
+        kTrue,
+        kFalse,
+        kNumber,
+        kString,
+        kObject,
+        kArray
+    };
+
+    /// @brief A single value on the tape.
+    struct TapeEntry
+    {
+        /// The kind of value.
+        TapeType type;
+
+        /// Byte offset of the value in the source buffer. For strings this is the first byte after the opening quote.
+        uint32_t offset;
+
+        /// Length in bytes of the raw value. For strings this excludes the quotes; for objects and arrays it includes the brackets.
+        uint32_t length;
+
+        /// Index of the tape entry that follows this value, skipping over any children.
+        uint32_t next;
+    };
+
+    class JsonTape;
+
+    /// @brief A cursor that refers to a single value on a JsonTape.
+    ///
+    /// Cursors are cheap to copy and are only valid for as long as the tape
+    /// (and the buffer the tape was built from) is alive. A default-constructed
+    /// cursor, or one returned from a failed Find(), is not valid.
+    class JsonValue
+    {
+    public:
+        /// @brief Iterates over the elements of an array, or the member values of an object.
+        class Iterator
+        {
+        public:
+            /// @brief Constructor.
+            ///
+            /// @param [in] tape      The tape being iterated.
+            /// @param [in] index     The tape index of the current element (or member key).
+            /// @param [in] is_object True if iterating the members of an object.
+            Iterator(const JsonTape* tape, uint32_t index, bool is_object);
+
+            /// @brief Get the current element.
+            ///
+            /// @return A cursor to the current element (or member value).
+            JsonValue operator*() const;
+
+            /// @brief Get the key of the current member when iterating an object.
+            ///
+            /// @return A cursor to the key string; not valid when iterating an array.
+            JsonValue Key() const;
+
+            /// @brief Advance to the next element.
+            ///
+            /// @return This iterator.
+            Iterator& operator++();
+
+            /// @brief Compare two iterators.
+            ///
+            /// @param [in] other The iterator to compare against.
+            ///
+            /// @return true if the iterators do not refer to the same element.
+            bool operator!=(const Iterator& other) const;
+
+        private:
+            /// The tape being iterated.
+            const JsonTape* tape_;
+
+            /// The tape index of the current element (or member key).
+            uint32_t index_;
+
+            /// True if iterating the members of an object.
+            bool is_object_;
+        };
+
+        /// @brief Construct an invalid cursor.
+        JsonValue();
+
+        /// @brief Construct a cursor to a tape entry.
+        ///
+        /// @param [in] tape  The tape.
+        /// @param [in] index The index of the entry on the tape.
+        JsonValue(const JsonTape* tape, uint32_t index);
+
+        /// @brief Check if this cursor refers to a value.
+        ///
+        /// @return true if the cursor is valid.
+        bool IsValid() const;
+
+        /// @brief Check whether this value is an object.
+        ///
+        /// @return true if the value is an object.
+        bool IsObject() const;
+
+        /// @brief Check whether this value is an array.
+        ///
+        /// @return true if the value is an array.
+        bool IsArray() const;
+
+        /// @brief Check whether this value is a string.
+        ///
+        /// @return true if the value is a string.
+        bool IsString() const;
+
+        /// @brief Check whether the value is empty, matching the semantics of nlohmann::json::empty().
+        ///
+        /// @return true for null, and for objects and arrays without children.
+        bool Empty() const;
+
+        /// @brief Look up a member of an object by key.
+        ///
+        /// @param [in] key The key to find.
+        ///
+        /// @return A cursor to the member value; not valid if this is not an object or the key does not exist.
+        JsonValue Find(const char* key) const;
+
+        /// @brief Get an iterator to the first element of an array or the first member of an object.
+        ///
+        /// @return The iterator; equal to end() for scalars and empty containers.
+        Iterator begin() const;
+
+        /// @brief Get an iterator past the last element of an array or object.
+        ///
+        /// @return The iterator.
+        Iterator end() const;
+
+        /// @brief Decode a string value.
+        ///
+        /// @param [out] value The decoded string, with escape sequences resolved.
+        ///
+        /// @return true if the value is a string with valid escape sequences; false otherwise.
+        bool GetString(std::string& value) const;
+
+        /// @brief Decode a non-negative integer value.
+        ///
+        /// @param [out] value The decoded number.
+        ///
+        /// @return true if the value is an integer that fits into 32 bits; false otherwise.
+        bool GetUint32(uint32_t& value) const;
+
+        /// @brief Decode a boolean value.
+        ///
+        /// @param [out] value The decoded boolean.
+        ///
+        /// @return true if the value is true or false; false otherwise.
+        bool GetBool(bool& value) const;
+
+        /// @brief Compare a string value against a string without decoding it.
+        ///
+        /// @param [in] text The text to compare against.
+        ///
+        /// @return true if this is a string value equal to text.
+        bool Equals(const char* text) const;
+
+        /// @brief Get the raw bytes of the value as they appear in the source buffer.
+        ///
+        /// @return A pointer into the source buffer. For strings, this excludes the quotes.
+        const char* RawData() const;
+
+        /// @brief Get the number of raw bytes of the value.
+        ///
+        /// @return The raw size in bytes.
+        size_t RawSize() const;
+
+        /// @brief Get the JSON text of the value as it appears in the source buffer.
+        ///
+        /// @return A pointer into the source buffer. Unlike RawData(), strings include their quotes.
+        const char* JsonData() const;
+
+        /// @brief Get the number of bytes of JSON text of the value.
+        ///
+        /// @return The size in bytes, including the quotes of strings.
+        size_t JsonSize() const;
+
+    private:
+        /// @brief Get the tape entry this cursor refers to.
+        ///
+        /// @return The tape entry.
+        const TapeEntry& Entry() const;
+
+        /// The tape that this cursor navigates.
+        const JsonTape* tape_;
+
+        /// The index of the referenced tape entry.
+        uint32_t index_;
+    };
+
+    /// @brief A JSON document that has been indexed onto a tape.
+    ///
+    /// The tape does not own the source buffer; it must outlive the tape and
+    /// any cursors obtained from it. A tape can be re-used for multiple
+    /// documents, in which case its internal storage is recycled.
+    class JsonTape
+    {
+    public:
+        /// @brief Constructor.
+        JsonTape();
+
+        /// @brief Index a JSON document.
+        ///
+        /// A leading UTF-8 byte order mark is skipped.
+        ///
+        /// @param [in]  data          The JSON text.
+        /// @param [in]  size          The number of bytes of JSON text.
+        /// @param [in]  is_valid_utf8 True if the caller has already validated the text as UTF-8, in which case it is not validated again.
+        /// @param [out] error_message Any error messages that occurred.
+        ///
+        /// @return true if the document is well-formed JSON; false otherwise.
+        bool Parse(const char* data, size_t size, bool is_valid_utf8, std::string& error_message);
+
+        /// @brief Get the root value of the document.
+        ///
+        /// @return A cursor to the root value; not valid if no document has been parsed.
+        JsonValue Root() const;
+
+    private:
+        friend class JsonValue;
+
+        /// @brief Stage one: find the offsets of all structural tokens in the source buffer.
+        ///
+        /// @param [out] error_offset The offset of the offending byte if a string is malformed.
+        ///
+        /// @return true if all strings in the document are terminated and free of control characters; false otherwise.
+        bool BuildStructuralIndex(size_t& error_offset);
+
+        /// @brief Stage two: validate the token stream and build the tape.
+        ///
+        /// @param [out] error_offset The offset of the offending byte if the document is malformed.
+        ///
+        /// @return true if the document is well-formed; false otherwise.
+        bool BuildTape(size_t& error_offset);
+
+        /// The source buffer.
+        const char* data_;
+
+        /// The size of the source buffer.
+        size_t size_;
+
+        /// The offsets of the structural tokens found in stage one. Strings contribute both their opening and closing quote.
+        std::vector<uint32_t> structural_index_;
+
+        /// The tape built in stage two.
+        std::vector<TapeEntry> tape_;
+    };
+
+    /// @brief The location of a complete value in a source buffer.
+    struct JsonSpan
+    {
+        /// Byte offset of the first byte of the value.
+        size_t offset;
+
+        /// Length of the value in bytes. For strings this includes the quotes.
+        size_t length;
+    };
+
+    /// @brief Locates the members of a top-level object while the document is still being received.
+    ///
+    /// The scanner only tracks string, nesting and key state, so it can be run
+    /// over a buffer that grows one chunk at a time; a chunk may end anywhere,
+    /// including in the middle of a string or an escape sequence. The span of
+    /// each top-level member value is recorded once it is complete, and so is
+    /// each element of one nominated top-level array, or of the root array when
+    /// the document is an array, like a page of a list API. The scanner does not
+    /// validate the document, so spans should be parsed with a JsonTape before
+    /// they are used.
+    class JsonStreamScanner
+    {
+    public:
+        /// @brief Constructor.
+        ///
+        /// @param [in] array_key The key of the top-level array whose elements should be reported; empty for the elements of a root array.
+        explicit JsonStreamScanner(const char* array_key);
+
+        /// @brief Scan the bytes that were appended to the buffer since the previous call.
+        ///
+        /// @param [in] data The start of the buffer. The buffer may move between calls, but its existing contents must not change.
+        /// @param [in] size The number of bytes in the buffer.
+        void Scan(const char* data, size_t size);
+
+        /// @brief Look up a complete top-level member by key.
+        ///
+        /// @param [in]  key  The key to find. It is compared against the raw key text, without decoding escape sequences.
+        /// @param [out] span The span of the member value.
+        ///
+        /// @return true if the member has been received in full; false otherwise.
+        bool FindMember(const char* key, JsonSpan& span) const;
+
+        /// @brief Get the number of complete elements of the nominated array.
+        ///
+        /// @return The number of elements received in full so far.
+        size_t GetElementCount() const;
+
+        /// @brief Get the span of a complete element of the nominated array.
+        ///
+        /// @param [in] index The index of the element; must be less than GetElementCount().
+        ///
+        /// @return The span of the element.
+        const JsonSpan& GetElement(size_t index) const;
+
+    private:
+        /// @brief Record the start of a value at the current depth.
+        ///
+        /// @param [in] pos The offset of the first byte of the value.
+        void BeginValue(size_t pos);
+
+        /// @brief Record the end of a value at the current depth.
+        ///
+        /// @param [in] end The offset one past the last byte of the value.
+        void EndValue(size_t end);
+
+        /// The key of the top-level array whose elements are reported.
+        std::string array_key_;
+
+        /// The number of bytes of the buffer that have been scanned.
+        size_t scanned_;
+
+        /// The current nesting depth; 1 inside the root object.
+        uint32_t depth_;
+
+        /// True while inside a string.
+        bool in_string_;
+
+        /// True if the previous byte inside a string was an unescaped backslash.
+        bool is_escaped_;
+
+        /// True while inside a number or literal.
+        bool in_scalar_;
+
+        /// True if the root value is an object.
+        bool is_root_object_;
+
+        /// True if the next top-level string is a key.
+        bool expect_key_;
+
+        /// True while inside the nominated array.
+        bool in_array_;
+
+        /// The nesting depth inside the nominated array: 2 for a top-level member, or 1 for the root array.
+        uint32_t array_depth_;
+
+        /// The offset of the first byte of the current top-level key (after the quote).
+        size_t key_start_;
+
+        /// The offset of the current top-level member value.
+        size_t value_start_;
+
+        /// The offset of the current element of the nominated array.
+        size_t element_start_;
+
+        /// The raw text of the current top-level key.
+        std::string current_key_;
+
+        /// The complete top-level members, as raw key text and value span.
+        std::vector<std::pair<std::string, JsonSpan> > members_;
+
+        /// The complete elements of the nominated array.
+        std::vector<JsonSpan> elements_;
+    };
+}  // namespace UpdateCheckApiJson
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_JSON_TAPE_H_
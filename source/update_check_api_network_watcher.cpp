@@ -0,0 +1,427 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Watches whether the network is reachable, to gate checks for updates.
+//==============================================================================
+#include "update_check_api_network_watcher.h"
+#include "update_check_api_strings.h"
+
+#include <atomic>
+#include <initializer_list>
+#include <utility>
+
+#ifdef __linux__
+#include <thread>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace UpdateCheck
+{
+    // The number of running NetworkWatchers that know there is no default route.
+    static std::atomic<int> unreachable_watcher_count(0);
+
+#ifdef __linux__
+    // The size of the buffer that netlink messages are received into.
+    static const size_t kNetlinkBufferSize = 32768;
+
+    /// @brief Open a netlink socket for routing messages.
+    ///
+    /// @param [in] groups The multicast groups to receive notifications from; 0 for none.
+    ///
+    /// @return The socket, or -1 if it could not be opened.
+    static int OpenRouteSocket(unsigned int groups)
+    {
+        int route_socket = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+
+        if (route_socket >= 0)
+        {
+            struct sockaddr_nl address;
+            memset(&address, 0, sizeof(address));
+            address.nl_family = AF_NETLINK;
+            address.nl_groups = groups;
+
+            if (bind(route_socket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0)
+            {
+                int bind_error = errno;
+                close(route_socket);
+                route_socket = -1;
+                errno        = bind_error;
+            }
+        }
+
+        return route_socket;
+    }
+
+    /// @brief Check whether a route is a default route that can carry traffic.
+    ///
+    /// @param [in] header The RTM_NEWROUTE message that describes the route.
+    ///
+    /// @return true if the route is a usable default route; false otherwise.
+    static bool IsUsableDefaultRoute(const struct nlmsghdr* header)
+    {
+        const struct rtmsg* route = static_cast<const struct rtmsg*>(NLMSG_DATA(header));
+
+        // Unreachable, blackhole and prohibit routes do not lead anywhere, and neither
+        // do routes whose next hop is dead or whose interface has lost its carrier.
+        bool is_usable = (route->rtm_dst_len == 0) && (route->rtm_type == RTN_UNICAST) && ((route->rtm_flags & (RTNH_F_DEAD | RTNH_F_LINKDOWN)) == 0);
+
+        // The local table only holds routes to this machine's own addresses.
+        unsigned int table = route->rtm_table;
+
+        int                  attributes_size = RTM_PAYLOAD(header);
+        const struct rtattr* attribute       = RTM_RTA(route);
+
+        for (; is_usable && RTA_OK(attribute, attributes_size); attribute = RTA_NEXT(attribute, attributes_size))
+        {
+            if (attribute->rta_type == RTA_TABLE && RTA_PAYLOAD(attribute) >= sizeof(unsigned int))
+            {
+                memcpy(&table, RTA_DATA(attribute), sizeof(table));
+            }
+        }
+
+        return is_usable && (table != RT_TABLE_LOCAL);
+    }
+
+    /// @brief List the IPv4 and IPv6 routes of the machine, and look for a usable default route.
+    ///
+    /// @param [out] has_default_route true if a usable default route exists.
+    ///
+    /// @return true if the routes were listed; false otherwise.
+    static bool FindDefaultRoute(bool& has_default_route)
+    {
+        bool is_listed    = false;
+        has_default_route = false;
+
+        int route_socket = OpenRouteSocket(0);
+
+        if (route_socket >= 0)
+        {
+            struct
+            {
+                struct nlmsghdr header;
+                struct rtmsg    route;
+            } request;
+            memset(&request, 0, sizeof(request));
+            request.header.nlmsg_len   = NLMSG_LENGTH(sizeof(struct rtmsg));
+            request.header.nlmsg_type  = RTM_GETROUTE;
+            request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+            request.header.nlmsg_seq   = 1;
+            request.route.rtm_family   = AF_UNSPEC;
+
+            if (send(route_socket, &request, request.header.nlmsg_len, 0) == static_cast<ssize_t>(request.header.nlmsg_len))
+            {
+                std::unique_ptr<char[]> buffer(new char[kNetlinkBufferSize]);
+                bool                    is_done = false;
+
+                while (!is_done)
+                {
+                    ssize_t received = recv(route_socket, buffer.get(), kNetlinkBufferSize, 0);
+
+                    if (received < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    if (received <= 0)
+                    {
+                        break;
+                    }
+
+                    int message_size = static_cast<int>(received);
+
+                    const struct nlmsghdr* header = reinterpret_cast<const struct nlmsghdr*>(buffer.get());
+
+                    for (; NLMSG_OK(header, message_size); header = NLMSG_NEXT(header, message_size))
+                    {
+                        if (header->nlmsg_type == NLMSG_DONE)
+                        {
+                            is_listed = true;
+                            is_done   = true;
+                            break;
+                        }
+                        else if (header->nlmsg_type == NLMSG_ERROR)
+                        {
+                            is_done = true;
+                            break;
+                        }
+                        else if (header->nlmsg_type == RTM_NEWROUTE && IsUsableDefaultRoute(header))
+                        {
+                            has_default_route = true;
+                        }
+                    }
+                }
+            }
+
+            close(route_socket);
+        }
+
+        return is_listed;
+    }
+
+    struct NetlinkRouteMonitor::Impl
+    {
+        Impl()
+            : event_socket(-1)
+        {
+            stop_pipe[0] = -1;
+            stop_pipe[1] = -1;
+        }
+
+        /// @brief Wait for route notifications, and report when the default route comes or goes.
+        ///
+        /// @param [in] has_default_route Whether a default route existed when the monitor started.
+        void Run(bool has_default_route)
+        {
+            std::unique_ptr<char[]> buffer(new char[kNetlinkBufferSize]);
+
+            for (;;)
+            {
+                struct pollfd poll_fds[2];
+                poll_fds[0].fd     = event_socket;
+                poll_fds[0].events = POLLIN;
+                poll_fds[1].fd     = stop_pipe[0];
+                poll_fds[1].events = POLLIN;
+
+                if (poll(poll_fds, 2, -1) < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    break;
+                }
+
+                if (poll_fds[1].revents != 0)
+                {
+                    break;
+                }
+
+                if (poll_fds[0].revents != 0)
+                {
+                    // A change usually arrives as a burst of notifications. Drain them all and
+                    // list the routes once; that also recovers from notifications that the
+                    // kernel dropped because the socket's buffer was full (ENOBUFS).
+                    ssize_t received = 0;
+
+                    do
+                    {
+                        received = recv(event_socket, buffer.get(), kNetlinkBufferSize, MSG_DONTWAIT);
+                    } while (received > 0 || (received < 0 && (errno == EINTR || errno == ENOBUFS)));
+
+                    bool has_route = false;
+
+                    if (FindDefaultRoute(has_route) && has_route != has_default_route)
+                    {
+                        has_default_route = has_route;
+                        callback(has_default_route);
+                    }
+                }
+            }
+        }
+
+        /// The socket that receives route, address and link notifications.
+        int event_socket;
+
+        /// Written to, to stop the thread.
+        int stop_pipe[2];
+
+        /// The thread that waits for notifications.
+        std::thread thread;
+
+        /// The function to call when the default route comes or goes.
+        RouteCallback callback;
+    };
+
+    NetlinkRouteMonitor::NetlinkRouteMonitor()
+        : impl_(new Impl())
+    {
+    }
+
+    NetlinkRouteMonitor::~NetlinkRouteMonitor()
+    {
+        Stop();
+    }
+
+    bool NetlinkRouteMonitor::Start(const RouteCallback& callback, std::string& error_message)
+    {
+        Stop();
+
+        // Subscribe before listing the routes, so that no change in between is missed.
+        // Links are watched too, because losing the carrier only flags the routes.
+        impl_->event_socket = OpenRouteSocket(RTMGRP_IPV4_ROUTE | RTMGRP_IPV6_ROUTE | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR | RTMGRP_LINK);
+
+        bool has_default_route = false;
+        bool is_started        = false;
+
+        if (impl_->event_socket < 0 || pipe2(impl_->stop_pipe, O_CLOEXEC) != 0)
+        {
+            error_message.append(kStringErrorFailedToWatchNetwork);
+            error_message.append(strerror(errno));
+        }
+        else if (!FindDefaultRoute(has_default_route))
+        {
+            error_message.append(kStringErrorFailedToWatchNetwork);
+            error_message.append(kStringErrorFailedToListRoutes);
+        }
+        else
+        {
+            try
+            {
+                impl_->callback = callback;
+                impl_->callback(has_default_route);
+                impl_->thread = std::thread(&Impl::Run, impl_.get(), has_default_route);
+                is_started    = true;
+            }
+            catch (const std::exception& e)
+            {
+                error_message.append(kStringErrorFailedToWatchNetwork);
+                error_message.append(e.what());
+            }
+        }
+
+        if (!is_started)
+        {
+            Stop();
+        }
+
+        return is_started;
+    }
+
+    void NetlinkRouteMonitor::Stop()
+    {
+        if (impl_->thread.joinable())
+        {
+            const char stop = 0;
+
+            while (write(impl_->stop_pipe[1], &stop, sizeof(stop)) < 0 && errno == EINTR)
+            {
+            }
+
+            impl_->thread.join();
+        }
+
+        for (int* fd : {&impl_->event_socket, &impl_->stop_pipe[0], &impl_->stop_pipe[1]})
+        {
+            if (*fd >= 0)
+            {
+                close(*fd);
+                *fd = -1;
+            }
+        }
+
+        impl_->callback = nullptr;
+    }
+#else
+    struct NetlinkRouteMonitor::Impl
+    {
+    };
+
+    NetlinkRouteMonitor::NetlinkRouteMonitor()
+        : impl_(new Impl())
+    {
+    }
+
+    NetlinkRouteMonitor::~NetlinkRouteMonitor()
+    {
+    }
+
+    bool NetlinkRouteMonitor::Start(const RouteCallback& callback, std::string& error_message)
+    {
+        (void)callback;
+        error_message.append(kStringErrorNetworkWatchingNotSupported);
+        return false;
+    }
+
+    void NetlinkRouteMonitor::Stop()
+    {
+    }
+#endif
+
+    NetworkWatcher::NetworkWatcher()
+        : monitor_(new NetlinkRouteMonitor())
+        , is_reachable_(true)
+    {
+    }
+
+    NetworkWatcher::NetworkWatcher(std::unique_ptr<RouteMonitor> monitor)
+        : monitor_(std::move(monitor))
+        , is_reachable_(true)
+    {
+    }
+
+    NetworkWatcher::~NetworkWatcher()
+    {
+        Stop();
+    }
+
+    bool NetworkWatcher::Start(const std::function<void()>& reachable_callback, std::string& error_message)
+    {
+        Stop();
+
+        reachable_callback_ = reachable_callback;
+
+        bool is_started = (monitor_ != nullptr) && monitor_->Start([this](bool has_default_route) { OnRouteChange(has_default_route); }, error_message);
+
+        if (!is_started)
+        {
+            // A watcher that does not work must not suppress checks.
+            SetReachable(true);
+        }
+
+        return is_started;
+    }
+
+    void NetworkWatcher::Stop()
+    {
+        if (monitor_ != nullptr)
+        {
+            monitor_->Stop();
+        }
+
+        SetReachable(true);
+    }
+
+    bool NetworkWatcher::IsReachable() const
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        return is_reachable_;
+    }
+
+    void NetworkWatcher::OnRouteChange(bool has_default_route)
+    {
+        // Call back outside of the lock, so that the callback may check the state.
+        if (SetReachable(has_default_route) && reachable_callback_)
+        {
+            reachable_callback_();
+        }
+    }
+
+    bool NetworkWatcher::SetReachable(bool is_reachable)
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+
+        bool became_reachable = is_reachable && !is_reachable_;
+
+        if (is_reachable != is_reachable_)
+        {
+            is_reachable_ = is_reachable;
+            unreachable_watcher_count.fetch_add(is_reachable ? -1 : 1);
+        }
+
+        return became_reachable;
+    }
+
+    bool IsNetworkReachable()
+    {
+        return unreachable_watcher_count.load() == 0;
+    }
+}  // namespace UpdateCheck
@@ -0,0 +1,159 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Watches whether the network is reachable, to gate checks for updates.
+///
+/// A NetworkWatcher considers the network reachable while the machine has a
+/// default route. While any watcher knows that there is none, CheckForUpdates()
+/// fails right away for remote URLs, instead of launching a download that can
+/// only time out. When a default route appears again, the watcher calls back,
+/// so that the application can check immediately rather than waiting for its
+/// next scheduled check.
+///
+/// On Linux, the routes are watched with a netlink socket, which the kernel
+/// notifies of every route and address change (RTM_NEWROUTE, RTM_DELROUTE,
+/// RTM_NEWADDR and RTM_DELADDR). The source of route changes is a RouteMonitor,
+/// so that tests can simulate the network going down and coming back.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_NETWORK_WATCHER_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_NETWORK_WATCHER_H_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace UpdateCheck
+{
+    /// @brief A function that receives whether the machine has a default route.
+    ///
+    /// @param [in] has_default_route true if an IPv4 or IPv6 default route exists.
+    typedef std::function<void(bool has_default_route)> RouteCallback;
+
+    /// @brief A source of changes to the default routes of the machine.
+    class RouteMonitor
+    {
+    public:
+        /// @brief Destructor.
+        virtual ~RouteMonitor() = default;
+
+        /// @brief Start reporting whether a default route exists.
+        ///
+        /// The callback is called once with the current state, and then
+        /// whenever it changes; it may be called on another thread.
+        ///
+        /// @param [in]  callback      The function to call with the state.
+        /// @param [out] error_message Any error messages that occurred.
+        ///
+        /// @return true if the monitor started; false otherwise.
+        virtual bool Start(const RouteCallback& callback, std::string& error_message) = 0;
+
+        /// @brief Stop reporting. When this returns, the callback is not running and will not be called again.
+        virtual void Stop() = 0;
+    };
+
+    /// @brief Watches the default routes of a Linux machine with a netlink socket.
+    ///
+    /// A thread waits for route and address notifications from the kernel, and
+    /// then lists the routes to find out whether a usable default route exists.
+    /// On other platforms, Start() fails.
+    class NetlinkRouteMonitor : public RouteMonitor
+    {
+    public:
+        /// @brief Constructor.
+        NetlinkRouteMonitor();
+
+        /// @brief Destructor. Stops the monitor.
+        ~NetlinkRouteMonitor() override;
+
+        /// @brief Start reporting whether a default route exists.
+        ///
+        /// @param [in]  callback      The function to call with the state, on the thread of the monitor.
+        /// @param [out] error_message Any error messages that occurred.
+        ///
+        /// @return true if the monitor started; false if netlink is not available.
+        bool Start(const RouteCallback& callback, std::string& error_message) override;
+
+        /// @brief Stop reporting, and wait for the thread of the monitor to finish.
+        void Stop() override;
+
+    private:
+        NetlinkRouteMonitor(const NetlinkRouteMonitor&)            = delete;
+        NetlinkRouteMonitor& operator=(const NetlinkRouteMonitor&) = delete;
+
+        struct Impl;
+
+        /// The sockets and thread of the monitor.
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /// @brief Tracks whether the network is reachable, and reports when it becomes reachable again.
+    class NetworkWatcher
+    {
+    public:
+        /// @brief Constructor that watches the routes of the machine with the platform's RouteMonitor.
+        NetworkWatcher();
+
+        /// @brief Constructor that watches the routes that a given monitor reports, for example a simulated one.
+        ///
+        /// @param [in] monitor The source of route changes.
+        explicit NetworkWatcher(std::unique_ptr<RouteMonitor> monitor);
+
+        /// @brief Destructor. Stops watching.
+        ~NetworkWatcher();
+
+        /// @brief Start watching the network.
+        ///
+        /// If the monitor cannot start, the network is treated as reachable, so
+        /// that checks are never suppressed by a watcher that does not work.
+        ///
+        /// @param [in]  reachable_callback The function to call when a default route appears after there was none; may be empty.
+        ///                                 It is called on the thread of the monitor, so it should only schedule the check.
+        /// @param [out] error_message      Any error messages that occurred.
+        ///
+        /// @return true if the watcher started; false otherwise.
+        bool Start(const std::function<void()>& reachable_callback, std::string& error_message);
+
+        /// @brief Stop watching the network. The network is then treated as reachable.
+        ///
+        /// This must not be called from the reachable_callback.
+        void Stop();
+
+        /// @brief Check whether the network is reachable.
+        ///
+        /// @return false if the watcher knows that there is no default route; true otherwise.
+        bool IsReachable() const;
+
+    private:
+        NetworkWatcher(const NetworkWatcher&)            = delete;
+        NetworkWatcher& operator=(const NetworkWatcher&) = delete;
+
+        /// @brief Record a change of the default route; called by the monitor.
+        void OnRouteChange(bool has_default_route);
+
+        /// @brief Set whether the network is reachable, and count the watchers that know it is not.
+        ///
+        /// @return true if the network was not reachable before, and is now.
+        bool SetReachable(bool is_reachable);
+
+        /// The source of route changes.
+        std::unique_ptr<RouteMonitor> monitor_;
+
+        /// The function to call when the network becomes reachable again.
+        std::function<void()> reachable_callback_;
+
+        /// Protects is_reachable_.
+        mutable std::mutex state_mutex_;
+
+        /// False while the monitor reports that there is no default route.
+        bool is_reachable_;
+    };
+
+    /// @brief Check whether the network is reachable, according to the NetworkWatchers that are running.
+    ///
+    /// @return false if a running NetworkWatcher knows that there is no default route; true otherwise.
+    bool IsNetworkReachable();
+}  // namespace UpdateCheck
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_NETWORK_WATCHER_H_
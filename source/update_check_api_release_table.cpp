@@ -0,0 +1,429 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A columnar representation of a list of releases.
+//==============================================================================
+#include "update_check_api_release_table.h"
+
+#include <assert.h>
+#include <climits>
+
+namespace UpdateCheck
+{
+    // The number of values of the ReleaseType enum.
+    static const size_t kReleaseTypeCount = static_cast<size_t>(ReleaseType::kDevelopment) + 1;
+
+    // The number of values of the TargetPlatform enum.
+    static const size_t kTargetPlatformCount = static_cast<size_t>(TargetPlatform::kDarwin) + 1;
+
+    const int32_t ReleaseTable::kInvalidDate = INT32_MIN;
+
+    /// @brief Parse a fixed number of decimal digits.
+    ///
+    /// @param [in]  text   The digits.
+    /// @param [in]  count  The number of digits.
+    /// @param [out] value  The parsed value.
+    ///
+    /// @return true if all of the characters are digits; false otherwise.
+    static bool ParseDigits(const char* text, size_t count, int32_t& value)
+    {
+        bool is_valid = true;
+
+        value = 0;
+        for (size_t i = 0; i < count && is_valid; ++i)
+        {
+            is_valid = (text[i] >= '0' && text[i] <= '9');
+            value    = value * 10 + (text[i] - '0');
+        }
+
+        return is_valid;
+    }
+
+    /// @brief Check whether a year is a leap year in the Gregorian calendar.
+    static bool IsLeapYear(int32_t year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+    }
+
+    StringColumn::StringColumn()
+        : offsets_(1, 0)
+    {
+    }
+
+    void StringColumn::Append(const std::string& value)
+    {
+        blob_.append(value);
+        offsets_.push_back(blob_.size());
+    }
+
+    size_t StringColumn::Size() const
+    {
+        return offsets_.size() - 1;
+    }
+
+    void StringColumn::Get(size_t index, const char*& data, size_t& size) const
+    {
+        assert(index < Size());
+        data = blob_.data() + offsets_[index];
+        size = offsets_[index + 1] - offsets_[index];
+    }
+
+    std::string StringColumn::Get(size_t index) const
+    {
+        const char* data = nullptr;
+        size_t      size = 0;
+
+        Get(index, data, size);
+        return std::string(data, size);
+    }
+
+    void StringColumn::Clear()
+    {
+        offsets_.resize(1);
+        blob_.clear();
+    }
+
+    void StringColumn::Reserve(size_t count, size_t bytes)
+    {
+        offsets_.reserve(count + 1);
+        blob_.reserve(bytes);
+    }
+
+    ReleaseTable::ReleaseTable()
+        : tag_starts_(1, 0)
+    {
+    }
+
+    void ReleaseTable::Assign(const UpdateInfo& update_info)
+    {
+        size_t release_count = update_info.releases.size();
+        size_t title_bytes   = 0;
+        size_t tag_count     = 0;
+        size_t tag_bytes     = 0;
+
+        for (auto release_iter = update_info.releases.begin(); release_iter != update_info.releases.end(); ++release_iter)
+        {
+            title_bytes += release_iter->title.size();
+            tag_count += release_iter->tags.size();
+
+            for (auto tag_iter = release_iter->tags.begin(); tag_iter != release_iter->tags.end(); ++tag_iter)
+            {
+                tag_bytes += tag_iter->size();
+            }
+        }
+
+        Clear();
+
+        version_high_.reserve(release_count);
+        version_low_.reserve(release_count);
+        types_.reserve(release_count);
+        platforms_.reserve(release_count);
+        date_days_.reserve(release_count);
+        date_months_.reserve(release_count);
+        titles_.Reserve(release_count, title_bytes);
+        tags_.Reserve(tag_count, tag_bytes);
+        tag_starts_.reserve(release_count + 1);
+
+        for (auto release_iter = update_info.releases.begin(); release_iter != update_info.releases.end(); ++release_iter)
+        {
+            Append(*release_iter);
+        }
+    }
+
+    void ReleaseTable::Append(const ReleaseInfo& release_info)
+    {
+        const VersionInfo& version = release_info.version;
+        version_high_.push_back((static_cast<uint64_t>(version.major) << 32) | version.minor);
+        version_low_.push_back((static_cast<uint64_t>(version.patch) << 32) | version.build);
+
+        types_.push_back(ToTypeMask(release_info.type));
+
+        uint8_t platform_mask = 0;
+        for (auto platform_iter = release_info.target_platforms.begin(); platform_iter != release_info.target_platforms.end(); ++platform_iter)
+        {
+            platform_mask |= ToPlatformMask(*platform_iter);
+        }
+
+        platforms_.push_back(platform_mask);
+
+        int32_t days  = DateToDays(release_info.date);
+        int32_t month = kInvalidDate;
+        if (days != kInvalidDate)
+        {
+            int32_t year          = 0;
+            int32_t month_of_year = 0;
+            ParseDigits(release_info.date.data(), 4, year);
+            ParseDigits(release_info.date.data() + 5, 2, month_of_year);
+            month = ToMonthIndex(year, month_of_year);
+        }
+
+        date_days_.push_back(days);
+        date_months_.push_back(month);
+
+        titles_.Append(release_info.title);
+
+        for (auto tag_iter = release_info.tags.begin(); tag_iter != release_info.tags.end(); ++tag_iter)
+        {
+            tags_.Append(*tag_iter);
+        }
+
+        tag_starts_.push_back(tags_.Size());
+    }
+
+    void ReleaseTable::Clear()
+    {
+        version_high_.clear();
+        version_low_.clear();
+        types_.clear();
+        platforms_.clear();
+        date_days_.clear();
+        date_months_.clear();
+        titles_.Clear();
+        tags_.Clear();
+        tag_starts_.resize(1);
+    }
+
+    size_t ReleaseTable::Size() const
+    {
+        return types_.size();
+    }
+
+    VersionInfo ReleaseTable::GetVersion(size_t index) const
+    {
+        VersionInfo version;
+        version.major = static_cast<uint32_t>(version_high_[index] >> 32);
+        version.minor = static_cast<uint32_t>(version_high_[index]);
+        version.patch = static_cast<uint32_t>(version_low_[index] >> 32);
+        version.build = static_cast<uint32_t>(version_low_[index]);
+
+        return version;
+    }
+
+    uint8_t ReleaseTable::GetTypeMask(size_t index) const
+    {
+        return types_[index];
+    }
+
+    uint8_t ReleaseTable::GetPlatformMask(size_t index) const
+    {
+        return platforms_[index];
+    }
+
+    int32_t ReleaseTable::GetDateDays(size_t index) const
+    {
+        return date_days_[index];
+    }
+
+    int32_t ReleaseTable::GetDateMonth(size_t index) const
+    {
+        return date_months_[index];
+    }
+
+    const StringColumn& ReleaseTable::GetTitles() const
+    {
+        return titles_;
+    }
+
+    const StringColumn& ReleaseTable::GetTags() const
+    {
+        return tags_;
+    }
+
+    size_t ReleaseTable::GetTagStart(size_t index) const
+    {
+        return tag_starts_[index];
+    }
+
+    void ReleaseTable::SelectAll(std::vector<uint8_t>& selection) const
+    {
+        selection.assign(Size(), 1);
+    }
+
+    void ReleaseTable::FilterNewerThan(const VersionInfo& version, std::vector<uint8_t>& selection) const
+    {
+        assert(selection.size() == Size());
+
+        const uint64_t  high         = (static_cast<uint64_t>(version.major) << 32) | version.minor;
+        const uint64_t  low          = (static_cast<uint64_t>(version.patch) << 32) | version.build;
+        const uint64_t* version_high = version_high_.data();
+        const uint64_t* version_low  = version_low_.data();
+        uint8_t*        selected     = selection.data();
+        const size_t    count        = selection.size();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint8_t is_newer = static_cast<uint8_t>((version_high[i] > high) | ((version_high[i] == high) & (version_low[i] > low)));
+            selected[i] &= is_newer;
+        }
+    }
+
+    void ReleaseTable::FilterByType(uint8_t type_mask, std::vector<uint8_t>& selection) const
+    {
+        assert(selection.size() == Size());
+
+        const uint8_t* types    = types_.data();
+        uint8_t*       selected = selection.data();
+        const size_t   count    = selection.size();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            selected[i] &= static_cast<uint8_t>((types[i] & type_mask) != 0);
+        }
+    }
+
+    void ReleaseTable::FilterByPlatform(uint8_t platform_mask, std::vector<uint8_t>& selection) const
+    {
+        assert(selection.size() == Size());
+
+        const uint8_t* platforms = platforms_.data();
+        uint8_t*       selected  = selection.data();
+        const size_t   count     = selection.size();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            selected[i] &= static_cast<uint8_t>((platforms[i] & platform_mask) != 0);
+        }
+    }
+
+    void ReleaseTable::FilterByDate(int32_t first_day, int32_t last_day, std::vector<uint8_t>& selection) const
+    {
+        assert(selection.size() == Size());
+
+        const int32_t* days     = date_days_.data();
+        uint8_t*       selected = selection.data();
+        const size_t   count    = selection.size();
+
+        // Releases without a valid date are excluded, since kInvalidDate is below any valid first_day.
+        for (size_t i = 0; i < count; ++i)
+        {
+            selected[i] &= static_cast<uint8_t>((days[i] >= first_day) & (days[i] <= last_day) & (days[i] != kInvalidDate));
+        }
+    }
+
+    size_t ReleaseTable::CountSelected(const std::vector<uint8_t>& selection)
+    {
+        const uint8_t* selected = selection.data();
+        const size_t   count    = selection.size();
+        uint32_t       total    = 0;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            total += selected[i];
+        }
+
+        return total;
+    }
+
+    void ReleaseTable::CountByType(const std::vector<uint8_t>& selection, std::vector<uint32_t>& counts) const
+    {
+        assert(selection.size() == Size());
+
+        const uint8_t* types    = types_.data();
+        const uint8_t* selected = selection.data();
+        const size_t   count    = selection.size();
+
+        counts.assign(kReleaseTypeCount, 0);
+
+        // Each type gets its own pass over the column, which keeps the loops free of scattered writes.
+        for (size_t type = 0; type < kReleaseTypeCount; ++type)
+        {
+            const uint8_t mask  = ToTypeMask(static_cast<ReleaseType>(type));
+            uint32_t      total = 0;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                total += selected[i] & static_cast<uint8_t>((types[i] & mask) != 0);
+            }
+
+            counts[type] = total;
+        }
+    }
+
+    void ReleaseTable::CountByPlatform(const std::vector<uint8_t>& selection, std::vector<uint32_t>& counts) const
+    {
+        assert(selection.size() == Size());
+
+        const uint8_t* platforms = platforms_.data();
+        const uint8_t* selected  = selection.data();
+        const size_t   count     = selection.size();
+
+        counts.assign(kTargetPlatformCount, 0);
+
+        for (size_t platform = 0; platform < kTargetPlatformCount; ++platform)
+        {
+            const uint8_t mask  = ToPlatformMask(static_cast<TargetPlatform>(platform));
+            uint32_t      total = 0;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                total += selected[i] & static_cast<uint8_t>((platforms[i] & mask) != 0);
+            }
+
+            counts[platform] = total;
+        }
+    }
+
+    void ReleaseTable::CountByMonth(const std::vector<uint8_t>& selection, int32_t first_month, size_t month_count, std::vector<uint32_t>& counts) const
+    {
+        assert(selection.size() == Size());
+
+        const int32_t* months   = date_months_.data();
+        const uint8_t* selected = selection.data();
+        const size_t   count    = selection.size();
+
+        counts.assign(month_count, 0);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            // Releases without a valid date fall far outside of any range.
+            int64_t offset = static_cast<int64_t>(months[i]) - first_month;
+
+            if (selected[i] != 0 && offset >= 0 && static_cast<uint64_t>(offset) < month_count)
+            {
+                ++counts[static_cast<size_t>(offset)];
+            }
+        }
+    }
+
+    uint8_t ReleaseTable::ToTypeMask(ReleaseType release_type)
+    {
+        return static_cast<uint8_t>(1u << static_cast<uint32_t>(release_type));
+    }
+
+    uint8_t ReleaseTable::ToPlatformMask(TargetPlatform platform)
+    {
+        return static_cast<uint8_t>(1u << static_cast<uint32_t>(platform));
+    }
+
+    int32_t ReleaseTable::DateToDays(const std::string& date)
+    {
+        static const int32_t kDaysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+        int32_t days  = kInvalidDate;
+        int32_t year  = 0;
+        int32_t month = 0;
+        int32_t day   = 0;
+
+        if (date.size() == 10 && date[4] == '-' && date[7] == '-' && ParseDigits(date.data(), 4, year) && ParseDigits(date.data() + 5, 2, month) &&
+            ParseDigits(date.data() + 8, 2, day) && month >= 1 && month <= 12 && day >= 1 &&
+            day <= kDaysInMonth[month - 1] + ((month == 2 && IsLeapYear(year)) ? 1 : 0))
+        {
+            // Days from the civil calendar, counting years from March so that leap days fall at the end of the year.
+            int32_t shifted_year = (month <= 2) ? year - 1 : year;
+            int32_t era          = shifted_year / 400;
+            int32_t year_of_era  = shifted_year - era * 400;
+            int32_t day_of_year  = (153 * (month + ((month > 2) ? -3 : 9)) + 2) / 5 + day - 1;
+            int32_t day_of_era   = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+            days = era * 146097 + day_of_era - 719468;
+        }
+
+        return days;
+    }
+
+    int32_t ReleaseTable::ToMonthIndex(int32_t year, int32_t month)
+    {
+        return (year - 1970) * 12 + (month - 1);
+    }
+}  // namespace UpdateCheck
@@ -0,0 +1,280 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A columnar representation of a list of releases.
+///
+/// The ReleaseTable stores one column per attribute instead of one structure
+/// per release, so that scanning a single attribute of many releases touches
+/// contiguous memory. Filters produce a selection with one byte per release,
+/// and are written as branch-free loops over the columns so that the compiler
+/// can vectorize them.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_RELEASE_TABLE_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_RELEASE_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "update_check_api.h"
+
+namespace UpdateCheck
+{
+    /// @brief A column of strings stored back to back in a single buffer.
+    class StringColumn
+    {
+    public:
+        /// @brief Constructor.
+        StringColumn();
+
+        /// @brief Append a string to the end of the column.
+        ///
+        /// @param [in] value The string to append.
+        void Append(const std::string& value);
+
+        /// @brief Get the number of strings in the column.
+        ///
+        /// @return The number of strings.
+        size_t Size() const;
+
+        /// @brief Get a string from the column without copying it.
+        ///
+        /// @param [in]  index The index of the string.
+        /// @param [out] data  A pointer to the first character of the string. The string is not null-terminated.
+        /// @param [out] size  The length of the string in bytes.
+        void Get(size_t index, const char*& data, size_t& size) const;
+
+        /// @brief Get a copy of a string from the column.
+        ///
+        /// @param [in] index The index of the string.
+        ///
+        /// @return The string.
+        std::string Get(size_t index) const;
+
+        /// @brief Remove all strings from the column, keeping the allocated storage.
+        void Clear();
+
+        /// @brief Reserve storage for a number of strings.
+        ///
+        /// @param [in] count The number of strings.
+        /// @param [in] bytes The total length of the strings in bytes.
+        void Reserve(size_t count, size_t bytes);
+
+    private:
+        /// The offset of each string in blob_, followed by the size of blob_.
+        std::vector<size_t> offsets_;
+
+        /// The characters of all strings, back to back.
+        std::string blob_;
+    };
+
+    /// @brief A list of releases stored as columns.
+    ///
+    /// Each release is a row. Versions are stored as two 64-bit keys, which
+    /// compare in the same order as VersionInfo::Compare(). The release type
+    /// and target platforms are stored as bit masks (see GetTypeMask() and
+    /// GetPlatformMask()), and the release date as the number of days and of
+    /// months since 1970-01-01. Download and info links are not stored.
+    class ReleaseTable
+    {
+    public:
+        /// The value of the date columns for releases whose date is not in the format YYYY-MM-DD.
+        static const int32_t kInvalidDate;
+
+        /// @brief Constructor.
+        ReleaseTable();
+
+        /// @brief Replace the contents of the table with a list of releases.
+        ///
+        /// @param [in] update_info The releases.
+        void Assign(const UpdateInfo& update_info);
+
+        /// @brief Append a release to the end of the table.
+        ///
+        /// @param [in] release_info The release.
+        void Append(const ReleaseInfo& release_info);
+
+        /// @brief Remove all releases, keeping the allocated storage.
+        void Clear();
+
+        /// @brief Get the number of releases in the table.
+        ///
+        /// @return The number of releases.
+        size_t Size() const;
+
+        /// @brief Get the version of a release.
+        ///
+        /// @param [in] index The row of the release.
+        ///
+        /// @return The version.
+        VersionInfo GetVersion(size_t index) const;
+
+        /// @brief Get the type of a release as a bit mask.
+        ///
+        /// @param [in] index The row of the release.
+        ///
+        /// @return The bit for the release type.
+        uint8_t GetTypeMask(size_t index) const;
+
+        /// @brief Get the target platforms of a release as a bit mask.
+        ///
+        /// @param [in] index The row of the release.
+        ///
+        /// @return The bits for all of the target platforms.
+        uint8_t GetPlatformMask(size_t index) const;
+
+        /// @brief Get the release date as a number of days since 1970-01-01.
+        ///
+        /// @param [in] index The row of the release.
+        ///
+        /// @return The number of days, or kInvalidDate.
+        int32_t GetDateDays(size_t index) const;
+
+        /// @brief Get the release date as a number of months since 1970-01.
+        ///
+        /// @param [in] index The row of the release.
+        ///
+        /// @return The number of months, or kInvalidDate.
+        int32_t GetDateMonth(size_t index) const;
+
+        /// @brief Get the title of a release.
+        ///
+        /// @return The column of titles.
+        const StringColumn& GetTitles() const;
+
+        /// @brief Get the tags of all releases.
+        ///
+        /// The tags of the release at row i are the entries from GetTagStart(i)
+        /// up to, but not including, GetTagStart(i + 1).
+        ///
+        /// @return The column of tags.
+        const StringColumn& GetTags() const;
+
+        /// @brief Get the index of the first tag of a release in GetTags().
+        ///
+        /// @param [in] index The row of the release; may be Size() to get the end of the last release's tags.
+        ///
+        /// @return The index of the first tag.
+        size_t GetTagStart(size_t index) const;
+
+        /// @brief Select every release.
+        ///
+        /// @param [out] selection One byte per release, set to 1.
+        void SelectAll(std::vector<uint8_t>& selection) const;
+
+        /// @brief Deselect the releases that are not newer than a version.
+        ///
+        /// @param [in]     version   The version to compare against.
+        /// @param [in,out] selection One byte per release; cleared for releases that are not newer.
+        void FilterNewerThan(const VersionInfo& version, std::vector<uint8_t>& selection) const;
+
+        /// @brief Deselect the releases whose type is not in a set of types.
+        ///
+        /// @param [in]     type_mask The bits of the types to keep.
+        /// @param [in,out] selection One byte per release; cleared for releases of other types.
+        void FilterByType(uint8_t type_mask, std::vector<uint8_t>& selection) const;
+
+        /// @brief Deselect the releases that do not target any of a set of platforms.
+        ///
+        /// @param [in]     platform_mask The bits of the platforms to keep.
+        /// @param [in,out] selection     One byte per release; cleared for releases that target none of the platforms.
+        void FilterByPlatform(uint8_t platform_mask, std::vector<uint8_t>& selection) const;
+
+        /// @brief Deselect the releases whose date is outside of a range.
+        ///
+        /// @param [in]     first_day The first day of the range, in days since 1970-01-01.
+        /// @param [in]     last_day  The last day of the range (inclusive).
+        /// @param [in,out] selection One byte per release; cleared for releases outside of the range or without a valid date.
+        void FilterByDate(int32_t first_day, int32_t last_day, std::vector<uint8_t>& selection) const;
+
+        /// @brief Count the selected releases.
+        ///
+        /// @param [in] selection One byte per release.
+        ///
+        /// @return The number of selected releases.
+        static size_t CountSelected(const std::vector<uint8_t>& selection);
+
+        /// @brief Count the selected releases of each type.
+        ///
+        /// @param [in]  selection One byte per release.
+        /// @param [out] counts    The number of releases, indexed by ReleaseType.
+        void CountByType(const std::vector<uint8_t>& selection, std::vector<uint32_t>& counts) const;
+
+        /// @brief Count the selected releases that target each platform.
+        ///
+        /// A release that targets several platforms is counted once for each of them.
+        ///
+        /// @param [in]  selection One byte per release.
+        /// @param [out] counts    The number of releases, indexed by TargetPlatform.
+        void CountByPlatform(const std::vector<uint8_t>& selection, std::vector<uint32_t>& counts) const;
+
+        /// @brief Count the selected releases in each month of a range.
+        ///
+        /// @param [in]  selection   One byte per release.
+        /// @param [in]  first_month The first month of the range, in months since 1970-01.
+        /// @param [in]  month_count The number of months in the range.
+        /// @param [out] counts      The number of releases in each month of the range.
+        void CountByMonth(const std::vector<uint8_t>& selection, int32_t first_month, size_t month_count, std::vector<uint32_t>& counts) const;
+
+        /// @brief Get the bit that represents a release type in the type column.
+        ///
+        /// @param [in] release_type The release type.
+        ///
+        /// @return The bit mask.
+        static uint8_t ToTypeMask(ReleaseType release_type);
+
+        /// @brief Get the bit that represents a platform in the platform column.
+        ///
+        /// @param [in] platform The platform.
+        ///
+        /// @return The bit mask.
+        static uint8_t ToPlatformMask(TargetPlatform platform);
+
+        /// @brief Convert a date in the format YYYY-MM-DD to a number of days since 1970-01-01.
+        ///
+        /// @param [in] date The date.
+        ///
+        /// @return The number of days, or kInvalidDate.
+        static int32_t DateToDays(const std::string& date);
+
+        /// @brief Convert a calendar month to a number of months since 1970-01.
+        ///
+        /// @param [in] year  The year.
+        /// @param [in] month The month, from 1 to 12.
+        ///
+        /// @return The number of months.
+        static int32_t ToMonthIndex(int32_t year, int32_t month);
+
+    private:
+        /// Major and minor version, as (major << 32) | minor.
+        std::vector<uint64_t> version_high_;
+
+        /// Patch and build version, as (patch << 32) | build.
+        std::vector<uint64_t> version_low_;
+
+        /// The release type, as a bit mask.
+        std::vector<uint8_t> types_;
+
+        /// The target platforms, as a bit mask.
+        std::vector<uint8_t> platforms_;
+
+        /// The release date, in days since 1970-01-01.
+        std::vector<int32_t> date_days_;
+
+        /// The release date, in months since 1970-01.
+        std::vector<int32_t> date_months_;
+
+        /// The release titles.
+        StringColumn titles_;
+
+        /// The tags of all releases.
+        StringColumn tags_;
+
+        /// The index of the first tag of each release in tags_, followed by the number of tags.
+        std::vector<size_t> tag_starts_;
+    };
+}  // namespace UpdateCheck
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_RELEASE_TABLE_H_
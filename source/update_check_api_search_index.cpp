@@ -0,0 +1,432 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A full-text search index over the releases of several version files.
+//==============================================================================
+#include "update_check_api_search_index.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <iterator>
+
+namespace UpdateCheck
+{
+    const uint32_t ReleaseSearchIndex::kNoDocument = UINT32_MAX;
+
+    // Removed documents are only dropped once there are at least this many of them, so small indexes are not compacted repeatedly.
+    static const size_t kMinimumRemovedCountToCompact = 1024;
+
+    /// @brief Check whether a byte is part of a word.
+    ///
+    /// @param [in] c The byte.
+    ///
+    /// @return true for ASCII letters and digits, and for the bytes of non-ASCII UTF-8 characters.
+    static bool IsWordByte(unsigned char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c >= 0x80;
+    }
+
+    /// @brief Convert an ASCII letter to lower case.
+    static char ToLower(unsigned char c)
+    {
+        return static_cast<char>((c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c);
+    }
+
+    /// @brief Split a text into words.
+    ///
+    /// @param [in]  text  The text.
+    /// @param [out] words The words, converted to lower case.
+    static void SplitWords(const std::string& text, std::vector<std::string>& words)
+    {
+        words.clear();
+
+        std::string word;
+        for (size_t i = 0; i <= text.size(); ++i)
+        {
+            if (i < text.size() && IsWordByte(static_cast<unsigned char>(text[i])))
+            {
+                word.push_back(ToLower(static_cast<unsigned char>(text[i])));
+            }
+            else if (!word.empty())
+            {
+                words.push_back(word);
+                word.clear();
+            }
+        }
+    }
+
+    /// @brief Append a number to a posting list as a variable-length integer, seven bits per byte.
+    ///
+    /// @param [in]     value  The number.
+    /// @param [in,out] deltas The encoded posting list.
+    static void AppendVarint(uint32_t value, SmallVector<uint8_t, 8>& deltas)
+    {
+        while (value >= 0x80)
+        {
+            deltas.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+
+        deltas.push_back(static_cast<uint8_t>(value));
+    }
+
+    /// @brief Decode a posting list.
+    ///
+    /// @param [in]     deltas    The encoded posting list.
+    /// @param [in,out] documents The list to append the ascending document numbers to.
+    static void DecodePostings(const SmallVector<uint8_t, 8>& deltas, std::vector<uint32_t>& documents)
+    {
+        const uint8_t* data     = deltas.data();
+        const uint8_t* data_end = data + deltas.size();
+        uint32_t       document = 0;
+        bool           is_first = true;
+
+        while (data < data_end)
+        {
+            uint32_t delta = 0;
+            uint32_t shift = 0;
+            while (*data & 0x80)
+            {
+                delta |= static_cast<uint32_t>(*data++ & 0x7f) << shift;
+                shift += 7;
+            }
+
+            delta |= static_cast<uint32_t>(*data++) << shift;
+
+            document = is_first ? delta : document + delta;
+            is_first = false;
+            documents.push_back(document);
+        }
+    }
+
+    ReleaseSearchIndex::ReleaseSearchIndex()
+        : removed_count_(0)
+    {
+    }
+
+    void ReleaseSearchIndex::SetManifest(const std::string& manifest_name, const UpdateInfo& update_info)
+    {
+        auto id_iter = manifest_ids_.find(manifest_name);
+        if (id_iter == manifest_ids_.end())
+        {
+            Manifest new_manifest;
+            new_manifest.name       = manifest_name;
+            new_manifest.is_present = false;
+
+            id_iter = manifest_ids_.insert(std::make_pair(manifest_name, static_cast<uint32_t>(manifests_.size()))).first;
+            manifests_.push_back(new_manifest);
+        }
+
+        uint32_t  manifest_id = id_iter->second;
+        Manifest& manifest    = manifests_[manifest_id];
+
+        RemoveManifestDocuments(manifest);
+        manifest.is_present = true;
+        manifest.release_documents.reserve(update_info.releases.size());
+        manifest.notes_documents.assign(update_info.releases.size(), kNoDocument);
+
+        for (size_t i = 0; i < update_info.releases.size(); ++i)
+        {
+            const ReleaseInfo& release_info = update_info.releases[i];
+
+            manifest.release_documents.push_back(AddDocument(manifest_id, static_cast<uint32_t>(i)));
+            IndexText(release_info.title);
+
+            for (const std::string& tag : release_info.tags)
+            {
+                IndexText(tag);
+            }
+        }
+
+        if (removed_count_ >= kMinimumRemovedCountToCompact && removed_count_ > documents_.size() - removed_count_)
+        {
+            Compact();
+        }
+    }
+
+    bool ReleaseSearchIndex::RemoveManifest(const std::string& manifest_name)
+    {
+        bool was_present = false;
+
+        auto id_iter = manifest_ids_.find(manifest_name);
+        if (id_iter != manifest_ids_.end() && manifests_[id_iter->second].is_present)
+        {
+            Manifest& manifest = manifests_[id_iter->second];
+            RemoveManifestDocuments(manifest);
+            manifest.is_present = false;
+            was_present         = true;
+
+            if (removed_count_ >= kMinimumRemovedCountToCompact && removed_count_ > documents_.size() - removed_count_)
+            {
+                Compact();
+            }
+        }
+
+        return was_present;
+    }
+
+    bool ReleaseSearchIndex::SetReleaseNotes(const std::string& manifest_name, size_t release_index, const std::string& release_notes)
+    {
+        bool is_release_present = false;
+
+        auto id_iter = manifest_ids_.find(manifest_name);
+        if (id_iter != manifest_ids_.end())
+        {
+            uint32_t  manifest_id = id_iter->second;
+            Manifest& manifest    = manifests_[manifest_id];
+
+            if (manifest.is_present && release_index < manifest.release_documents.size())
+            {
+                RemoveDocument(manifest.notes_documents[release_index]);
+                manifest.notes_documents[release_index] = AddDocument(manifest_id, static_cast<uint32_t>(release_index));
+                IndexText(release_notes);
+                is_release_present = true;
+            }
+        }
+
+        return is_release_present;
+    }
+
+    void ReleaseSearchIndex::Search(const std::string& query, std::vector<SearchHit>& hits) const
+    {
+        hits.clear();
+
+        std::vector<std::string> query_words;
+        SplitWords(query, query_words);
+
+        // The documents that contain each query word, ascending.
+        std::vector<std::vector<uint32_t>> word_documents(query_words.size());
+        for (size_t i = 0; i < query_words.size(); ++i)
+        {
+            if (CollectDocuments(query_words[i], word_documents[i]))
+            {
+                std::sort(word_documents[i].begin(), word_documents[i].end());
+                word_documents[i].erase(std::unique(word_documents[i].begin(), word_documents[i].end()), word_documents[i].end());
+            }
+        }
+
+        if (!word_documents.empty())
+        {
+            // Intersect the shortest lists first, so the intermediate results stay small.
+            std::sort(word_documents.begin(), word_documents.end(), [](const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) {
+                return lhs.size() < rhs.size();
+            });
+
+            std::vector<uint32_t> matches;
+            std::vector<uint32_t> intersection;
+            matches.swap(word_documents[0]);
+
+            for (size_t i = 1; i < word_documents.size() && !matches.empty(); ++i)
+            {
+                intersection.clear();
+                std::set_intersection(
+                    matches.begin(), matches.end(), word_documents[i].begin(), word_documents[i].end(), std::back_inserter(intersection));
+                matches.swap(intersection);
+            }
+
+            hits.reserve(matches.size());
+            for (uint32_t document : matches)
+            {
+                if (is_removed_[document] == 0)
+                {
+                    SearchHit hit = {documents_[document].manifest_id, documents_[document].release_index};
+                    hits.push_back(hit);
+                }
+            }
+
+            // A release may match through both its title and its release notes.
+            std::sort(hits.begin(), hits.end(), [](const SearchHit& lhs, const SearchHit& rhs) {
+                return lhs.manifest_id < rhs.manifest_id || (lhs.manifest_id == rhs.manifest_id && lhs.release_index < rhs.release_index);
+            });
+            hits.erase(std::unique(hits.begin(),
+                                   hits.end(),
+                                   [](const SearchHit& lhs, const SearchHit& rhs) {
+                                       return lhs.manifest_id == rhs.manifest_id && lhs.release_index == rhs.release_index;
+                                   }),
+                       hits.end());
+        }
+    }
+
+    const std::string& ReleaseSearchIndex::GetManifestName(uint32_t manifest_id) const
+    {
+        assert(manifest_id < manifests_.size());
+        return manifests_[manifest_id].name;
+    }
+
+    void ReleaseSearchIndex::Compact()
+    {
+        // Renumber the remaining documents in their current order, so that the posting lists stay ascending.
+        std::vector<uint32_t> new_numbers(documents_.size(), kNoDocument);
+        size_t                document_count = 0;
+
+        for (size_t i = 0; i < documents_.size(); ++i)
+        {
+            if (is_removed_[i] == 0)
+            {
+                new_numbers[i]             = static_cast<uint32_t>(document_count);
+                documents_[document_count] = documents_[i];
+                ++document_count;
+            }
+        }
+
+        documents_.resize(document_count);
+        is_removed_.assign(document_count, 0);
+        removed_count_ = 0;
+
+        std::vector<uint32_t> documents;
+        for (auto word_iter = words_.begin(); word_iter != words_.end();)
+        {
+            PostingList& postings = word_iter->second;
+
+            documents.clear();
+            DecodePostings(postings.deltas, documents);
+
+            postings.deltas.clear();
+            postings.count         = 0;
+            postings.last_document = 0;
+
+            for (uint32_t document : documents)
+            {
+                uint32_t new_number = new_numbers[document];
+                if (new_number != kNoDocument)
+                {
+                    AppendVarint((postings.count == 0) ? new_number : new_number - postings.last_document, postings.deltas);
+                    postings.last_document = new_number;
+                    ++postings.count;
+                }
+            }
+
+            if (postings.count == 0)
+            {
+                word_iter = words_.erase(word_iter);
+            }
+            else
+            {
+                ++word_iter;
+            }
+        }
+
+        for (Manifest& manifest : manifests_)
+        {
+            for (uint32_t& document : manifest.release_documents)
+            {
+                document = new_numbers[document];
+            }
+
+            for (uint32_t& document : manifest.notes_documents)
+            {
+                if (document != kNoDocument)
+                {
+                    document = new_numbers[document];
+                }
+            }
+        }
+    }
+
+    size_t ReleaseSearchIndex::GetDocumentCount() const
+    {
+        return documents_.size() - removed_count_;
+    }
+
+    size_t ReleaseSearchIndex::GetWordCount() const
+    {
+        return words_.size();
+    }
+
+    size_t ReleaseSearchIndex::GetPostingSize() const
+    {
+        size_t posting_size = 0;
+        for (const auto& word : words_)
+        {
+            posting_size += word.second.deltas.size();
+        }
+
+        return posting_size;
+    }
+
+    uint32_t ReleaseSearchIndex::AddDocument(uint32_t manifest_id, uint32_t release_index)
+    {
+        assert(documents_.size() < kNoDocument);
+
+        Document document = {manifest_id, release_index};
+        documents_.push_back(document);
+        is_removed_.push_back(0);
+
+        return static_cast<uint32_t>(documents_.size() - 1);
+    }
+
+    void ReleaseSearchIndex::IndexText(const std::string& text)
+    {
+        assert(!documents_.empty());
+        uint32_t document = static_cast<uint32_t>(documents_.size() - 1);
+
+        word_.clear();
+        for (size_t i = 0; i <= text.size(); ++i)
+        {
+            if (i < text.size() && IsWordByte(static_cast<unsigned char>(text[i])))
+            {
+                word_.push_back(ToLower(static_cast<unsigned char>(text[i])));
+            }
+            else if (!word_.empty())
+            {
+                // Only copy the word when it is seen for the first time.
+                auto word_iter = words_.lower_bound(word_);
+                if (word_iter == words_.end() || word_iter->first != word_)
+                {
+                    PostingList new_postings = {SmallVector<uint8_t, 8>(), 0, 0};
+                    word_iter                = words_.insert(word_iter, std::make_pair(word_, new_postings));
+                }
+
+                // Documents are added in ascending order, so each one is appended; a word that repeats within a document is stored once.
+                PostingList& postings = word_iter->second;
+                if (postings.count == 0 || postings.last_document != document)
+                {
+                    AppendVarint((postings.count == 0) ? document : document - postings.last_document, postings.deltas);
+                    postings.last_document = document;
+                    ++postings.count;
+                }
+
+                word_.clear();
+            }
+        }
+    }
+
+    void ReleaseSearchIndex::RemoveDocument(uint32_t document)
+    {
+        if (document != kNoDocument && is_removed_[document] == 0)
+        {
+            is_removed_[document] = 1;
+            ++removed_count_;
+        }
+    }
+
+    void ReleaseSearchIndex::RemoveManifestDocuments(Manifest& manifest)
+    {
+        for (uint32_t document : manifest.release_documents)
+        {
+            RemoveDocument(document);
+        }
+
+        for (uint32_t document : manifest.notes_documents)
+        {
+            RemoveDocument(document);
+        }
+
+        manifest.release_documents.clear();
+        manifest.notes_documents.clear();
+    }
+
+    bool ReleaseSearchIndex::CollectDocuments(const std::string& prefix, std::vector<uint32_t>& documents) const
+    {
+        size_t word_count = 0;
+
+        for (auto word_iter = words_.lower_bound(prefix); word_iter != words_.end() && word_iter->first.compare(0, prefix.size(), prefix) == 0; ++word_iter)
+        {
+            DecodePostings(word_iter->second.deltas, documents);
+            ++word_count;
+        }
+
+        return word_count > 1;
+    }
+}  // namespace UpdateCheck
@@ -0,0 +1,213 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A full-text search index over the releases of several version files.
+///
+/// The ReleaseSearchIndex maps each word of the release titles, tags and
+/// (optionally) release notes to the list of releases that contain it. Words
+/// are kept in sorted order, so that a query word matches every word that it
+/// is a prefix of. The lists of releases are stored as variable-length
+/// deltas between ascending document numbers, which takes one or two bytes
+/// per entry for common words.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_SEARCH_INDEX_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_SEARCH_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "update_check_api.h"
+
+namespace UpdateCheck
+{
+    /// @brief An inverted index over the releases of several version files.
+    ///
+    /// Each version file is added under a name chosen by the caller, such as
+    /// its URL, and can be replaced when it changes. Text is split into words
+    /// at every character that is not an ASCII letter or digit; ASCII letters
+    /// are compared without regard to case, and other UTF-8 characters are
+    /// kept as part of words.
+    ///
+    /// Internally, the title and tags of a release, and its release notes,
+    /// are each a document with an ascending number. Replacing a version file
+    /// or the notes of a release marks the old documents as removed instead of
+    /// rewriting the word lists; Compact() drops them, and is called
+    /// automatically once removed documents outnumber the others.
+    class ReleaseSearchIndex
+    {
+    public:
+        /// @brief A release that matches a query.
+        struct SearchHit
+        {
+            /// The version file of the release; see GetManifestName().
+            uint32_t manifest_id;
+
+            /// The index of the release in the UpdateInfo::releases of the version file.
+            uint32_t release_index;
+        };
+
+        /// @brief Constructor.
+        ReleaseSearchIndex();
+
+        /// @brief Add the releases of a version file to the index, replacing any releases that were added before under the same name.
+        ///
+        /// Release notes that were added for the previous releases are removed as well.
+        ///
+        /// @param [in] manifest_name The name of the version file.
+        /// @param [in] update_info   The releases of the version file.
+        void SetManifest(const std::string& manifest_name, const UpdateInfo& update_info);
+
+        /// @brief Remove the releases of a version file from the index.
+        ///
+        /// @param [in] manifest_name The name of the version file.
+        ///
+        /// @return true if the version file was in the index; false otherwise.
+        bool RemoveManifest(const std::string& manifest_name);
+
+        /// @brief Add the release notes of a release to the index, replacing any notes that were added for it before.
+        ///
+        /// @param [in] manifest_name The name of the version file.
+        /// @param [in] release_index The index of the release in the version file.
+        /// @param [in] release_notes The text of the release notes, as returned by FetchReleaseNotes().
+        ///
+        /// @return true if the release is in the index; false otherwise.
+        bool SetReleaseNotes(const std::string& manifest_name, size_t release_index, const std::string& release_notes);
+
+        /// @brief Find the releases that contain every word of a query.
+        ///
+        /// Each word of the query matches any word that starts with it, so
+        /// "vulk capt" finds a release titled "Fixed a Vulkan capture crash".
+        /// A query without any words matches nothing.
+        ///
+        /// @param [in]  query The query.
+        /// @param [out] hits  The matching releases, ordered by version file and then by release index.
+        void Search(const std::string& query, std::vector<SearchHit>& hits) const;
+
+        /// @brief Get the name of a version file.
+        ///
+        /// @param [in] manifest_id The manifest_id of a SearchHit.
+        ///
+        /// @return The name that the version file was added with.
+        const std::string& GetManifestName(uint32_t manifest_id) const;
+
+        /// @brief Drop removed documents from the word lists, and renumber the remaining documents.
+        void Compact();
+
+        /// @brief Get the number of documents that have not been removed.
+        ///
+        /// @return The number of documents.
+        size_t GetDocumentCount() const;
+
+        /// @brief Get the number of distinct words in the index.
+        ///
+        /// @return The number of words.
+        size_t GetWordCount() const;
+
+        /// @brief Get the size of the encoded word lists.
+        ///
+        /// @return The number of bytes.
+        size_t GetPostingSize() const;
+
+    private:
+        /// The ascending numbers of the documents that contain a word, as variable-length deltas.
+        struct PostingList
+        {
+            /// The first document number, followed by the difference of each number to the one before it.
+            /// Most words occur in a few documents only, so short lists are stored inline.
+            SmallVector<uint8_t, 8> deltas;
+
+            /// The last document number in the list.
+            uint32_t last_document;
+
+            /// The number of documents in the list.
+            uint32_t count;
+        };
+
+        /// @brief A version file and the documents of its releases.
+        struct Manifest
+        {
+            /// The name of the version file.
+            std::string name;
+
+            /// True while the version file is part of the index.
+            bool is_present;
+
+            /// The title and tags document of each release.
+            std::vector<uint32_t> release_documents;
+
+            /// The release notes document of each release, or kNoDocument.
+            std::vector<uint32_t> notes_documents;
+        };
+
+        /// @brief The release that a document belongs to.
+        struct Document
+        {
+            /// The index of the version file in manifests_.
+            uint32_t manifest_id;
+
+            /// The index of the release in the version file.
+            uint32_t release_index;
+        };
+
+        /// @brief Add a new, empty document.
+        ///
+        /// @param [in] manifest_id   The version file.
+        /// @param [in] release_index The release.
+        ///
+        /// @return The number of the document.
+        uint32_t AddDocument(uint32_t manifest_id, uint32_t release_index);
+
+        /// @brief Add each word of a text to the most recently added document.
+        ///
+        /// @param [in] text The text.
+        void IndexText(const std::string& text);
+
+        /// @brief Mark a document as removed.
+        ///
+        /// @param [in] document The number of the document, or kNoDocument.
+        void RemoveDocument(uint32_t document);
+
+        /// @brief Mark all documents of a version file as removed.
+        ///
+        /// @param [in,out] manifest The version file.
+        void RemoveManifestDocuments(Manifest& manifest);
+
+        /// @brief Add the documents that contain any word starting with a prefix to a list.
+        ///
+        /// @param [in]     prefix    The prefix.
+        /// @param [in,out] documents The list; receives ascending document numbers if it was empty and a single word matches.
+        ///
+        /// @return true if the documents of more than one word were added, so that the list needs sorting.
+        bool CollectDocuments(const std::string& prefix, std::vector<uint32_t>& documents) const;
+
+        /// A document number that does not refer to any document.
+        static const uint32_t kNoDocument;
+
+        /// The words of all documents, in sorted order.
+        std::map<std::string, PostingList> words_;
+
+        /// The release of each document.
+        std::vector<Document> documents_;
+
+        /// Non-zero for each document that has been removed.
+        std::vector<uint8_t> is_removed_;
+
+        /// The number of removed documents.
+        size_t removed_count_;
+
+        /// The version files, indexed by manifest id.
+        std::vector<Manifest> manifests_;
+
+        /// The manifest id of each version file name.
+        std::map<std::string, uint32_t> manifest_ids_;
+
+        /// Storage for the current word while text is being split into words.
+        std::string word_;
+    };
+}  // namespace UpdateCheck
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_SEARCH_INDEX_H_
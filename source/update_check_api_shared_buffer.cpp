@@ -0,0 +1,141 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Reference-counted, immutable buffers for downloaded files.
+//==============================================================================
+#include "update_check_api_shared_buffer.h"
+
+#include <assert.h>
+#include <cstring>
+
+namespace UpdateCheckApiUtils
+{
+    // The smallest block that a SharedBufferWriter allocates.
+    static const size_t kMinimumBlockSize = 4096;
+
+    SharedBuffer::SharedBuffer()
+        : offset_(0)
+        , size_(0)
+    {
+    }
+
+    SharedBuffer::SharedBuffer(const std::shared_ptr<const std::string>& block)
+        : block_(block)
+        , offset_(0)
+        , size_((block != nullptr) ? block->size() : 0)
+    {
+    }
+
+    const char* SharedBuffer::Data() const
+    {
+        return (block_ != nullptr) ? block_->data() + offset_ : "";
+    }
+
+    size_t SharedBuffer::Size() const
+    {
+        return size_;
+    }
+
+    bool SharedBuffer::Empty() const
+    {
+        return size_ == 0;
+    }
+
+    SharedBuffer SharedBuffer::Slice(size_t offset, size_t size) const
+    {
+        SharedBuffer slice(*this);
+
+        if (offset > size_)
+        {
+            offset = size_;
+        }
+
+        if (size > size_ - offset)
+        {
+            size = size_ - offset;
+        }
+
+        slice.offset_ = offset_ + offset;
+        slice.size_   = size;
+
+        return slice;
+    }
+
+    const std::shared_ptr<const std::string>& SharedBuffer::GetBlock() const
+    {
+        return block_;
+    }
+
+    size_t SharedBuffer::GetBlockOffset() const
+    {
+        return offset_;
+    }
+
+    SharedBufferWriter::SharedBufferWriter()
+        : size_(0)
+    {
+    }
+
+    char* SharedBufferWriter::Prepare(size_t size)
+    {
+        if (block_.size() - size_ < size)
+        {
+            // Grow geometrically so that the bytes already committed are moved a bounded number of times.
+            size_t block_size = block_.size() * 2;
+            if (block_size < size_ + size)
+            {
+                block_size = size_ + size;
+            }
+
+            if (block_size < kMinimumBlockSize)
+            {
+                block_size = kMinimumBlockSize;
+            }
+
+            // Only the committed bytes need to be kept.
+            block_.resize(size_);
+            block_.resize(block_size);
+        }
+
+        return &block_[0] + size_;
+    }
+
+    void SharedBufferWriter::Commit(size_t size)
+    {
+        assert(size <= block_.size() - size_);
+        size_ += size;
+    }
+
+    void SharedBufferWriter::Append(const char* data, size_t size)
+    {
+        if (size > 0)
+        {
+            memcpy(Prepare(size), data, size);
+            Commit(size);
+        }
+    }
+
+    const char* SharedBufferWriter::Data() const
+    {
+        return block_.data();
+    }
+
+    size_t SharedBufferWriter::Size() const
+    {
+        return size_;
+    }
+
+    SharedBuffer SharedBufferWriter::Publish()
+    {
+        // Shrinking does not reallocate, so the bytes stay where they were written.
+        block_.resize(size_);
+
+        SharedBuffer buffer(std::make_shared<const std::string>(std::move(block_)));
+
+        block_.clear();
+        size_ = 0;
+
+        return buffer;
+    }
+}  // namespace UpdateCheckApiUtils
@@ -0,0 +1,136 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Reference-counted, immutable buffers for downloaded files.
+///
+/// A version file is written once into a SharedBufferWriter, by whatever
+/// receives it (the downloader pipe or a file read), and is then published as
+/// a SharedBuffer. Every later consumer (the parser, and releases that refer
+/// to raw JSON text) shares the same block of memory instead of copying it.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_SHARED_BUFFER_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_SHARED_BUFFER_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace UpdateCheckApiUtils
+{
+    /// @brief An immutable slice of a reference-counted block of memory.
+    ///
+    /// Copying a SharedBuffer or taking a Slice() of it does not copy the
+    /// bytes; the block is released once the last buffer that refers to it is
+    /// destroyed.
+    class SharedBuffer
+    {
+    public:
+        /// @brief Constructor for an empty buffer.
+        SharedBuffer();
+
+        /// @brief Constructor for a buffer that covers an entire block.
+        ///
+        /// @param [in] block The block; may be null for an empty buffer.
+        explicit SharedBuffer(const std::shared_ptr<const std::string>& block);
+
+        /// @brief Get the first byte of the buffer.
+        ///
+        /// @return A pointer to the bytes, which are not null-terminated in the case of a slice.
+        const char* Data() const;
+
+        /// @brief Get the size of the buffer.
+        ///
+        /// @return The number of bytes.
+        size_t Size() const;
+
+        /// @brief Check whether the buffer is empty.
+        ///
+        /// @return true if the buffer has no bytes.
+        bool Empty() const;
+
+        /// @brief Get a part of the buffer that shares the same block.
+        ///
+        /// @param [in] offset The offset of the slice within this buffer; clamped to Size().
+        /// @param [in] size   The size of the slice; clamped to the end of this buffer.
+        ///
+        /// @return The slice.
+        SharedBuffer Slice(size_t offset, size_t size) const;
+
+        /// @brief Get the block that the buffer refers to.
+        ///
+        /// @return The block, or null for an empty buffer that was never assigned one.
+        const std::shared_ptr<const std::string>& GetBlock() const;
+
+        /// @brief Get the offset of the buffer within its block.
+        ///
+        /// @return The offset in bytes.
+        size_t GetBlockOffset() const;
+
+    private:
+        /// The block of memory.
+        std::shared_ptr<const std::string> block_;
+
+        /// The offset of the buffer within block_.
+        size_t offset_;
+
+        /// The size of the buffer.
+        size_t size_;
+    };
+
+    /// @brief Builds the contents of a SharedBuffer in place.
+    ///
+    /// Producers ask for space with Prepare(), write into it directly, and
+    /// then Commit() the bytes they wrote. Publish() hands the block over to a
+    /// SharedBuffer without copying it.
+    class SharedBufferWriter
+    {
+    public:
+        /// @brief Constructor.
+        SharedBufferWriter();
+
+        /// @brief Get space for more bytes at the end of the buffer.
+        ///
+        /// The returned pointer is only valid until the next call to a non-const method.
+        ///
+        /// @param [in] size The number of bytes to make room for.
+        ///
+        /// @return A pointer to at least size writable bytes.
+        char* Prepare(size_t size);
+
+        /// @brief Add bytes that were written to the space returned by Prepare().
+        ///
+        /// @param [in] size The number of bytes that were written; at most the size passed to Prepare().
+        void Commit(size_t size);
+
+        /// @brief Copy bytes to the end of the buffer.
+        ///
+        /// @param [in] data The bytes.
+        /// @param [in] size The number of bytes.
+        void Append(const char* data, size_t size);
+
+        /// @brief Get the bytes that have been committed so far.
+        ///
+        /// @return A pointer to the bytes.
+        const char* Data() const;
+
+        /// @brief Get the number of bytes that have been committed so far.
+        ///
+        /// @return The number of bytes.
+        size_t Size() const;
+
+        /// @brief Hand the committed bytes over to a SharedBuffer, and leave the writer empty.
+        ///
+        /// @return The buffer.
+        SharedBuffer Publish();
+
+    private:
+        /// The block being written; its size is the space available, of which the first size_ bytes are committed.
+        std::string block_;
+
+        /// The number of committed bytes.
+        size_t size_;
+    };
+}  // namespace UpdateCheckApiUtils
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_SHARED_BUFFER_H_
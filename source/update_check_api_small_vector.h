@@ -0,0 +1,420 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief A vector that stores a small number of elements without allocating.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_SMALL_VECTOR_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace UpdateCheck
+{
+    /// @brief A sequence container with storage for N elements inside the object itself.
+    ///
+    /// Elements are only moved to the heap once more than N of them are added,
+    /// so short lists (like the tags or download links of a release) cost no
+    /// allocations. The interface is the subset of std::vector that is used by
+    /// the UpdateCheckAPI and its clients; ToVector() converts to a std::vector
+    /// for code that needs one.
+    template <typename T, size_t N>
+    class SmallVector
+    {
+        static_assert(N > 0, "SmallVector needs room for at least one inline element.");
+
+    public:
+        typedef T        value_type;
+        typedef size_t   size_type;
+        typedef T&       reference;
+        typedef const T& const_reference;
+        typedef T*       iterator;
+        typedef const T* const_iterator;
+
+        /// @brief Constructor.
+        SmallVector()
+            : data_(InlineData())
+            , size_(0)
+            , capacity_(N)
+        {
+        }
+
+        /// @brief Copy constructor.
+        SmallVector(const SmallVector& other)
+            : SmallVector()
+        {
+            Append(other.begin(), other.end());
+        }
+
+        /// @brief Move constructor. Heap storage is taken over; inline elements are moved one by one.
+        SmallVector(SmallVector&& other) noexcept
+            : SmallVector()
+        {
+            TakeFrom(other);
+        }
+
+        /// @brief Construct from a std::vector.
+        explicit SmallVector(const std::vector<T>& other)
+            : SmallVector()
+        {
+            Append(other.begin(), other.end());
+        }
+
+        /// @brief Destructor.
+        ~SmallVector()
+        {
+            clear();
+            FreeHeap();
+        }
+
+        /// @brief Copy assignment.
+        SmallVector& operator=(const SmallVector& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                Append(other.begin(), other.end());
+            }
+
+            return *this;
+        }
+
+        /// @brief Move assignment.
+        SmallVector& operator=(SmallVector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                FreeHeap();
+                TakeFrom(other);
+            }
+
+            return *this;
+        }
+
+        /// @brief Convert to a std::vector.
+        ///
+        /// @return A copy of the elements.
+        std::vector<T> ToVector() const
+        {
+            return std::vector<T>(begin(), end());
+        }
+
+        /// @brief Convert to a std::vector, for code written against the previous std::vector members.
+        operator std::vector<T>() const
+        {
+            return ToVector();
+        }
+
+        iterator begin()
+        {
+            return data_;
+        }
+
+        iterator end()
+        {
+            return data_ + size_;
+        }
+
+        const_iterator begin() const
+        {
+            return data_;
+        }
+
+        const_iterator end() const
+        {
+            return data_ + size_;
+        }
+
+        const_iterator cbegin() const
+        {
+            return data_;
+        }
+
+        const_iterator cend() const
+        {
+            return data_ + size_;
+        }
+
+        T* data()
+        {
+            return data_;
+        }
+
+        const T* data() const
+        {
+            return data_;
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        size_t capacity() const
+        {
+            return capacity_;
+        }
+
+        /// @brief Check whether the elements are stored inside the object.
+        ///
+        /// @return true if no heap storage is in use.
+        bool is_inline() const
+        {
+            return data_ == InlineData();
+        }
+
+        T& operator[](size_t index)
+        {
+            assert(index < size_);
+            return data_[index];
+        }
+
+        const T& operator[](size_t index) const
+        {
+            assert(index < size_);
+            return data_[index];
+        }
+
+        T& front()
+        {
+            return (*this)[0];
+        }
+
+        const T& front() const
+        {
+            return (*this)[0];
+        }
+
+        T& back()
+        {
+            return (*this)[size_ - 1];
+        }
+
+        const T& back() const
+        {
+            return (*this)[size_ - 1];
+        }
+
+        void reserve(size_t capacity)
+        {
+            if (capacity > capacity_)
+            {
+                Grow(capacity);
+            }
+        }
+
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (size_ == capacity_)
+            {
+                // Construct into the new storage before moving the old elements, since args may refer to one of them.
+                size_t new_capacity = capacity_ * 2;
+                T*     new_data     = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+
+                try
+                {
+                    new (new_data + size_) T(std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    ::operator delete(new_data);
+                    throw;
+                }
+
+                try
+                {
+                    MoveTo(new_data, new_capacity);
+                }
+                catch (...)
+                {
+                    new_data[size_].~T();
+                    ::operator delete(new_data);
+                    throw;
+                }
+            }
+            else
+            {
+                new (data_ + size_) T(std::forward<Args>(args)...);
+            }
+
+            ++size_;
+            return back();
+        }
+
+        void pop_back()
+        {
+            assert(size_ > 0);
+            --size_;
+            data_[size_].~T();
+        }
+
+        /// @brief Remove all elements. Heap storage, if any, is kept for reuse.
+        void clear()
+        {
+            for (size_t i = 0; i < size_; ++i)
+            {
+                data_[i].~T();
+            }
+
+            size_ = 0;
+        }
+
+    private:
+        T* InlineData()
+        {
+            return reinterpret_cast<T*>(inline_storage_);
+        }
+
+        const T* InlineData() const
+        {
+            return reinterpret_cast<const T*>(inline_storage_);
+        }
+
+        template <typename Iterator>
+        void Append(Iterator first, Iterator last)
+        {
+            reserve(size_ + static_cast<size_t>(std::distance(first, last)));
+            for (; first != last; ++first)
+            {
+                new (data_ + size_) T(*first);
+                ++size_;
+            }
+        }
+
+        /// @brief Move the elements to new heap storage.
+        void Grow(size_t capacity)
+        {
+            T* new_data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+
+            try
+            {
+                MoveTo(new_data, capacity);
+            }
+            catch (...)
+            {
+                ::operator delete(new_data);
+                throw;
+            }
+        }
+
+        /// @brief Move the elements into storage that was allocated by the caller, and release the old storage.
+        ///
+        /// Like std::vector, elements whose move constructor may throw are copied instead. If an element
+        /// cannot be transferred, the ones already constructed in new_data are destroyed, the container is
+        /// left unchanged, and the exception is rethrown; new_data is still owned by the caller.
+        void MoveTo(T* new_data, size_t new_capacity)
+        {
+            size_t transferred = 0;
+
+            try
+            {
+                for (; transferred < size_; ++transferred)
+                {
+                    new (new_data + transferred) T(std::move_if_noexcept(data_[transferred]));
+                }
+            }
+            catch (...)
+            {
+                for (size_t i = 0; i < transferred; ++i)
+                {
+                    new_data[i].~T();
+                }
+
+                throw;
+            }
+
+            for (size_t i = 0; i < size_; ++i)
+            {
+                data_[i].~T();
+            }
+
+            FreeHeap();
+            data_     = new_data;
+            capacity_ = new_capacity;
+        }
+
+        /// @brief Release heap storage and return to the inline storage. The container must be empty.
+        void FreeHeap()
+        {
+            if (!is_inline())
+            {
+                ::operator delete(data_);
+                data_     = InlineData();
+                capacity_ = N;
+            }
+        }
+
+        /// @brief Take over the elements of another container, leaving it empty. This container must be empty and inline.
+        void TakeFrom(SmallVector& other)
+        {
+            if (other.is_inline())
+            {
+                for (size_t i = 0; i < other.size_; ++i)
+                {
+                    new (data_ + i) T(std::move(other.data_[i]));
+                }
+
+                size_ = other.size_;
+                other.clear();
+            }
+            else
+            {
+                data_           = other.data_;
+                size_           = other.size_;
+                capacity_       = other.capacity_;
+                other.data_     = other.InlineData();
+                other.size_     = 0;
+                other.capacity_ = N;
+            }
+        }
+
+        /// The elements; points to either inline_storage_ or heap storage.
+        T* data_;
+
+        /// The number of elements.
+        size_t size_;
+
+        /// The number of elements that fit in the current storage.
+        size_t capacity_;
+
+        /// Storage for up to N elements.
+        alignas(T) unsigned char inline_storage_[N * sizeof(T)];
+    };
+
+    template <typename T, size_t N>
+    bool operator==(const SmallVector<T, N>& lhs, const SmallVector<T, N>& rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, size_t N>
+    bool operator!=(const SmallVector<T, N>& lhs, const SmallVector<T, N>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}  // namespace UpdateCheck
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_SMALL_VECTOR_H_
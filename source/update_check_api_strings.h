@@ -31,6 +31,7 @@ const char* const kStringJsonFileExtension = ".json";
 #define RELEASETITLE "ReleaseTitle"
 #define RELEASETYPE "ReleaseType"
 #define DOWNLOADLINKS_PACKAGENAME "PackageName"
+#define RELEASENOTESURL "ReleaseNotesURL"
 
 // JSON tags related to schema 1.5
 #define RELEASEVERSION "ReleaseVersion"
@@ -96,8 +97,23 @@ const char* const kStringDownloaderApplication = "rtda.exe";
 const char* const kStringDownloaderApplication = "./rtda";
 #endif  // __linux__ || __APPLE__
 
+// The local path that makes the downloader write the file to its standard output.
+const char* const kStringDownloaderStandardOutput = "-";
+
+// The product name that the in-process transport sends in the User-Agent header, followed by the API version.
+const char* const kStringTransportUserAgent = "AMD-UpdateCheckApi/";
+
+// The name of the socket that the update check agent listens on. The number is the version of
+// its protocol, so that clients never talk to an agent that speaks another version.
+const char* const kStringAgentSocketName = "amd-update-check-agent-1.sock";
+
+// The environment variable that holds the per-user runtime directory, where the agent's socket is placed.
+const char* const kStringRuntimeDirectoryEnvVariableName = "XDG_RUNTIME_DIR";
+
 // Strings related to the Github Release API.
 const char* const kStringHttpPrefix                      = "http";
+const char* const kStringHttpUrlPrefix                   = "http://";
+const char* const kStringHttpsUrlPrefix                  = "https://";
 const char* const kStringGithubReleasesLatest            = "/releases/latest";
 const char* const kStringLatestJsonFilename              = "AMDToolsLatestRelease.json";
 const char* const kStringTagAssets                       = "assets";
@@ -108,6 +124,45 @@ const char* const kStringErrorMissingAssetsTags          = "The latest releases
 const char* const kStringErrorAssetNotFound              = "The required asset was not found in the assets list. ";
 const char* const kStringErrorDownloadUrlNotFoundInAsset = "The download url was not found for the required asset. ";
 
+// Strings related to the Github GraphQL API.
+const char* const kStringGithubGraphqlUrl                  = "https://api.github.com/graphql";
+const char* const kStringGithubRepositoriesPath            = "/repos/";
+const char* const kStringTagData                           = "data";
+const char* const kStringTagErrors                         = "errors";
+const char* const kStringTagPath                           = "path";
+const char* const kStringTagLatestRelease                  = "latestRelease";
+const char* const kStringTagTagName                        = "tagName";
+const char* const kStringTagReleaseAssets                  = "releaseAssets";
+const char* const kStringTagNodes                          = "nodes";
+const char* const kStringTagDownloadUrl                    = "downloadUrl";
+const char* const kStringErrorNotALatestReleaseUrl         = "The URL is not a latest release URL of the GitHub Release API: ";
+const char* const kStringErrorRepositoryHasNoLatestRelease = "The repository has no latest release. ";
+const char* const kStringErrorRepositoryNotInResponse      = "The repository is missing from the GraphQL response. ";
+const char* const kStringErrorGraphqlQueryFailed           = "The GraphQL query failed: ";
+
+// Strings related to listing the releases of a Github repository by channel.
+const char* const kStringGithubReleasesChannel            = "/releases#channel=";
+const char* const kStringStableChannel                    = "stable";
+const char* const kStringPrereleaseChannel                = "prerelease";
+const char* const kStringTagDraft                         = "draft";
+const char* const kStringTagPrerelease                    = "prerelease";
+const char* const kStringTagReleaseTagName                = "tag_name";
+const char* const kStringLinkRelationLast                 = "rel=\"last\"";
+const char* const kStringLinkRelationNext                 = "rel=\"next\"";
+const char* const kStringErrorChannelReleaseNotFound      = "No release of the channel carries the required asset. ";
+const char* const kStringErrorFailedToListReleases        = "Failed to list the releases: ";
+const char* const kStringErrorResponseIsNotAReleaseList   = "the response is not a list of releases.";
+const char* const kStringErrorChannelReleasesNotSupported = "Finding the release of a channel requires the in-process transport (UPDATECHECKAPI_ENABLE_CURL).";
+
+// Strings related to negotiating the schema and encoding of a version file with the server.
+const char* const kStringHeaderAcceptVersionFile        = "Accept: application/json, application/cbor;q=0.9, application/msgpack;q=0.8";
+const char* const kStringHeaderAcceptJson               = "Accept: application/json";
+const char* const kStringHeaderMaxSchemaVersion         = "X-UpdateCheck-Max-Schema: " CURRENT_SCHEMA_VERSION;
+const char* const kStringMediaTypeCbor                  = "application/cbor";
+const char* const kStringMediaTypeMessagePack           = "application/msgpack";
+const char* const kStringMediaTypeMessagePackLegacy     = "application/x-msgpack";
+const char* const kStringErrorFailedToDecodeVersionFile = "Failed to decode the version file: ";
+
 // High Level Error Messages.
 const char* const kStringErrorUrlMustPointToAJsonFile                         = "URL must point to a JSON file.";
 const char* const kStringErrorUnableToFindTempDirectory                       = "Unable to find temp directory.";
@@ -115,14 +170,38 @@ const char* const kStringErrorUnknownErrorOccurred                            =
 const char* const kStringErrorFailedToLaunchVersionFileDownloader             = "Failed to launch the Radeon Tools Download Assistant (rtda).";
 const char* const kStringErrorFailedToLaunchVersionFileDownloaderUnknownError = "Failed to launch the Radeon Tools Download Assistant (rtda) due to an unknown error: ";
 const char* const kStringErrorFailedToLoadLatestReleaseInformation            = "Failed to load latest release information.";
+const char* const kStringErrorFailedToInitializeTransport                     = "Failed to initialize the HTTP transport (libcurl).";
+const char* const kStringErrorTransferFailed                                  = "Failed to download ";
+const char* const kStringErrorUrlContainsInvalidCharacters                    = "The URL contains characters that are not allowed in a URL: ";
+const char* const kStringErrorHttpStatus                                      = "the server responded with HTTP status ";
+const char* const kStringErrorTransferCancelled                               = "the download was cancelled.";
+const char* const kStringErrorNetworkUnreachable                              = "The network is unreachable, because there is no default route.";
+const char* const kStringErrorNetworkWatchingNotSupported                     = "Watching the network is not supported on this platform.";
+const char* const kStringErrorFailedToWatchNetwork                            = "Failed to watch the network for changes: ";
+const char* const kStringErrorFailedToListRoutes                              = "the routes could not be listed.";
+const char* const kStringErrorAgentNotSupported                               = "The update check agent is not supported on this platform.";
+const char* const kStringErrorAgentAlreadyRunning                             = "An update check agent is already running at ";
+const char* const kStringErrorFailedToStartAgent                              = "Failed to start the update check agent: ";
+const char* const kStringErrorAgentSocketPathTooLong                          = "the path of its socket is too long.";
+const char* const kStringErrorFailedToSubscribeToAgent                        = "Failed to subscribe to the update check agent: ";
+const char* const kStringErrorAgentNotRunning                                 = "the update check agent is not running.";
+const char* const kStringErrorAgentDidNotAnswer                               = "the update check agent did not answer.";
 const char* const kStringErrorFailedToDownloadVersionFile                     = "Failed to download version file.";
 const char* const kStringErrorFailedToLoadVersionFile                         = "Failed to load version file.";
 const char* const kStringErrorDownloadedAnEmptyVersionFile                    = "Downloaded an empty version file.";
+const char* const kStringErrorDownloadedFileIsNotValidUtf8                    = "The downloaded file is not valid UTF-8 text.";
+const char* const kStringErrorReleaseNotesUrlIsEmpty                          = "The release does not have a " RELEASENOTESURL ".";
+const char* const kStringErrorFailedToLoadReleaseNotes                        = "Failed to load the release notes.";
+const char* const kStringErrorReleaseNotesAreEmpty                            = "The release notes are empty.";
+const char* const kStringErrorReleaseNotesAreNotValidUtf8                     = "The release notes are not valid UTF-8 text.";
 const char* const kStringFailedToParseVersionFile                             = "Failed to parse version file.";
 const char* const kStringErrorUnsupportedSchemaVersion =
     "The schema version of the version file is not supported; latest supported version is " CURRENT_SCHEMA_VERSION ".";
 const char* const kStringErrorUnableToConvert1_5To1_6 = "Unable to convert from UpdateCheckApi Schema 1.5 to 1.6.";
 const char* const kStringErrorUnableToConvert1_3To1_6 = "Unable to convert from UpdateCheckApi Schema 1.3 to 1.6.";
+const char* const kStringErrorMalformedJson           = "The JSON document is malformed near byte offset ";
+const char* const kStringErrorJsonDocumentTooLarge    = "The JSON document is too large to be parsed. ";
+const char* const kStringErrorInvalidUtf8             = "The JSON document is not valid UTF-8 text. ";
 
 // Error Messages related to missing or invalid JSON tags.
 #define VERSION_FILE_IS_MISSING_THE "The version file is missing the "
@@ -173,5 +252,6 @@ const char* const kStringErrorVersionFileContainsAnEmptyInfoPageLinksList
 const char* const kStringErrorVersionFileContainsAnIncompleteInfoPageLinksEntry = "The version file contains an incomplete " INFOPAGELINKS " entry. ";
 const char* const kStringErrorVersionFileContainsAnEmptyDownloadLinksList       = "The version file contains an empty " DOWNLOADLINKS " list. ";
 const char* const kStringErrorVersionFileContainsAnIncompleteDownloadLinksEntry = "The version file contains an incomplete " DOWNLOADLINKS " entry. ";
+const char* const kStringErrorVersionFileContainsAnInvalidValueType             = "The version file contains a value of an unexpected type. ";
 
 #endif  // UPDATECHECKAPI_UPDATE_CHECK_API_STRINGS_H_
@@ -0,0 +1,448 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief UTF-8 validation of downloaded buffers.
+//==============================================================================
+#include "update_check_api_utf8.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UPDATECHECKAPI_UTF8_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Text with multi-byte sequences is validated 16 bytes at a time with SSSE3. Unless the
+// compiler may assume SSSE3, the function is compiled for it separately, and only called
+// when the CPU supports it.
+#if defined(__SSSE3__)
+#define UPDATECHECKAPI_UTF8_USE_SSSE3 1
+#define UPDATECHECKAPI_UTF8_SSSE3_FUNCTION static
+#include <tmmintrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define UPDATECHECKAPI_UTF8_USE_SSSE3 1
+#define UPDATECHECKAPI_UTF8_SSSE3_FUNCTION __attribute__((target("ssse3"))) static
+#include <tmmintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define UPDATECHECKAPI_UTF8_USE_SSSE3 1
+#define UPDATECHECKAPI_UTF8_SSSE3_FUNCTION static
+#include <intrin.h>
+#include <tmmintrin.h>
+#endif
+
+namespace UpdateCheckApiUtils
+{
+    /// The result of validating a span of bytes.
+    enum class Utf8Status
+    {
+        kValid,
+        kInvalid,
+
+        // The span ends in the middle of a multi-byte sequence.
+        kIncomplete
+    };
+
+    /// @brief Get the length of the sequence introduced by a lead byte.
+    ///
+    /// @return The sequence length in bytes, or 0 if the byte cannot start a sequence.
+    static inline size_t SequenceLength(uint8_t lead)
+    {
+        size_t length = 0;
+
+        if (lead < 0x80)
+        {
+            length = 1;
+        }
+        else if (lead >= 0xC2 && lead <= 0xDF)
+        {
+            length = 2;
+        }
+        else if (lead >= 0xE0 && lead <= 0xEF)
+        {
+            length = 3;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4)
+        {
+            length = 4;
+        }
+
+        return length;
+    }
+
+    /// @brief Check a complete multi-byte sequence against the well-formed byte sequences of the Unicode standard (table 3-7).
+    ///
+    /// Overlong encodings, surrogates and code points above U+10FFFF are rejected.
+    static inline bool IsValidSequence(const uint8_t* sequence, size_t length)
+    {
+        uint8_t lead       = sequence[0];
+        uint8_t second_min = 0x80;
+        uint8_t second_max = 0xBF;
+
+        if (lead == 0xE0)
+        {
+            second_min = 0xA0;
+        }
+        else if (lead == 0xED)
+        {
+            second_max = 0x9F;
+        }
+        else if (lead == 0xF0)
+        {
+            second_min = 0x90;
+        }
+        else if (lead == 0xF4)
+        {
+            second_max = 0x8F;
+        }
+
+        bool is_valid = (sequence[1] >= second_min && sequence[1] <= second_max);
+        for (size_t i = 2; is_valid && i < length; ++i)
+        {
+            is_valid = (sequence[i] >= 0x80 && sequence[i] <= 0xBF);
+        }
+
+        return is_valid;
+    }
+
+#ifdef UPDATECHECKAPI_UTF8_USE_SSSE3
+    // The errors that the lookup tables of ValidateBlocksSsse3() detect, one per bit. Each table
+    // sets the bits of the errors that a nibble can be part of, so a bit remains set after the
+    // lookups are and-ed only for a pair of bytes that has that error. The notation is of
+    // the previous byte and then the current byte; '_' is any bit.
+    static const uint8_t kUtf8TooShort          = 1 << 0;  // 11______ 0_______ and 11______ 11______: a lead byte without continuation.
+    static const uint8_t kUtf8TooLong           = 1 << 1;  // 0_______ 10______: a continuation byte after ASCII.
+    static const uint8_t kUtf8Overlong3         = 1 << 2;  // 11100000 100_____
+    static const uint8_t kUtf8TooLarge          = 1 << 3;  // 11110100 1001____ and 11110100 101_____: above U+10FFFF.
+    static const uint8_t kUtf8Surrogate         = 1 << 4;  // 11101101 101_____
+    static const uint8_t kUtf8Overlong2         = 1 << 5;  // 1100000_ 10______
+    static const uint8_t kUtf8TooLarge1000      = 1 << 6;  // 11110101 1000____ and above: above U+10FFFF.
+    static const uint8_t kUtf8Overlong4         = 1 << 6;  // 11110000 1000____
+    static const uint8_t kUtf8TwoContinuations  = 1 << 7;  // 10______ 10______: only valid as the third or fourth byte of a sequence.
+    static const uint8_t kUtf8Carry             = kUtf8TooShort | kUtf8TooLong | kUtf8TwoContinuations;
+    static const uint8_t kUtf8TooLargeAny       = kUtf8TooLarge | kUtf8TooLarge1000;
+    static const uint8_t kUtf8ContinuationError = kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoContinuations;
+
+    // The errors by the high nibble of the previous byte.
+    alignas(16) static const uint8_t kUtf8PreviousHighNibble[16] = {kUtf8TooLong,
+                                                                    kUtf8TooLong,
+                                                                    kUtf8TooLong,
+                                                                    kUtf8TooLong,
+                                                                    kUtf8TooLong,
+                                                                    kUtf8TooLong,
+                                                                    kUtf8TooLong,
+                                                                    kUtf8TooLong,
+                                                                    kUtf8TwoContinuations,
+                                                                    kUtf8TwoContinuations,
+                                                                    kUtf8TwoContinuations,
+                                                                    kUtf8TwoContinuations,
+                                                                    kUtf8TooShort | kUtf8Overlong2,
+                                                                    kUtf8TooShort,
+                                                                    kUtf8TooShort | kUtf8Overlong3 | kUtf8Surrogate,
+                                                                    kUtf8TooShort | kUtf8TooLargeAny | kUtf8Overlong4};
+
+    // The errors by the low nibble of the previous byte.
+    alignas(16) static const uint8_t kUtf8PreviousLowNibble[16] = {kUtf8Carry | kUtf8Overlong3 | kUtf8Overlong2 | kUtf8Overlong4,
+                                                                   kUtf8Carry | kUtf8Overlong2,
+                                                                   kUtf8Carry,
+                                                                   kUtf8Carry,
+                                                                   kUtf8Carry | kUtf8TooLarge,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny | kUtf8Surrogate,
+                                                                   kUtf8Carry | kUtf8TooLargeAny,
+                                                                   kUtf8Carry | kUtf8TooLargeAny};
+
+    // The errors by the high nibble of the current byte.
+    alignas(16) static const uint8_t kUtf8CurrentHighNibble[16] = {kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8ContinuationError | kUtf8Overlong3 | kUtf8TooLarge1000 | kUtf8Overlong4,
+                                                                   kUtf8ContinuationError | kUtf8Overlong3 | kUtf8TooLarge,
+                                                                   kUtf8ContinuationError | kUtf8Surrogate | kUtf8TooLarge,
+                                                                   kUtf8ContinuationError | kUtf8Surrogate | kUtf8TooLarge,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort,
+                                                                   kUtf8TooShort};
+
+    // The largest values of the last three bytes of a block that do not start a sequence that continues in the next block.
+    alignas(16) static const uint8_t kUtf8BlockEndMax[16] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF};
+
+    /// @brief Check whether the CPU supports SSSE3.
+    ///
+    /// @return true if ValidateBlocksSsse3() can be called.
+    static bool IsSsse3Supported()
+    {
+#if defined(__SSSE3__)
+        return true;
+#elif defined(_MSC_VER)
+        int cpu_info[4] = {};
+        __cpuid(cpu_info, 1);
+        return (cpu_info[2] & (1 << 9)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3") != 0;
+#endif
+    }
+
+    /// @brief Validate whole blocks of 16 bytes with the lookup algorithm of Keiser and Lemire,
+    /// "Validating UTF-8 In Less Than One Instruction Per Byte" (2021).
+    ///
+    /// Each byte is checked together with the byte before it by looking up the high and low nibble
+    /// of the previous byte and the high nibble of the byte itself in three tables. The third and
+    /// fourth bytes of sequences, which the pairs cannot tell apart from misplaced continuation
+    /// bytes, are checked separately.
+    ///
+    /// @param [in]     data The bytes to validate.
+    /// @param [in]     size The number of bytes.
+    /// @param [in,out] pos  The offset of the start of a sequence to start from; on return, the offset of the
+    ///                      first sequence that does not end within the blocks, which is left for the caller.
+    ///
+    /// @return false if the blocks contain an invalid sequence; true otherwise.
+    UPDATECHECKAPI_UTF8_SSSE3_FUNCTION bool ValidateBlocksSsse3(const uint8_t* data, size_t size, size_t& pos)
+    {
+        const size_t start = pos;
+
+        const __m128i previous_high_nibble = _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8PreviousHighNibble));
+        const __m128i previous_low_nibble  = _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8PreviousLowNibble));
+        const __m128i current_high_nibble  = _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8CurrentHighNibble));
+        const __m128i block_end_max        = _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8BlockEndMax));
+        const __m128i low_nibble_mask      = _mm_set1_epi8(0x0F);
+        const __m128i third_byte_lead      = _mm_set1_epi8(0xE0 - 0x80);
+        const __m128i fourth_byte_lead     = _mm_set1_epi8(0xF0 - 0x80);
+        const __m128i high_bit             = _mm_set1_epi8(static_cast<char>(0x80));
+
+        __m128i previous_block      = _mm_setzero_si128();
+        __m128i previous_incomplete = _mm_setzero_si128();
+        __m128i errors              = _mm_setzero_si128();
+
+        while (pos + 16 <= size)
+        {
+            // Skip over runs of ASCII 32 bytes at a time. ASCII is valid, unless the previous block ended in the middle of a sequence.
+            const size_t ascii_start = pos;
+            while (pos + 32 <= size)
+            {
+                __m128i first  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+                __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 16));
+
+                if (_mm_movemask_epi8(_mm_or_si128(first, second)) != 0)
+                {
+                    break;
+                }
+
+                pos += 32;
+            }
+
+            if (pos != ascii_start)
+            {
+                errors              = _mm_or_si128(errors, previous_incomplete);
+                previous_incomplete = _mm_setzero_si128();
+                previous_block      = _mm_setzero_si128();
+
+                if (pos + 16 > size)
+                {
+                    break;
+                }
+            }
+
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+
+            if (_mm_movemask_epi8(block) == 0)
+            {
+                errors              = _mm_or_si128(errors, previous_incomplete);
+                previous_incomplete = _mm_setzero_si128();
+            }
+            else
+            {
+                __m128i previous1 = _mm_alignr_epi8(block, previous_block, 15);
+                __m128i previous2 = _mm_alignr_epi8(block, previous_block, 14);
+                __m128i previous3 = _mm_alignr_epi8(block, previous_block, 13);
+
+                __m128i pair_errors = _mm_shuffle_epi8(previous_high_nibble, _mm_and_si128(_mm_srli_epi16(previous1, 4), low_nibble_mask));
+                pair_errors         = _mm_and_si128(pair_errors, _mm_shuffle_epi8(previous_low_nibble, _mm_and_si128(previous1, low_nibble_mask)));
+                pair_errors = _mm_and_si128(pair_errors, _mm_shuffle_epi8(current_high_nibble, _mm_and_si128(_mm_srli_epi16(block, 4), low_nibble_mask)));
+
+                // Two bytes after a lead of 1110____, or three bytes after 11110___, must be a continuation byte,
+                // which the pair lookup reports as kUtf8TwoContinuations; anywhere else, that bit is an error.
+                __m128i is_third_byte  = _mm_subs_epu8(previous2, third_byte_lead);
+                __m128i is_fourth_byte = _mm_subs_epu8(previous3, fourth_byte_lead);
+                __m128i must_continue  = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), high_bit);
+
+                errors              = _mm_or_si128(errors, _mm_xor_si128(pair_errors, must_continue));
+                previous_incomplete = _mm_subs_epu8(block, block_end_max);
+            }
+
+            previous_block = block;
+            pos += 16;
+        }
+
+        // Leave a sequence that continues after the last block to the caller, which sees the bytes that follow.
+        for (size_t back = 1; back <= 3 && back <= pos - start; ++back)
+        {
+            uint8_t byte = data[pos - back];
+
+            if (byte >= 0xC0)
+            {
+                size_t length = SequenceLength(byte);
+                if (length == 0 || length > back)
+                {
+                    pos -= back;
+                }
+
+                break;
+            }
+            else if (byte < 0x80)
+            {
+                break;
+            }
+        }
+
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(errors, _mm_setzero_si128())) == 0xFFFF;
+    }
+#endif
+
+    /// @brief Validate a span of bytes.
+    ///
+    /// @param [in]     data The bytes to validate.
+    /// @param [in]     size The number of bytes.
+    /// @param [in,out] pos  The offset to start from; on return, the offset of the first byte that was not consumed.
+    ///
+    /// @return The validation status.
+    static Utf8Status ValidateSpan(const uint8_t* data, size_t size, size_t& pos)
+    {
+#ifdef UPDATECHECKAPI_UTF8_USE_SSSE3
+        static const bool is_ssse3_supported = IsSsse3Supported();
+
+        if (is_ssse3_supported && !ValidateBlocksSsse3(data, size, pos))
+        {
+            return Utf8Status::kInvalid;
+        }
+#endif
+
+        while (pos < size)
+        {
+            uint8_t lead = data[pos];
+
+            if (lead < 0x80)
+            {
+#ifdef UPDATECHECKAPI_UTF8_USE_SSE2
+                // Skip over runs of ASCII 32 bytes at a time; manifests are almost entirely ASCII.
+                while (pos + 32 <= size)
+                {
+                    __m128i  first  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+                    __m128i  second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 16));
+                    uint32_t mask   = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(first, second)));
+
+                    if (mask != 0)
+                    {
+                        break;
+                    }
+
+                    pos += 32;
+                }
+#endif
+
+                while (pos < size && data[pos] < 0x80)
+                {
+                    ++pos;
+                }
+
+                continue;
+            }
+
+            size_t length = SequenceLength(lead);
+            if (length == 0)
+            {
+                return Utf8Status::kInvalid;
+            }
+            else if (pos + length > size)
+            {
+                return Utf8Status::kIncomplete;
+            }
+            else if (!IsValidSequence(data + pos, length))
+            {
+                return Utf8Status::kInvalid;
+            }
+
+            pos += length;
+        }
+
+        return Utf8Status::kValid;
+    }
+
+    Utf8Validator::Utf8Validator()
+    {
+        Reset();
+    }
+
+    bool Utf8Validator::Update(const char* data, size_t size)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        size_t         pos   = 0;
+
+        // Complete a sequence that was split at the end of the previous chunk.
+        if (is_valid_ && pending_count_ > 0)
+        {
+            size_t sequence_length = SequenceLength(pending_bytes_[0]);
+            size_t needed          = sequence_length - pending_count_;
+            size_t available       = (size < needed) ? size : needed;
+
+            memcpy(pending_bytes_ + pending_count_, bytes, available);
+            pending_count_ += available;
+            pos = available;
+
+            if (pending_count_ == sequence_length)
+            {
+                is_valid_      = IsValidSequence(pending_bytes_, sequence_length);
+                pending_count_ = 0;
+            }
+        }
+
+        if (is_valid_ && pending_count_ == 0)
+        {
+            Utf8Status status = ValidateSpan(bytes, size, pos);
+
+            if (status == Utf8Status::kInvalid)
+            {
+                is_valid_ = false;
+            }
+            else if (status == Utf8Status::kIncomplete)
+            {
+                pending_count_ = size - pos;
+                memcpy(pending_bytes_, bytes + pos, pending_count_);
+            }
+        }
+
+        return is_valid_;
+    }
+
+    bool Utf8Validator::IsComplete() const
+    {
+        return is_valid_ && pending_count_ == 0;
+    }
+
+    void Utf8Validator::Reset()
+    {
+        is_valid_      = true;
+        pending_count_ = 0;
+        memset(pending_bytes_, 0, sizeof(pending_bytes_));
+    }
+
+    bool IsValidUtf8(const char* data, size_t size)
+    {
+        size_t pos = 0;
+        return ValidateSpan(reinterpret_cast<const uint8_t*>(data), size, pos) == Utf8Status::kValid;
+    }
+}  // namespace UpdateCheckApiUtils
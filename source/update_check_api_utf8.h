@@ -0,0 +1,64 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief UTF-8 validation of downloaded buffers.
+//==============================================================================
+#ifndef UPDATECHECKAPI_UPDATE_CHECK_API_UTF8_H_
+#define UPDATECHECKAPI_UPDATE_CHECK_API_UTF8_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace UpdateCheckApiUtils
+{
+    /// @brief Validates that a stream of bytes is well-formed UTF-8.
+    ///
+    /// The stream can be supplied in chunks of any size; multi-byte sequences
+    /// that are split across chunk boundaries are carried over to the next
+    /// call. Runs of ASCII are skipped 32 bytes at a time where SSE2 is
+    /// available, and on CPUs with SSSE3, text with multi-byte sequences is
+    /// validated 16 bytes at a time as well.
+    class Utf8Validator
+    {
+    public:
+        /// @brief Constructor.
+        Utf8Validator();
+
+        /// @brief Validate the next chunk of the stream.
+        ///
+        /// @param [in] data The bytes to validate.
+        /// @param [in] size The number of bytes.
+        ///
+        /// @return true if the stream is still valid; false once an invalid sequence has been seen.
+        bool Update(const char* data, size_t size);
+
+        /// @brief Check whether the complete stream was valid.
+        ///
+        /// @return true if every byte was valid and the stream did not end in the middle of a sequence.
+        bool IsComplete() const;
+
+        /// @brief Reset the validator so that it can be used for a new stream.
+        void Reset();
+
+    private:
+        /// False once an invalid sequence has been seen.
+        bool is_valid_;
+
+        /// The leading bytes of a sequence that was split across chunks.
+        uint8_t pending_bytes_[4];
+
+        /// The number of bytes in pending_bytes_.
+        size_t pending_count_;
+    };
+
+    /// @brief Check whether a buffer is well-formed UTF-8.
+    ///
+    /// @param [in] data The bytes to validate.
+    /// @param [in] size The number of bytes.
+    ///
+    /// @return true if the buffer is valid UTF-8; false otherwise.
+    bool IsValidUtf8(const char* data, size_t size);
+}  // namespace UpdateCheckApiUtils
+
+#endif  // UPDATECHECKAPI_UPDATE_CHECK_API_UTF8_H_
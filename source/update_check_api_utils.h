@@ -7,10 +7,28 @@
 #ifndef UPDATECHECKAPI_UPDATE_CHECK_API_UTILS_H_
 #define UPDATECHECKAPI_UPDATE_CHECK_API_UTILS_H_
 
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace UpdateCheckApiUtils
 {
+    /// @brief A function that receives the output of a command as it is produced.
+    ///
+    /// @param [in] data The bytes of output.
+    /// @param [in] size The number of bytes.
+    ///
+    /// @return true to keep reading; false to terminate the command.
+    typedef std::function<bool(const char* data, size_t size)> OutputCallback;
+
+    /// @brief A function that provides the memory that the next chunk of output of a command is read into.
+    ///
+    /// @param [in] size The maximum size of the chunk in bytes.
+    ///
+    /// @return A pointer to at least size writable bytes.
+    typedef std::function<char*(size_t size)> OutputBufferCallback;
+
     /// @brief Retrieves the temporary directory.
     ///
     /// Files belong in this directory if they are expected to only exist for
@@ -34,6 +52,30 @@ namespace UpdateCheckApiUtils
     ///
     /// @return true if successful; false otherwise.
     bool ExecAndGrabOutput(const char* cmd, const bool& cancel_signal, std::string& cmd_output);
+
+    /// @brief Executes a program and passes its standard output to a callback as it arrives.
+    ///
+    /// The program is started directly, not through a shell, so its arguments
+    /// are passed on exactly as given. This is a synchronous method. The command is terminated if the cancel
+    /// signal is set, or if the callback asks to stop. Each chunk of output is
+    /// read into the memory provided by buffer_callback, and output_callback is
+    /// then called with a pointer into that memory, so the output is not copied.
+    ///
+    /// A command that exits with a non-zero status has failed, even if some of
+    /// its output has already been passed to the callback.
+    ///
+    /// @param [in]  args            The path of the program, followed by its arguments.
+    /// @param [in]  cancel_signal   Reference to a boolean that can be set to true to abort the command execution.
+    /// @param [in]  buffer_callback The function that provides the memory to read each chunk into.
+    /// @param [in]  output_callback The function that receives the output.
+    /// @param [out] error_message   Why the command failed, like "the command exited with code 1.".
+    ///
+    /// @return true if the command ran to completion with an exit status of 0, or was stopped by the callback; false otherwise.
+    bool ExecAndStreamOutput(const std::vector<std::string>& args,
+                             const bool&                     cancel_signal,
+                             const OutputBufferCallback&     buffer_callback,
+                             const OutputCallback&           output_callback,
+                             std::string&                    error_message);
 }
 
 #endif  // UPDATECHECKAPI_UPDATE_CHECK_API_UTILS_H_
@@ -8,16 +8,21 @@
 #include "update_check_api_utils.h"
 
 // C++:
+#include <algorithm>
 #include <assert.h>
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 #include <climits>
+#include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/ioctl.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -26,6 +31,12 @@ namespace UpdateCheckApiUtils
 {
     static const char* kStringErrorFailedToReadOutput = "Error: failed to read output";
 
+    static const char* kStringErrorCommandCouldNotBeLaunched = "the command could not be launched.";
+    static const char* kStringErrorFailedToReadCommandOutput = "the output of the command could not be read.";
+    static const char* kStringErrorCommandWasCancelled       = "the command was cancelled.";
+    static const char* kStringErrorCommandExitedWithCode     = "the command exited with code ";
+    static const char* kStringErrorCommandWasKilledBySignal  = "the command was killed by signal ";
+
     static const char* kLinuxTempDirectoryEnvVariableName = "TMPDIR";
     static const char* kLinuxTempDirectoryDefaultPath     = "/tmp";
 
@@ -160,14 +171,15 @@ namespace UpdateCheckApiUtils
     };
 
     /// This is an alternative implementation of popen() that provides the caller
-    /// with a bidirectional communication channel to the spawned process.
-    static bool popen2(const char* command, popen2_data_t& child_info)
+    /// with a bidirectional communication channel to the spawned process. The
+    /// program is executed directly with its arguments, without a shell.
+    static bool popen2(const char* path, char* const argv[], popen2_data_t& child_info)
     {
         bool  ret = false;
         pid_t child_pid;
         int   pipe_stdin[2], pipe_stdout[2];
 
-        if (command != nullptr && !pipe(pipe_stdin) && !pipe(pipe_stdout))
+        if (!pipe(pipe_stdin) && !pipe(pipe_stdout))
         {
             // Create the child process.
             child_pid = fork();
@@ -179,14 +191,21 @@ namespace UpdateCheckApiUtils
                     // This is the child process. Execute the command.
                     close(pipe_stdin[1]);
                     dup2(pipe_stdin[0], 0);
+                    close(pipe_stdin[0]);
                     close(pipe_stdout[0]);
                     dup2(pipe_stdout[1], 1);
+                    close(pipe_stdout[1]);
 
-                    execl("/bin/sh", "sh", "-c", command, NULL);
-                    perror("execl");
+                    execv(path, argv);
+                    perror("execv");
                     _exit(99);
                 }
 
+                // Close the child's ends of the pipes, so that the output pipe
+                // reports end-of-file once the child exits.
+                close(pipe_stdin[0]);
+                close(pipe_stdout[1]);
+
                 // Set the output.
                 child_info.child_pid          = child_pid;
                 child_info.to_child_channel   = pipe_stdin[1];
@@ -200,6 +219,13 @@ namespace UpdateCheckApiUtils
         return ret;
     }
 
+    /// Runs a command line with the shell, with a bidirectional communication channel to the spawned process.
+    static bool popen2(const char* command, popen2_data_t& child_info)
+    {
+        char* const argv[] = {const_cast<char*>("sh"), const_cast<char*>("-c"), const_cast<char*>(command), nullptr};
+        return (command != nullptr) && popen2("/bin/sh", argv, child_info);
+    }
+
     // Executes the command in a different process and captures its output.
     // This routine blocks, but, using the cancelSignal flag, it allows
     // the caller to terminate the command's execution.
@@ -269,4 +295,149 @@ namespace UpdateCheckApiUtils
         return ret;
     }
 
+    bool ExecAndStreamOutput(const std::vector<std::string>& args,
+                             const bool&                     cancel_signal,
+                             const OutputBufferCallback&     buffer_callback,
+                             const OutputCallback&           output_callback,
+                             std::string&                    error_message)
+    {
+        // The size of each read from the child's output.
+        const size_t kBufferSize = 65536;
+
+        // How long to wait for output before checking the cancel signal again.
+        const int kPollIntervalMilliseconds = 100;
+
+        bool ret = false;
+
+        if (!args.empty())
+        {
+            // The arguments are passed to the program as they are; no shell interprets them.
+            std::vector<char*> argv;
+            for (const std::string& arg : args)
+            {
+                argv.push_back(const_cast<char*>(arg.c_str()));
+            }
+
+            argv.push_back(nullptr);
+
+            // Launch the command.
+            popen2_data_t proc_data;
+
+            if (popen2(argv[0], argv.data(), proc_data))
+            {
+                // Nothing is written to the child.
+                close(proc_data.to_child_channel);
+
+                bool is_finished = false;
+                bool is_stopped  = false;
+                bool is_error    = false;
+
+                while (!is_finished && !is_stopped && !is_error && !cancel_signal)
+                {
+                    pollfd poll_data = {};
+                    poll_data.fd     = proc_data.from_child_channel;
+                    poll_data.events = POLLIN;
+
+                    int poll_result = poll(&poll_data, 1, kPollIntervalMilliseconds);
+
+                    if (poll_result < 0)
+                    {
+                        is_error = (errno != EINTR);
+                    }
+                    else if (poll_result > 0)
+                    {
+                        // Only ask for as much memory as there is output waiting, so that the buffer is not grown for space
+                        // that will never be filled. At the end of the output there is nothing waiting, and one byte is
+                        // enough for the read that reports it.
+                        int    bytes_available = 0;
+                        size_t read_size       = kBufferSize;
+
+                        if (ioctl(proc_data.from_child_channel, FIONREAD, &bytes_available) == 0)
+                        {
+                            read_size = (bytes_available <= 0) ? 1 : std::min(static_cast<size_t>(bytes_available), kBufferSize);
+                        }
+
+                        char*   chunk      = buffer_callback(read_size);
+                        ssize_t bytes_read = read(proc_data.from_child_channel, chunk, read_size);
+
+                        if (bytes_read > 0)
+                        {
+                            is_stopped = !output_callback(chunk, static_cast<size_t>(bytes_read));
+                        }
+                        else if (bytes_read == 0)
+                        {
+                            // The child closed its output.
+                            is_finished = true;
+                        }
+                        else
+                        {
+                            is_error = (errno != EINTR && errno != EAGAIN);
+                        }
+                    }
+                }
+
+                bool has_exited_cleanly = false;
+
+                if (is_finished)
+                {
+                    // The output may be complete, or cut short by an error; only the exit status tells.
+                    int   status      = 0;
+                    pid_t wait_result = -1;
+
+                    do
+                    {
+                        wait_result = waitpid(proc_data.child_pid, &status, 0);
+                    } while (wait_result == -1 && errno == EINTR);
+
+                    if (wait_result == -1)
+                    {
+                        // The status is lost if the application ignores SIGCHLD; the output is all there is to go by.
+                        has_exited_cleanly = true;
+                    }
+                    else if (WIFEXITED(status))
+                    {
+                        has_exited_cleanly = (WEXITSTATUS(status) == 0);
+
+                        if (!has_exited_cleanly)
+                        {
+                            error_message.append(kStringErrorCommandExitedWithCode);
+                            error_message.append(std::to_string(WEXITSTATUS(status)));
+                            error_message.append(".");
+                        }
+                    }
+                    else
+                    {
+                        error_message.append(kStringErrorCommandWasKilledBySignal);
+                        error_message.append(std::to_string(WIFSIGNALED(status) ? WTERMSIG(status) : 0));
+                        error_message.append(".");
+                    }
+                }
+                else
+                {
+                    TerminateProcess(proc_data.child_pid, false);
+
+                    if (is_error)
+                    {
+                        error_message.append(kStringErrorFailedToReadCommandOutput);
+                    }
+                    else if (!is_stopped)
+                    {
+                        error_message.append(kStringErrorCommandWasCancelled);
+                    }
+                }
+
+                ret = (has_exited_cleanly || is_stopped);
+
+                // Close the child's output stream handle.
+                close(proc_data.from_child_channel);
+            }
+            else
+            {
+                error_message.append(kStringErrorCommandCouldNotBeLaunched);
+            }
+        }
+
+        return ret;
+    }
+
 }  // namespace UpdateCheckApiUtils
@@ -12,6 +12,7 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <vector>
 #include <sys/stat.h>
 
 #ifndef WIN32_LEAN_AND_MEAN
@@ -26,6 +27,10 @@ namespace UpdateCheckApiUtils
     static const char* kStringTempFileExtension          = ".txt";
     static const char* kStringErrorFailedToLaunchCommand = "Error: failed to launch the command.";
 
+    static const char* kStringErrorCommandCouldNotBeLaunched = "the command could not be launched.";
+    static const char* kStringErrorCommandWasCancelled       = "the command was cancelled.";
+    static const char* kStringErrorCommandExitedWithCode     = "the command exited with code ";
+
     bool GetTempDirectory(std::string& temp_dir)
     {
         const DWORD kMaxPathLength = MAX_PATH + 1;
@@ -214,4 +219,183 @@ namespace UpdateCheckApiUtils
         return return_value;
     }
 
+    /// @brief Quote an argument for a command line, so that the C runtime of the program splits it back out unchanged.
+    ///
+    /// @param [in] arg The argument.
+    ///
+    /// @return The quoted argument.
+    static std::string QuoteArgument(const std::string& arg)
+    {
+        std::string quoted          = "\"";
+        size_t      backslash_count = 0;
+
+        for (char c : arg)
+        {
+            if (c == '\\')
+            {
+                ++backslash_count;
+            }
+            else
+            {
+                // Backslashes are only special in front of a quote, where each one must be escaped, as must the quote.
+                if (c == '"')
+                {
+                    quoted.append(backslash_count + 1, '\\');
+                }
+
+                backslash_count = 0;
+            }
+
+            quoted += c;
+        }
+
+        // Escape the backslashes in front of the closing quote.
+        quoted.append(backslash_count, '\\');
+        quoted += '"';
+        return quoted;
+    }
+
+    bool ExecAndStreamOutput(const std::vector<std::string>& args,
+                             const bool&                     cancel_signal,
+                             const OutputBufferCallback&     buffer_callback,
+                             const OutputCallback&           output_callback,
+                             std::string&                    error_message)
+    {
+        // The size of each read from the child's output.
+        const DWORD kBufferSize = 65536;
+
+        // How long to wait for output before checking the cancel signal again.
+        const DWORD kPollIntervalMilliseconds = 10;
+
+        bool                return_value = false;
+        SECURITY_ATTRIBUTES sa;
+        sa.nLength              = sizeof(sa);
+        sa.lpSecurityDescriptor = NULL;
+        sa.bInheritHandle       = TRUE;
+
+        HANDLE read_handle  = NULL;
+        HANDLE write_handle = NULL;
+
+        // CreateProcess does not use a shell, but the program splits its own command line, so each argument is quoted.
+        std::string cmd;
+        for (const std::string& arg : args)
+        {
+            cmd += cmd.empty() ? "" : " ";
+            cmd += QuoteArgument(arg);
+        }
+
+        if (!args.empty() && CreatePipe(&read_handle, &write_handle, &sa, 0))
+        {
+            // Only the write end of the pipe is inherited by the child.
+            SetHandleInformation(read_handle, HANDLE_FLAG_INHERIT, 0);
+
+            PROCESS_INFORMATION pi;
+            STARTUPINFO         si;
+            BOOL                was_process_created = FALSE;
+            DWORD               flags               = CREATE_NO_WINDOW;
+
+            ZeroMemory(&pi, sizeof(PROCESS_INFORMATION));
+            ZeroMemory(&si, sizeof(STARTUPINFO));
+            si.cb = sizeof(STARTUPINFO);
+            si.dwFlags |= STARTF_USESTDHANDLES;
+            si.hStdInput  = NULL;
+            si.hStdError  = NULL;
+            si.hStdOutput = write_handle;
+
+#ifdef _UNICODE
+            int cmd_len = MultiByteToWideChar(CP_ACP, 0, cmd.c_str(), -1, NULL, 0);
+
+            WCHAR* cmd_line = new WCHAR[cmd_len];
+            MultiByteToWideChar(CP_ACP, 0, cmd.c_str(), -1, cmd_line, cmd_len);
+#else
+            char* cmd_line = new char[cmd.size() + 1];
+            memcpy(cmd_line, cmd.c_str(), cmd.size() + 1);
+#endif
+            was_process_created = CreateProcess(NULL, cmd_line, NULL, NULL, TRUE, flags, NULL, NULL, &si, &pi);
+
+            delete[] cmd_line;
+
+            // Close this process's copy of the write end, so that reads report a broken pipe once the child exits.
+            CloseHandle(write_handle);
+
+            if (TRUE == was_process_created)
+            {
+                bool is_finished = false;
+                bool is_stopped  = false;
+
+                while (!is_finished && !is_stopped && !cancel_signal)
+                {
+                    DWORD bytes_available = 0;
+
+                    if (!PeekNamedPipe(read_handle, NULL, 0, NULL, &bytes_available, NULL))
+                    {
+                        // The child has exited and all of its output has been read.
+                        is_finished = true;
+                    }
+                    else if (bytes_available == 0)
+                    {
+                        Sleep(kPollIntervalMilliseconds);
+                    }
+                    else
+                    {
+                        // Only ask for as much memory as there is output waiting, so that the buffer is not grown for space
+                        // that will never be filled.
+                        DWORD read_size  = (bytes_available < kBufferSize) ? bytes_available : kBufferSize;
+                        char* chunk      = buffer_callback(read_size);
+                        DWORD bytes_read = 0;
+
+                        if (!ReadFile(read_handle, chunk, read_size, &bytes_read, NULL))
+                        {
+                            is_finished = true;
+                        }
+                        else if (bytes_read > 0)
+                        {
+                            is_stopped = !output_callback(chunk, bytes_read);
+                        }
+                    }
+                }
+
+                if (!is_finished)
+                {
+                    TerminateProcess(pi.hProcess, 1);
+                }
+
+                WaitForSingleObject(pi.hProcess, INFINITE);
+
+                // The output may be complete, or cut short by an error; only the exit code tells.
+                DWORD exit_code          = 0;
+                bool  has_exited_cleanly = false;
+
+                if (is_finished)
+                {
+                    has_exited_cleanly = (GetExitCodeProcess(pi.hProcess, &exit_code) && exit_code == 0);
+
+                    if (!has_exited_cleanly)
+                    {
+                        error_message.append(kStringErrorCommandExitedWithCode);
+                        error_message.append(std::to_string(exit_code));
+                        error_message.append(".");
+                    }
+                }
+                else if (!is_stopped)
+                {
+                    error_message.append(kStringErrorCommandWasCancelled);
+                }
+
+                CloseHandle(pi.hProcess);
+                CloseHandle(pi.hThread);
+
+                return_value = (has_exited_cleanly || is_stopped);
+            }
+            else
+            {
+                error_message.append(kStringErrorCommandCouldNotBeLaunched);
+            }
+
+            CloseHandle(read_handle);
+        }
+
+        return return_value;
+    }
+
 }  // namespace UpdateCheckApiUtils
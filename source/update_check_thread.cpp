@@ -13,6 +13,7 @@ namespace UpdateCheck
         : QObject(nullptr)
     {
         qRegisterMetaType<UpdateCheck::Results>("UpdateCheck::Results");
+        qRegisterMetaType<UpdateCheck::ReleaseNotesResults>("UpdateCheck::ReleaseNotesResults");
         version_info_ = {current_major_version, current_minor_version, current_patch_version, current_build_version};
     }
 
@@ -40,6 +41,24 @@ namespace UpdateCheck
         emit ResultReady(update_check_results);
     }
 
+    void Worker::DoFetchReleaseNotes(const QString& release_notes_url)
+    {
+        UpdateCheck::ReleaseNotesResults release_notes_results;
+        release_notes_results.release_notes_url = release_notes_url;
+
+        // Fetch the release notes, or get them from the cache.
+        std::string temp_release_notes;
+        std::string temp_error_message;
+        release_notes_results.was_fetch_successful =
+            UpdateCheck::FetchReleaseNotes(release_notes_url.toStdString(), temp_release_notes, temp_error_message);
+
+        // The release notes are UTF-8 text.
+        release_notes_results.release_notes = QString::fromStdString(temp_release_notes);
+        release_notes_results.error_message = temp_error_message.c_str();
+
+        emit ReleaseNotesReady(release_notes_results);
+    }
+
     ThreadController::ThreadController(QObject* parent,
                                        uint32_t current_major_version,
                                        uint32_t current_minor_version,
@@ -63,6 +82,10 @@ namespace UpdateCheck
         // When the results are ready from the background thread, notify any listeners.
         connect(worker_object, &Worker::ResultReady, this, &ThreadController::ThreadFinished);
 
+        // Release notes are fetched by the same worker, when requested.
+        connect(this, &ThreadController::DoFetchReleaseNotes, worker_object, &Worker::DoFetchReleaseNotes);
+        connect(worker_object, &Worker::ReleaseNotesReady, this, &ThreadController::ReleaseNotesFinished);
+
         // Start the background thread. This just creates it and lets it sit in the background
         // but does not actually start the check for updates.
         thread_.start();
@@ -96,6 +119,11 @@ namespace UpdateCheck
         }
     }
 
+    void ThreadController::StartFetchReleaseNotes(const QString& release_notes_url)
+    {
+        emit DoFetchReleaseNotes(release_notes_url);
+    }
+
     void ThreadController::ThreadFinished(const UpdateCheck::Results& update_check_results)
     {
         if (was_cancelled_)
@@ -107,4 +135,13 @@ namespace UpdateCheck
             emit CheckForUpdatesComplete(this, update_check_results);
         }
     }
+
+    void ThreadController::ReleaseNotesFinished(const UpdateCheck::ReleaseNotesResults& release_notes_results)
+    {
+        // Results that arrive after a cancellation are dropped, like the results of a check.
+        if (!was_cancelled_)
+        {
+            emit FetchReleaseNotesComplete(this, release_notes_results);
+        }
+    }
 }  // namespace UpdateCheck
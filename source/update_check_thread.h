@@ -37,6 +37,23 @@ namespace UpdateCheck
         UpdateCheck::UpdateInfo update_info;
     };
 
+    /// @brief Contains the release notes that were fetched for a release, and gets passed back to the application through Qt slots & signals.
+    struct ReleaseNotesResults
+    {
+        /// Stores whether the release notes were fetched successfully.
+        bool was_fetch_successful;
+
+        /// The URL that the release notes were requested from, to match the results to the release.
+        QString release_notes_url;
+
+        /// If was_fetch_successful is true, this holds the text of the release notes.
+        QString release_notes;
+
+        /// If was_fetch_successful is false, this holds an error message
+        /// to understand what went wrong.
+        QString error_message;
+    };
+
     /// @brief This is the worker object that gets executed in the background thread.
     ///
     /// Only the ThreadController should ever interact with the Worker, not the
@@ -71,12 +88,22 @@ namespace UpdateCheck
         /// @param [in] updates_asset_filename The updates asset filename.
         void DoCheckForUpdates(const QString& latest_releases_url, const QString& updates_asset_filename);
 
+        /// @brief Activate this slot to fetch the release notes of a release in the background thread.
+        ///
+        /// @param [in] release_notes_url The release notes URL of the release.
+        void DoFetchReleaseNotes(const QString& release_notes_url);
+
     signals:
         /// @brief Signals that the check for updates has completed (either successfully or not) and that a result is available.
         ///
         /// @param [in] update_check_results The results of the check for updates.
         void ResultReady(const UpdateCheck::Results& update_check_results);
 
+        /// @brief Signals that fetching release notes has completed (either successfully or not).
+        ///
+        /// @param [in] release_notes_results The release notes.
+        void ReleaseNotesReady(const UpdateCheck::ReleaseNotesResults& release_notes_results);
+
     private:
         /// @brief Hide the default constructor.
         Worker();
@@ -148,6 +175,20 @@ namespace UpdateCheck
         /// @param [in] thread The thread controller used to check for updates.
         void CheckForUpdatesCancelled(UpdateCheck::ThreadController* thread);
 
+        /// @brief This should NOT be used by an application. See StartFetchReleaseNotes.
+        ///
+        /// This signal is for communication between the ThreadController and
+        /// the worker object to fetch release notes in the background thread.
+        ///
+        /// @param [in] release_notes_url The release notes URL of the release.
+        void DoFetchReleaseNotes(const QString& release_notes_url);
+
+        /// @brief Emitted by the background thread when fetching release notes has completed.
+        ///
+        /// @param [in] thread                The thread controller used to fetch the release notes.
+        /// @param [in] release_notes_results The release notes.
+        void FetchReleaseNotesComplete(UpdateCheck::ThreadController* thread, const UpdateCheck::ReleaseNotesResults& release_notes_results);
+
     public slots:
 
         /// @brief For use by an application to start the check for updates.
@@ -165,6 +206,17 @@ namespace UpdateCheck
         /// should wait until it receives the CheckForUpdatesCancelled signal.
         void CancelCheckForUpdates();
 
+        /// @brief For use by an application to fetch the release notes of a release when the user asks to see them.
+        ///
+        /// The release notes are downloaded in the background thread the first
+        /// time they are requested, and are then kept in memory, so requesting
+        /// them again completes immediately. The FetchReleaseNotesComplete
+        /// signal is emitted with the results. This may be used before, after
+        /// or while checking for updates.
+        ///
+        /// @param [in] release_notes_url The release notes URL of the release (ReleaseInfo::release_notes_url).
+        void StartFetchReleaseNotes(const QString& release_notes_url);
+
     private slots:
         /// @brief This should NOT be used by an application. See CheckForUpdatesComplete.
         ///
@@ -175,6 +227,14 @@ namespace UpdateCheck
         /// @param [in] update_check_results The results of the check for updates.
         void ThreadFinished(const UpdateCheck::Results& update_check_results);
 
+        /// @brief This should NOT be used by an application. See FetchReleaseNotesComplete.
+        ///
+        /// This notifies the ThreadController that the worker object has
+        /// finished fetching release notes.
+        ///
+        /// @param [in] release_notes_results The release notes.
+        void ReleaseNotesFinished(const UpdateCheck::ReleaseNotesResults& release_notes_results);
+
     private:
         /// Indicates that the thread controller received a request to cancel
         /// the check for updates.
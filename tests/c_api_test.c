@@ -0,0 +1,307 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks the C interface from a client that is written in C99.
+///
+/// Usage: c_api_test <test data directory>
+///
+/// The test checks the Schema 1.6 test manifest, reads its releases through
+/// buffers that are too small and large enough, and fetches the release notes
+/// of a local version file, which it writes to the current directory. It also
+/// checks the status of every call that is made with invalid arguments, before
+/// a check, or after a check failed.
+//==============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "update_check_api_c.h"
+
+/// The local version file, and the local release notes that it refers to.
+static const char* const kManifestFilename = "c_api_test.json";
+static const char* const kNotesFilename    = "c_api_test.md";
+
+/// The release notes of the local file.
+static const char* const kNotes = "# Release notes\n\nFixed a crash when opening large captures.\n";
+
+/// The number of failed expectations.
+static int failure_count = 0;
+
+/// @brief Compare the status of a call with the status that it must return.
+///
+/// @param [in] call     A description of the call.
+/// @param [in] status   The status that the call returned.
+/// @param [in] expected The status that the call must return.
+static void ExpectStatus(const char* call, UpdateCheckStatus status, UpdateCheckStatus expected)
+{
+    if (status != expected)
+    {
+        fprintf(stderr, "%s returned %d instead of %d.\n", call, (int)status, (int)expected);
+        ++failure_count;
+    }
+}
+
+/// @brief Record a failed expectation if a condition does not hold.
+///
+/// @param [in] condition   The condition.
+/// @param [in] description A description of the condition.
+static void Expect(int condition, const char* description)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "Expected %s.\n", description);
+        ++failure_count;
+    }
+}
+
+/// @brief Check the calls that fail because of their arguments, or because there is no result yet.
+static void CheckInvalidCalls(void)
+{
+    UpdateCheckChecker* checker = NULL;
+    UpdateCheckVersion  version = {0, 0, 0, 0};
+    UpdateCheckAbiInfo  abi_info;
+    size_t              release_count = 0;
+    int32_t             is_available  = 0;
+    char                buffer[16];
+
+    ExpectStatus("UpdateCheckGetAbiInfo(NULL)", UpdateCheckGetAbiInfo(NULL), UPDATECHECK_STATUS_INVALID_ARGUMENT);
+
+    memset(&abi_info, 0, sizeof(abi_info));
+    abi_info.struct_size = 0;
+    ExpectStatus("UpdateCheckGetAbiInfo() with a zero struct_size", UpdateCheckGetAbiInfo(&abi_info), UPDATECHECK_STATUS_INVALID_ARGUMENT);
+
+    abi_info.struct_size = (uint32_t)sizeof(abi_info);
+    ExpectStatus("UpdateCheckGetAbiInfo()", UpdateCheckGetAbiInfo(&abi_info), UPDATECHECK_STATUS_OK);
+    Expect(abi_info.abi_version == UPDATECHECKAPI_C_ABI_VERSION, "the ABI version of the header");
+    Expect(abi_info.api_version.major != 0, "a non-zero major version");
+
+    ExpectStatus("UpdateCheckCreateChecker(NULL)", UpdateCheckCreateChecker(NULL), UPDATECHECK_STATUS_INVALID_ARGUMENT);
+    ExpectStatus("UpdateCheckCheckForUpdates(NULL)", UpdateCheckCheckForUpdates(NULL, &version, ".", kManifestFilename), UPDATECHECK_STATUS_INVALID_ARGUMENT);
+    ExpectStatus("UpdateCheckGetReleaseCount(NULL)", UpdateCheckGetReleaseCount(NULL, &release_count), UPDATECHECK_STATUS_INVALID_ARGUMENT);
+
+    // Destroying no checker does nothing.
+    UpdateCheckDestroyChecker(NULL);
+
+    if (UpdateCheckCreateChecker(&checker) != UPDATECHECK_STATUS_OK || checker == NULL)
+    {
+        fprintf(stderr, "UpdateCheckCreateChecker() failed.\n");
+        ++failure_count;
+        return;
+    }
+
+    ExpectStatus("UpdateCheckCheckForUpdates() without a version", UpdateCheckCheckForUpdates(checker, NULL, ".", kManifestFilename), UPDATECHECK_STATUS_INVALID_ARGUMENT);
+    ExpectStatus("UpdateCheckCheckForUpdates() without a URL", UpdateCheckCheckForUpdates(checker, &version, NULL, kManifestFilename), UPDATECHECK_STATUS_INVALID_ARGUMENT);
+    ExpectStatus("UpdateCheckGetReleaseCount() before a check", UpdateCheckGetReleaseCount(checker, &release_count), UPDATECHECK_STATUS_NO_RESULT);
+    ExpectStatus("UpdateCheckIsUpdateAvailable() before a check", UpdateCheckIsUpdateAvailable(checker, &is_available), UPDATECHECK_STATUS_NO_RESULT);
+    ExpectStatus("UpdateCheckGetReleaseTitle() before a check", UpdateCheckGetReleaseTitle(checker, 0, buffer, sizeof(buffer), NULL), UPDATECHECK_STATUS_NO_RESULT);
+    ExpectStatus("UpdateCheckFetchReleaseNotes() before a check", UpdateCheckFetchReleaseNotes(checker, 0, buffer, sizeof(buffer), NULL), UPDATECHECK_STATUS_NO_RESULT);
+
+    UpdateCheckDestroyChecker(checker);
+}
+
+/// @brief Check a version file that does not exist, and read the error message.
+static void CheckFailedCheck(void)
+{
+    UpdateCheckChecker* checker       = NULL;
+    UpdateCheckVersion  version       = {0, 0, 0, 0};
+    size_t              required_size = 0;
+    size_t              release_count = 0;
+    char                short_buffer[4];
+    char*               error_message = NULL;
+
+    if (UpdateCheckCreateChecker(&checker) != UPDATECHECK_STATUS_OK)
+    {
+        fprintf(stderr, "UpdateCheckCreateChecker() failed.\n");
+        ++failure_count;
+        return;
+    }
+
+    ExpectStatus("UpdateCheckCheckForUpdates() of a missing file",
+                 UpdateCheckCheckForUpdates(checker, &version, ".", "c_api_test_missing.json"),
+                 UPDATECHECK_STATUS_CHECK_FAILED);
+    ExpectStatus("UpdateCheckGetReleaseCount() after a failed check", UpdateCheckGetReleaseCount(checker, &release_count), UPDATECHECK_STATUS_NO_RESULT);
+
+    // A size query, a truncated copy, and a complete copy of the error message.
+    ExpectStatus("UpdateCheckGetErrorMessage() size query", UpdateCheckGetErrorMessage(checker, NULL, 0, &required_size), UPDATECHECK_STATUS_OK);
+    Expect(required_size > sizeof(short_buffer), "an error message that does not fit into 4 bytes");
+
+    ExpectStatus("UpdateCheckGetErrorMessage() into 4 bytes",
+                 UpdateCheckGetErrorMessage(checker, short_buffer, sizeof(short_buffer), NULL),
+                 UPDATECHECK_STATUS_BUFFER_TOO_SMALL);
+    Expect(strlen(short_buffer) == sizeof(short_buffer) - 1, "a truncated error message that is terminated");
+
+    error_message = (char*)malloc(required_size);
+    if (error_message != NULL)
+    {
+        ExpectStatus("UpdateCheckGetErrorMessage()", UpdateCheckGetErrorMessage(checker, error_message, required_size, NULL), UPDATECHECK_STATUS_OK);
+        Expect(strlen(error_message) + 1 == required_size, "an error message of the required size");
+        Expect(strncmp(error_message, short_buffer, sizeof(short_buffer) - 1) == 0, "the truncated error message to be a prefix of the error message");
+        printf("Missing version file: %s\n", error_message);
+        free(error_message);
+    }
+
+    UpdateCheckDestroyChecker(checker);
+}
+
+/// @brief Check the Schema 1.6 test manifest, and read its releases.
+///
+/// @param [in] data_directory The directory that contains the test manifests.
+static void CheckManifest(const char* data_directory)
+{
+    UpdateCheckChecker* checker = NULL;
+    UpdateCheckVersion  version = {0, 0, 0, 0};
+    UpdateCheckVersion  release_version;
+    size_t              release_count = 0;
+    size_t              link_count    = 0;
+    size_t              required_size = 0;
+    size_t              release_index = 0;
+    int32_t             is_available  = 0;
+    int32_t             release_type  = UPDATECHECK_RELEASE_UNKNOWN;
+    char                title[256];
+    char                short_title[8];
+
+    if (UpdateCheckCreateChecker(&checker) != UPDATECHECK_STATUS_OK)
+    {
+        fprintf(stderr, "UpdateCheckCreateChecker() failed.\n");
+        ++failure_count;
+        return;
+    }
+
+    ExpectStatus("UpdateCheckCheckForUpdates() of releases_1_6.json",
+                 UpdateCheckCheckForUpdates(checker, &version, data_directory, "releases_1_6.json"),
+                 UPDATECHECK_STATUS_OK);
+    ExpectStatus("UpdateCheckIsUpdateAvailable()", UpdateCheckIsUpdateAvailable(checker, &is_available), UPDATECHECK_STATUS_OK);
+    Expect(is_available != 0, "an update to version 0.0.0.0");
+    ExpectStatus("UpdateCheckGetReleaseCount()", UpdateCheckGetReleaseCount(checker, &release_count), UPDATECHECK_STATUS_OK);
+    Expect(release_count > 0, "releases for the current platform");
+
+    for (release_index = 0; release_index < release_count; ++release_index)
+    {
+        ExpectStatus("UpdateCheckGetReleaseVersion()", UpdateCheckGetReleaseVersion(checker, release_index, &release_version), UPDATECHECK_STATUS_OK);
+        ExpectStatus("UpdateCheckGetReleaseType()", UpdateCheckGetReleaseType(checker, release_index, &release_type), UPDATECHECK_STATUS_OK);
+        ExpectStatus("UpdateCheckGetReleaseTitle()", UpdateCheckGetReleaseTitle(checker, release_index, title, sizeof(title), &required_size), UPDATECHECK_STATUS_OK);
+        Expect(strlen(title) + 1 == required_size, "a title of the required size");
+        ExpectStatus("UpdateCheckGetDownloadLinkCount()", UpdateCheckGetDownloadLinkCount(checker, release_index, &link_count), UPDATECHECK_STATUS_OK);
+        Expect(release_version.major != 0 && release_type != UPDATECHECK_RELEASE_UNKNOWN && link_count > 0, "a version, a release type and download links");
+
+        printf("Release %u.%u.%u.%u: %s\n",
+               (unsigned)release_version.major,
+               (unsigned)release_version.minor,
+               (unsigned)release_version.patch,
+               (unsigned)release_version.build,
+               title);
+    }
+
+    if (release_count > 0)
+    {
+        ExpectStatus("UpdateCheckGetReleaseTitle() into 8 bytes",
+                     UpdateCheckGetReleaseTitle(checker, 0, short_title, sizeof(short_title), NULL),
+                     UPDATECHECK_STATUS_BUFFER_TOO_SMALL);
+        Expect(strlen(short_title) == sizeof(short_title) - 1, "a truncated title that is terminated");
+        ExpectStatus("UpdateCheckGetDownloadLinkUrl() of a missing link",
+                     UpdateCheckGetDownloadLinkUrl(checker, 0, link_count + 100, title, sizeof(title), NULL),
+                     UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE);
+    }
+
+    ExpectStatus("UpdateCheckGetReleaseTitle() of a missing release",
+                 UpdateCheckGetReleaseTitle(checker, release_count, title, sizeof(title), NULL),
+                 UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE);
+    ExpectStatus("UpdateCheckGetReleaseTitle() into no buffer", UpdateCheckGetReleaseTitle(checker, 0, NULL, sizeof(title), NULL), UPDATECHECK_STATUS_INVALID_ARGUMENT);
+
+    UpdateCheckDestroyChecker(checker);
+}
+
+/// @brief Check a local version file that refers to local release notes, and fetch them.
+static void CheckReleaseNotes(void)
+{
+    UpdateCheckChecker* checker       = NULL;
+    UpdateCheckVersion  version       = {0, 0, 0, 0};
+    size_t              release_count = 0;
+    size_t              required_size = 0;
+    char                notes_url[64];
+    char                short_notes[8];
+    char*               notes = NULL;
+    FILE*               file  = NULL;
+
+    file = fopen(kNotesFilename, "wb");
+    if (file != NULL)
+    {
+        fputs(kNotes, file);
+        fclose(file);
+    }
+
+    file = fopen(kManifestFilename, "wb");
+    if (file != NULL)
+    {
+        fprintf(file,
+                "{\"SchemaVersion\": \"1.6\", \"Releases\": [{"
+                "\"ReleaseVersion\": {\"Major\": 9, \"Minor\": 0, \"Patch\": 0, \"Build\": 1}, \"ReleaseDate\": \"2026-10-19\", \"ReleaseType\": \"GA\", "
+                "\"ReleaseTitle\": \"Radeon Tool 9.0.0\", \"ReleasePlatforms\": [\"Windows\", \"Ubuntu\", \"RHEL\", \"Darwin\"], \"ReleaseTags\": [\"tool\"], "
+                "\"DownloadLinks\": [{\"URL\": \"https://github.com/GPUOpen-Tools/tool/releases/download/v9.0.0/Tool_9.0.0.zip\", \"PackageType\": \"ZIP\"}], "
+                "\"InfoPageLinks\": [{\"URL\": \"https://gpuopen.com/tool/\", \"Description\": \"Radeon Tool\"}], "
+                "\"ReleaseNotesURL\": \"%s\"}]}",
+                kNotesFilename);
+        fclose(file);
+    }
+
+    if (UpdateCheckCreateChecker(&checker) != UPDATECHECK_STATUS_OK)
+    {
+        fprintf(stderr, "UpdateCheckCreateChecker() failed.\n");
+        ++failure_count;
+        return;
+    }
+
+    ExpectStatus("UpdateCheckCheckForUpdates() of the local version file", UpdateCheckCheckForUpdates(checker, &version, ".", kManifestFilename), UPDATECHECK_STATUS_OK);
+    ExpectStatus("UpdateCheckGetReleaseCount()", UpdateCheckGetReleaseCount(checker, &release_count), UPDATECHECK_STATUS_OK);
+    Expect(release_count == 1, "the release of the local version file");
+
+    if (release_count == 1)
+    {
+        ExpectStatus("UpdateCheckGetReleaseNotesUrl()", UpdateCheckGetReleaseNotesUrl(checker, 0, notes_url, sizeof(notes_url), NULL), UPDATECHECK_STATUS_OK);
+        Expect(strcmp(notes_url, kNotesFilename) == 0, "the release notes URL of the local version file");
+
+        // A size query, a truncated copy, and a complete copy of the release notes.
+        ExpectStatus("UpdateCheckFetchReleaseNotes() size query", UpdateCheckFetchReleaseNotes(checker, 0, NULL, 0, &required_size), UPDATECHECK_STATUS_OK);
+        Expect(required_size == strlen(kNotes) + 1, "the size of the release notes");
+
+        ExpectStatus("UpdateCheckFetchReleaseNotes() into 8 bytes",
+                     UpdateCheckFetchReleaseNotes(checker, 0, short_notes, sizeof(short_notes), NULL),
+                     UPDATECHECK_STATUS_BUFFER_TOO_SMALL);
+        Expect(strncmp(short_notes, kNotes, sizeof(short_notes) - 1) == 0 && short_notes[sizeof(short_notes) - 1] == '\0', "truncated release notes");
+
+        notes = (char*)malloc(required_size);
+        if (notes != NULL)
+        {
+            ExpectStatus("UpdateCheckFetchReleaseNotes()", UpdateCheckFetchReleaseNotes(checker, 0, notes, required_size, NULL), UPDATECHECK_STATUS_OK);
+            Expect(strcmp(notes, kNotes) == 0, "the text of the release notes");
+            free(notes);
+        }
+
+        ExpectStatus("UpdateCheckFetchReleaseNotes() of a missing release",
+                     UpdateCheckFetchReleaseNotes(checker, 1, short_notes, sizeof(short_notes), NULL),
+                     UPDATECHECK_STATUS_INDEX_OUT_OF_RANGE);
+    }
+
+    UpdateCheckDestroyChecker(checker);
+
+    remove(kManifestFilename);
+    remove(kNotesFilename);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <test data directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    CheckInvalidCalls();
+    CheckFailedCheck();
+    CheckManifest(argv[1]);
+    CheckReleaseNotes();
+
+    return (failure_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,239 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that the release of a channel is found with as few pages of the release list as possible.
+///
+/// Runs against tests/standin/releases_server.py, which serves 5 pages of 100
+/// releases, and counts the requests of each page.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "third_party/json-3.9.1/json.hpp"
+#include "update_check_api.h"
+#include "update_check_api_curl_transport.h"
+#include "update_check_api_github_releases.h"
+
+/// The number of pages of the release list of the stand-in.
+static const int kPageCount = 5;
+
+/// @brief Finds channel releases on the stand-in, and keeps track of the pages that the server counted.
+class ChannelReleasesTest
+{
+public:
+    /// @brief Constructor.
+    ///
+    /// @param [in] server_url The URL of the stand-in server.
+    explicit ChannelReleasesTest(const std::string& server_url)
+        : server_url_(server_url)
+        , is_passed_(true)
+    {
+    }
+
+    /// @brief Get the releases URL of a repository of the stand-in.
+    ///
+    /// @param [in] repository The name of the repository.
+    ///
+    /// @return The URL.
+    std::string GetReleasesUrl(const std::string& repository) const
+    {
+        return server_url_ + "/repos/amd/" + repository + "/releases";
+    }
+
+    /// @brief Find the release of each of some channels, and check their tags.
+    ///
+    /// @param [in]  label                A description of the search.
+    /// @param [in]  repository           The name of the repository.
+    /// @param [in]  channels             The channels to find.
+    /// @param [in]  max_concurrent_pages The largest number of pages to download at the same time.
+    /// @param [in]  tags                 The tag that each channel must be found with, or an empty string if it must not be found.
+    /// @param [out] error_message        The error message of the search.
+    ///
+    /// @return The return value of FindChannelReleases().
+    bool Find(const char*                     label,
+              const std::string&              repository,
+              const std::vector<std::string>& channels,
+              size_t                          max_concurrent_pages,
+              const std::vector<std::string>& tags,
+              std::string&                    error_message)
+    {
+        UpdateCheck::GithubReleasesOptions options;
+        options.max_concurrent_pages = max_concurrent_pages;
+
+        std::vector<UpdateCheck::ChannelRelease> releases;
+        error_message.clear();
+        bool ret = UpdateCheck::FindChannelReleases(GetReleasesUrl(repository), "manifest.json", channels, options, releases, error_message);
+        printf("%s: %s.\n", label, ret ? "listed" : error_message.c_str());
+
+        CheckReleases(label, releases, tags);
+        return ret;
+    }
+
+    /// @brief Check the tags of the releases that were found.
+    ///
+    /// @param [in] label    A description of the search.
+    /// @param [in] releases The releases that were found.
+    /// @param [in] tags     The tag of each release, or an empty string if it must not have been found.
+    void CheckReleases(const char* label, const std::vector<UpdateCheck::ChannelRelease>& releases, const std::vector<std::string>& tags)
+    {
+        if (releases.size() != tags.size())
+        {
+            Fail(label, "the number of releases is wrong.");
+            return;
+        }
+
+        for (size_t i = 0; i < releases.size(); ++i)
+        {
+            const UpdateCheck::ChannelRelease& release = releases[i];
+            printf("  %s: %s\n", release.channel.c_str(), release.was_found ? release.tag_name.c_str() : release.error_message.c_str());
+
+            if (release.was_found != !tags[i].empty() || release.tag_name != tags[i] || (!release.was_found && release.error_message.empty()))
+            {
+                fprintf(stderr, "%s: release %zu should have been %s.\n", label, i, tags[i].empty() ? "not found, with an error message" : tags[i].c_str());
+                is_passed_ = false;
+            }
+        }
+    }
+
+    /// @brief Check that the server counted the expected requests of each page of a repository since the last call.
+    ///
+    /// @param [in] label       A description of the search.
+    /// @param [in] repository  The name of the repository.
+    /// @param [in] page_counts The number of requests of pages 1 to kPageCount.
+    void ExpectPageCounts(const char* label, const std::string& repository, const std::vector<int>& page_counts)
+    {
+        UpdateCheck::CurlTransport   transport((UpdateCheck::TransportOptions()));
+        UpdateCheck::TransferRequest request;
+        UpdateCheck::TransferResult  result;
+        request.url = server_url_ + "/stats";
+        transport.Fetch(request, result);
+
+        nlohmann::json    counters     = nlohmann::json::parse(result.body.Data(), result.body.Data() + result.body.Size());
+        std::vector<int>& last_counts  = page_counts_[repository];
+        std::string       seen;
+        bool              is_expected = true;
+
+        last_counts.resize(kPageCount + 1, 0);
+        for (int page = 1; page <= kPageCount; ++page)
+        {
+            const int count = counters.value(repository + "/page" + std::to_string(page), 0);
+            seen += (page > 1 ? ", " : "") + std::to_string(count - last_counts[page]);
+            is_expected       = is_expected && count - last_counts[page] == page_counts[page - 1];
+            last_counts[page] = count;
+        }
+
+        if (!is_expected)
+        {
+            fprintf(stderr, "%s: the server saw %s requests of pages 1 to %d.\n", label, seen.c_str(), kPageCount);
+            is_passed_ = false;
+        }
+    }
+
+    /// @brief Fail the test.
+    ///
+    /// @param [in] label   A description of the search.
+    /// @param [in] message What went wrong.
+    void Fail(const char* label, const char* message)
+    {
+        fprintf(stderr, "%s: %s\n", label, message);
+        is_passed_ = false;
+    }
+
+    /// @brief Check whether all checks passed.
+    ///
+    /// @return true if the test passed.
+    bool IsPassed() const
+    {
+        return is_passed_;
+    }
+
+private:
+    /// The URL of the stand-in server.
+    std::string server_url_;
+
+    /// The counters of the requests of each page at the last call of ExpectPageCounts(), by repository and page number.
+    std::map<std::string, std::vector<int>> page_counts_;
+
+    /// False once a check failed.
+    bool is_passed_;
+};
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <server URL>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ChannelReleasesTest test(argv[1]);
+    std::string         error_message;
+
+    // The newest stable and beta releases are on page 1; the draft and the release without the JSON file are skipped.
+    if (!test.Find("Stable and beta", "tool", {"stable", "beta"}, 4, {"v1000.0.0", "v2.0.0-beta.3"}, error_message))
+    {
+        test.Fail("Stable and beta", "the release list should have been listed.");
+    }
+
+    test.ExpectPageCounts("Stable and beta", "tool", {1, 0, 0, 0, 0});
+
+    // The alpha release is on page 4; one page at a time, page 5 is never requested.
+    if (!test.Find("Alpha, one page at a time", "tool", {"alpha"}, 1, {"rgp-v2.0-Alpha1"}, error_message))
+    {
+        test.Fail("Alpha, one page at a time", "the release list should have been listed.");
+    }
+
+    test.ExpectPageCounts("Alpha, one page at a time", "tool", {1, 1, 1, 1, 0});
+
+    // Concurrently, the pages after page 1 are requested together, and page 5 may be cancelled before it is requested.
+    if (!test.Find("Alpha, concurrent pages", "concurrent", {"alpha"}, 4, {"rgp-v2.0-Alpha1"}, error_message))
+    {
+        test.Fail("Alpha, concurrent pages", "the release list should have been listed.");
+    }
+
+    // A channel without releases makes the search scan every page.
+    if (!test.Find("Missing channel", "tool", {"rc"}, 4, {""}, error_message))
+    {
+        test.Fail("Missing channel", "the release list should have been listed.");
+    }
+
+    test.ExpectPageCounts("Missing channel", "tool", {1, 1, 1, 1, 1});
+
+    // The message of a rejected page is reported, and the channels that were settled before it are still found.
+    if (test.Find("Rate limited", "limited", {"beta", "alpha"}, 1, {"v2.0.0-beta.3", ""}, error_message) ||
+        error_message.find("API rate limit exceeded") == std::string::npos)
+    {
+        test.Fail("Rate limited", "the search should have failed with the message of the API.");
+    }
+
+    test.ExpectPageCounts("Rate limited", "limited", {1, 1, 0, 0, 0});
+
+    // All JSON files of a channel are found with one listing.
+    UpdateCheck::GithubReleasesOptions       options;
+    std::vector<UpdateCheck::ChannelRelease> releases;
+    UpdateCheck::FindChannelReleaseAssets(test.GetReleasesUrl("tool"), "beta", {"manifest.json", "tool.zip"}, options, releases, error_message);
+    test.CheckReleases("Beta assets", releases, {"v2.0.0-beta.3", "v2.0.0-beta.4"});
+    test.ExpectPageCounts("Beta assets", "tool", {1, 0, 0, 0, 0});
+
+    // A channel URL checks the products of the release of that channel.
+    std::vector<UpdateCheck::ProductCheck> product_checks(2);
+    product_checks[0].json_filename = "manifest.json";
+    product_checks[1].json_filename = "missing.json";
+
+    UpdateCheck::CheckForProductUpdates(test.GetReleasesUrl("tool") + "#channel=beta", product_checks, error_message);
+    printf("Channel URL: %s, %s.\n",
+           product_checks[0].checked_for_update ? "checked" : product_checks[0].error_message.c_str(),
+           product_checks[1].checked_for_update ? "checked" : product_checks[1].error_message.c_str());
+
+    if (!product_checks[0].checked_for_update || product_checks[0].update_info.releases.empty() || product_checks[1].checked_for_update)
+    {
+        test.Fail("Channel URL", "only the product whose JSON file is attached to a beta release should have been checked.");
+    }
+
+    return test.IsPassed() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,190 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that batched GraphQL queries resolve the JSON files of GitHub latest releases.
+///
+/// Runs against tests/standin/graphql_server.py, which answers like the GitHub
+/// REST and GraphQL APIs, and counts the requests of each kind.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "third_party/json-3.9.1/json.hpp"
+#include "update_check_api.h"
+#include "update_check_api_curl_transport.h"
+#include "update_check_api_github_graphql.h"
+
+/// The number of repositories that are resolved together.
+static const int kRepositoryCount = 20;
+
+/// The largest number of repositories in one query in this test, so that the repositories are split into 3 queries.
+static const size_t kRepositoriesPerQuery = 8;
+
+/// @brief Get the counters of the stand-in server.
+///
+/// @param [in] server_url The URL of the stand-in server.
+///
+/// @return The counters, as a JSON object.
+static nlohmann::json GetServerCounters(const std::string& server_url)
+{
+    UpdateCheck::CurlTransport   transport((UpdateCheck::TransportOptions()));
+    UpdateCheck::TransferRequest request;
+    UpdateCheck::TransferResult  result;
+    request.url = server_url + "/stats";
+    transport.Fetch(request, result);
+
+    return nlohmann::json::parse(result.body.Data(), result.body.Data() + result.body.Size());
+}
+
+/// @brief Make the request of the JSON file of a repository of the stand-in server.
+///
+/// @param [in] server_url    The URL of the stand-in server.
+/// @param [in] repository    The name of the repository.
+/// @param [in] json_filename The name of the JSON file.
+///
+/// @return The request.
+static UpdateCheck::LatestReleaseAssetRequest MakeRequest(const std::string& server_url, const std::string& repository, const std::string& json_filename)
+{
+    UpdateCheck::LatestReleaseAssetRequest request;
+    request.latest_releases_url = server_url + "/repos/amd/" + repository + "/releases/latest";
+    request.json_filename       = json_filename;
+    return request;
+}
+
+/// @brief Check that a request was not resolved, and reports why.
+///
+/// @param [in] label A description of the request.
+/// @param [in] asset The outcome of the request.
+///
+/// @return true if the request was not resolved and has an error message; false otherwise.
+static bool ExpectNotResolved(const char* label, const UpdateCheck::LatestReleaseAsset& asset)
+{
+    printf("%s: %s\n", label, asset.error_message.c_str());
+
+    bool ret = !asset.was_resolved && !asset.error_message.empty();
+    if (!ret)
+    {
+        fprintf(stderr, "%s: the request should have failed with an error message of its own.\n", label);
+    }
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <server URL>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string server_url = argv[1];
+    bool              is_passed  = true;
+
+    UpdateCheck::GithubGraphqlOptions options;
+    options.graphql_url                = server_url + "/graphql";
+    options.access_token               = "stand-in";
+    options.max_repositories_per_query = kRepositoriesPerQuery;
+
+    // Resolve all repositories in batches of kRepositoriesPerQuery.
+    std::vector<UpdateCheck::LatestReleaseAssetRequest> requests;
+    for (int i = 0; i < kRepositoryCount; ++i)
+    {
+        requests.push_back(MakeRequest(server_url, "p" + std::to_string(i), "manifest.json"));
+    }
+
+    std::vector<UpdateCheck::LatestReleaseAsset> assets;
+    std::string                                  error_message;
+    if (!UpdateCheck::ResolveLatestReleaseAssets(requests, options, assets, error_message) || assets.size() != requests.size())
+    {
+        fprintf(stderr, "Resolving the repositories failed: %s\n", error_message.c_str());
+        return EXIT_FAILURE;
+    }
+
+    for (int i = 0; i < kRepositoryCount; ++i)
+    {
+        const std::string tag = "v" + std::to_string(i);
+        if (!assets[i].was_resolved || assets[i].tag_name != tag || assets[i].download_url != server_url + "/dl/amd/p" + std::to_string(i) + "/" + tag + "/manifest.json")
+        {
+            fprintf(stderr, "Repository p%d was resolved to %s %s: %s\n", i, assets[i].tag_name.c_str(), assets[i].download_url.c_str(), assets[i].error_message.c_str());
+            is_passed = false;
+        }
+    }
+
+    nlohmann::json counters      = GetServerCounters(server_url);
+    const int      query_count   = counters.value("graphql", 0);
+    const int      largest_query = counters.value("largest_query", 0);
+    printf("Resolved %d repositories with %d queries of at most %d repositories.\n", kRepositoryCount, query_count, largest_query);
+
+    const int expected_query_count = static_cast<int>((kRepositoryCount + kRepositoriesPerQuery - 1) / kRepositoriesPerQuery);
+    if (query_count != expected_query_count || largest_query != static_cast<int>(kRepositoriesPerQuery) || counters.value("repositories", 0) != kRepositoryCount)
+    {
+        fprintf(stderr, "The repositories should have been resolved with %d queries of at most %zu repositories.\n", expected_query_count, kRepositoriesPerQuery);
+        is_passed = false;
+    }
+
+    // The checks download the resolved JSON files directly, without requesting the latest releases from the REST API.
+    for (const UpdateCheck::LatestReleaseAssetRequest& request : requests)
+    {
+        UpdateCheck::VersionInfo current_version = {};
+        UpdateCheck::UpdateInfo  update_info;
+        if (!UpdateCheck::CheckForUpdates(current_version, request.latest_releases_url, request.json_filename, update_info, error_message))
+        {
+            fprintf(stderr, "Checking %s failed: %s\n", request.latest_releases_url.c_str(), error_message.c_str());
+            is_passed = false;
+        }
+    }
+
+    counters = GetServerCounters(server_url);
+    printf("The checks made %d REST requests and %d downloads.\n", counters.value("rest", 0), counters.value("downloads", 0));
+
+    if (counters.value("rest", 0) != 0 || counters.value("downloads", 0) != kRepositoryCount)
+    {
+        fprintf(stderr, "The checks should have downloaded the JSON files without any REST requests.\n");
+        is_passed = false;
+    }
+
+    // A repository, release or asset that is missing only fails its own request.
+    std::vector<UpdateCheck::LatestReleaseAssetRequest> mixed_requests;
+    mixed_requests.push_back(MakeRequest(server_url, "p30", "manifest.json"));
+    mixed_requests.push_back(MakeRequest(server_url, "missing", "manifest.json"));
+    mixed_requests.push_back(MakeRequest(server_url, "norelease", "manifest.json"));
+    mixed_requests.push_back(MakeRequest(server_url, "p31", "missing.json"));
+    mixed_requests.push_back(MakeRequest(server_url, "p32", "manifest.json"));
+    mixed_requests.push_back(UpdateCheck::LatestReleaseAssetRequest{server_url + "/releases/manifest.json", "manifest.json"});
+
+    error_message.clear();
+    if (!UpdateCheck::ResolveLatestReleaseAssets(mixed_requests, options, assets, error_message) || assets.size() != mixed_requests.size())
+    {
+        fprintf(stderr, "Resolving the mixed requests failed: %s\n", error_message.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (!assets[0].was_resolved || !assets[4].was_resolved)
+    {
+        fprintf(stderr, "The repositories that exist should have been resolved.\n");
+        is_passed = false;
+    }
+
+    is_passed = ExpectNotResolved("Missing repository", assets[1]) && is_passed;
+    is_passed = ExpectNotResolved("Missing release", assets[2]) && is_passed;
+    is_passed = ExpectNotResolved("Missing asset", assets[3]) && is_passed;
+    is_passed = ExpectNotResolved("Not a latest releases URL", assets[5]) && is_passed;
+
+    // A query that is rejected as a whole fails, and fails each of its requests.
+    options.access_token.clear();
+    error_message.clear();
+    if (UpdateCheck::ResolveLatestReleaseAssets(mixed_requests, options, assets, error_message) || error_message.empty())
+    {
+        fprintf(stderr, "An unauthorized query should have failed with an error message.\n");
+        is_passed = false;
+    }
+
+    is_passed = ExpectNotResolved("Unauthorized query", assets[0]) && is_passed;
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
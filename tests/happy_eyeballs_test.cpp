@@ -0,0 +1,199 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that connections race IPv6 and IPv4, and that the family that won is remembered.
+///
+/// Runs against tests/standin/dual_stack_server.py, whose IPv6 address drops
+/// connections. The test replaces getaddrinfo(), so that the host name
+/// "dual.test" resolves to both ::1 and 127.0.0.1, slowly, and counts the lookups.
+//==============================================================================
+
+#include <dlfcn.h>
+#include <netdb.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "update_check_api_curl_transport.h"
+
+/// The host name that the replaced getaddrinfo() resolves.
+static const char* kDualStackHost = "dual.test";
+
+/// How long each lookup of kDualStackHost takes, in microseconds.
+static const useconds_t kLookupTimeUs = 50000;
+
+/// How long resolved host names are kept by the transport in this test, in seconds. libcurl
+/// timestamps them in whole seconds, so with 1 s they could expire right after they were resolved.
+static const long kDnsCacheTimeoutS = 2;
+
+/// How long a connection may take; a check that waited for the IPv6 connection to time out would take this long.
+static const long kConnectTimeoutMs = 4000;
+
+/// How long the first check may take: the lookup and the Connection Attempt Delay, with room for a slow machine.
+static const double kMaxRaceTimeMs = 2000.0;
+
+/// The number of lookups of kDualStackHost.
+static std::atomic<int> lookup_count(0);
+
+/// @brief Resolve kDualStackHost to ::1 and 127.0.0.1, and pass other host names on to the system.
+extern "C" int getaddrinfo(const char* node, const char* service, const struct addrinfo* hints, struct addrinfo** result)
+{
+    typedef int (*GetAddrInfoFunction)(const char*, const char*, const struct addrinfo*, struct addrinfo**);
+    static GetAddrInfoFunction system_getaddrinfo = reinterpret_cast<GetAddrInfoFunction>(dlsym(RTLD_NEXT, "getaddrinfo"));
+
+    if (node == nullptr || strcmp(node, kDualStackHost) != 0)
+    {
+        return system_getaddrinfo(node, service, hints, result);
+    }
+
+    ++lookup_count;
+    usleep(kLookupTimeUs);
+
+    struct addrinfo numeric_hints = {};
+    numeric_hints.ai_flags        = AI_NUMERICHOST;
+    numeric_hints.ai_socktype     = (hints != nullptr) ? hints->ai_socktype : SOCK_STREAM;
+
+    const int        family    = (hints != nullptr) ? hints->ai_family : AF_UNSPEC;
+    struct addrinfo* addresses = nullptr;
+    struct addrinfo* ipv4      = nullptr;
+
+    if (family != AF_INET)
+    {
+        system_getaddrinfo("::1", service, &numeric_hints, &addresses);
+    }
+
+    if (family != AF_INET6)
+    {
+        system_getaddrinfo("127.0.0.1", service, &numeric_hints, &ipv4);
+    }
+
+    if (addresses == nullptr)
+    {
+        addresses = ipv4;
+    }
+    else
+    {
+        struct addrinfo* last = addresses;
+        while (last->ai_next != nullptr)
+        {
+            last = last->ai_next;
+        }
+
+        last->ai_next = ipv4;
+    }
+
+    *result = addresses;
+    return (addresses != nullptr) ? 0 : EAI_NONAME;
+}
+
+/// @brief Download the test file with a new transport, so that a new connection is made.
+///
+/// @param [in]  label   A description of the check.
+/// @param [in]  url     The URL of the file.
+/// @param [in]  options The options of the transport.
+/// @param [out] time_ms The time that the check took, in milliseconds.
+///
+/// @return true if the file was downloaded from the IPv4 address; false otherwise.
+static bool Check(const char* label, const std::string& url, const UpdateCheck::TransportOptions& options, double& time_ms)
+{
+    UpdateCheck::CurlTransport   transport(options);
+    UpdateCheck::TransferRequest request;
+    UpdateCheck::TransferResult  result;
+    request.url = url;
+
+    auto start = std::chrono::steady_clock::now();
+    transport.Fetch(request, result);
+    time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%s: %.1f ms from %s, %d lookups.\n", label, time_ms, result.primary_ip.c_str(), lookup_count.load());
+
+    bool ret = result.was_successful && result.primary_ip == "127.0.0.1";
+    if (!ret)
+    {
+        fprintf(stderr, "%s failed: %s\n", label, result.error_message.c_str());
+    }
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <server port>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string url = std::string("http://") + kDualStackHost + ":" + argv[1] + "/version.json";
+
+    UpdateCheck::TransportOptions options;
+    options.dns_cache_timeout_s = kDnsCacheTimeoutS;
+    options.connect_timeout_ms  = kConnectTimeoutMs;
+
+    bool   is_passed = true;
+    double time_ms   = 0;
+
+    // The first check resolves the host, and IPv4 wins the race against the unreachable IPv6 address.
+    uint64_t ipv4_preferred = UpdateCheck::CurlTransport::GetStatistics().ipv4_preferred_transfers;
+    if (!Check("Check 1, racing", url, options, time_ms))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (time_ms > kMaxRaceTimeMs || lookup_count != 1)
+    {
+        fprintf(stderr, "The first check should have resolved the host once, and connected over IPv4 without waiting for IPv6 to time out.\n");
+        is_passed = false;
+    }
+
+    // The second check uses the resolved addresses, and connects over IPv4 only.
+    if (!Check("Check 2, IPv4 remembered", url, options, time_ms))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (lookup_count != 1 || UpdateCheck::CurlTransport::GetStatistics().ipv4_preferred_transfers != ipv4_preferred + 1)
+    {
+        fprintf(stderr, "The second check should have used the cached addresses, and connected over IPv4 only.\n");
+        is_passed = false;
+    }
+
+    // Once the addresses expire, the host is resolved again.
+    std::this_thread::sleep_for(std::chrono::milliseconds(kDnsCacheTimeoutS * 1000 + 500));
+    if (!Check("Check 3, addresses expired", url, options, time_ms))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (lookup_count != 2)
+    {
+        fprintf(stderr, "The third check should have resolved the host again.\n");
+        is_passed = false;
+    }
+
+    // Without remembering the family, a check races again. The third check only resolved the IPv4
+    // address, since it connected over IPv4 only, so wait for that to expire as well.
+    options.ipv4_preference_timeout_s = 0;
+    ipv4_preferred                    = UpdateCheck::CurlTransport::GetStatistics().ipv4_preferred_transfers;
+    std::this_thread::sleep_for(std::chrono::milliseconds(kDnsCacheTimeoutS * 1000 + 500));
+    if (!Check("Check 4, racing again", url, options, time_ms))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (UpdateCheck::CurlTransport::GetStatistics().ipv4_preferred_transfers != ipv4_preferred || lookup_count != 3 ||
+        time_ms < options.happy_eyeballs_delay_ms || time_ms > kMaxRaceTimeMs)
+    {
+        fprintf(stderr, "The fourth check should have raced IPv6 and IPv4 again.\n");
+        is_passed = false;
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
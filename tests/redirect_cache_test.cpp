@@ -0,0 +1,203 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that the targets of redirects are reused until they expire.
+///
+/// Runs against tests/standin/redirect_server.py, which redirects downloads
+/// to signed URLs that expire, like GitHub release assets.
+//==============================================================================
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "third_party/json-3.9.1/json.hpp"
+#include "update_check_api_curl_transport.h"
+
+/// The margin before the expiry of a signed URL after which the transport no longer uses it, in seconds.
+static const int kSignedUrlExpiryMarginS = 30;
+
+/// @brief Downloads files from the stand-in, and keeps track of what the server and the transport counted.
+class RedirectCacheTest
+{
+public:
+    /// @brief Constructor.
+    ///
+    /// @param [in] server_url The URL of the stand-in server.
+    explicit RedirectCacheTest(const std::string& server_url)
+        : server_url_(server_url)
+        , transport_(UpdateCheck::TransportOptions())
+        , redirects_(0)
+        , objects_(0)
+        , rejected_(0)
+        , is_passed_(true)
+    {
+    }
+
+    /// @brief Download a file, and check where it came from.
+    ///
+    /// @param [in] label                A description of the download.
+    /// @param [in] path                 The path of the download URL.
+    /// @param [in] name                 The name of the file, which the body must contain.
+    /// @param [in] used_cached_redirect True if the download must go straight to the remembered target.
+    void Download(const char* label, const std::string& path, const std::string& name, bool used_cached_redirect)
+    {
+        UpdateCheck::TransferRequest request;
+        UpdateCheck::TransferResult  result;
+        request.url = server_url_ + path;
+        transport_.Fetch(request, result);
+
+        const std::string body(result.body.Data(), result.body.Size());
+        printf("%s: %s, %s.\n", label, result.was_successful ? "downloaded" : "failed", result.used_cached_redirect ? "remembered target" : "followed the redirect");
+
+        if (!result.was_successful || body.find("\"" + name + "\"") == std::string::npos)
+        {
+            fprintf(stderr, "%s: the file was not downloaded: %s\n", label, result.error_message.c_str());
+            is_passed_ = false;
+        }
+        else if (result.used_cached_redirect != used_cached_redirect)
+        {
+            fprintf(stderr, "%s: the redirect should %shave been skipped.\n", label, used_cached_redirect ? "" : "not ");
+            is_passed_ = false;
+        }
+    }
+
+    /// @brief Check that the server counted the expected number of requests since the last call.
+    ///
+    /// @param [in] label     A description of the downloads.
+    /// @param [in] redirects The number of requests for the download URLs.
+    /// @param [in] objects   The number of requests for the signed URLs.
+    /// @param [in] rejected  The number of requests for signed URLs that were rejected.
+    void ExpectServerCounts(const char* label, int redirects, int objects, int rejected)
+    {
+        UpdateCheck::TransferRequest request;
+        UpdateCheck::TransferResult  result;
+        request.url = server_url_ + "/stats";
+        transport_.Fetch(request, result);
+
+        nlohmann::json counters       = nlohmann::json::parse(result.body.Data(), result.body.Data() + result.body.Size());
+        const int      redirect_count = counters.value("redirects", 0);
+        const int      object_count   = counters.value("objects", 0);
+        const int      rejected_count = counters.value("rejected", 0);
+
+        if (redirect_count - redirects_ != redirects || object_count - objects_ != objects || rejected_count - rejected_ != rejected)
+        {
+            fprintf(stderr,
+                    "%s: the server saw %d redirects, %d signed URLs and %d rejections instead of %d, %d and %d.\n",
+                    label,
+                    redirect_count - redirects_,
+                    object_count - objects_,
+                    rejected_count - rejected_,
+                    redirects,
+                    objects,
+                    rejected);
+            is_passed_ = false;
+        }
+
+        redirects_ = redirect_count;
+        objects_   = object_count;
+        rejected_  = rejected_count;
+    }
+
+    /// @brief Revoke the signatures that the server issued so far.
+    void Revoke()
+    {
+        UpdateCheck::TransferRequest request;
+        UpdateCheck::TransferResult  result;
+        request.url = server_url_ + "/revoke";
+        transport_.Fetch(request, result);
+    }
+
+    /// @brief Fail the test.
+    ///
+    /// @param [in] message What went wrong.
+    void Fail(const char* message)
+    {
+        fprintf(stderr, "%s\n", message);
+        is_passed_ = false;
+    }
+
+    /// @brief Check whether all checks passed.
+    ///
+    /// @return true if the test passed.
+    bool IsPassed() const
+    {
+        return is_passed_;
+    }
+
+private:
+    /// The URL of the stand-in server.
+    std::string server_url_;
+
+    /// One transport for all downloads, like a tool that checks periodically.
+    UpdateCheck::CurlTransport transport_;
+
+    /// The counters of the server at the last call of ExpectServerCounts().
+    int redirects_;
+    int objects_;
+    int rejected_;
+
+    /// False once a check failed.
+    bool is_passed_;
+};
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <server URL>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    RedirectCacheTest test(argv[1]);
+
+    // Later downloads go straight to the signed URL.
+    const uint64_t redirects_skipped = UpdateCheck::CurlTransport::GetStatistics().redirects_skipped;
+    test.Download("Download 1", "/download/600/a.json", "a.json", false);
+    test.Download("Download 2", "/download/600/a.json", "a.json", true);
+    test.Download("Download 3", "/download/600/a.json", "a.json", true);
+    test.ExpectServerCounts("Remembered target", 1, 3, 0);
+
+    if (UpdateCheck::CurlTransport::GetStatistics().redirects_skipped != redirects_skipped + 2)
+    {
+        test.Fail("Two skipped redirects should have been counted.");
+    }
+
+    // A target that is rejected is forgotten, and the download URL is requested again within the same download.
+    const uint64_t redirect_targets_failed = UpdateCheck::CurlTransport::GetStatistics().redirect_targets_failed;
+    test.Revoke();
+    test.Download("Download after revoking", "/download/600/a.json", "a.json", false);
+    test.ExpectServerCounts("Revoked target", 1, 2, 1);
+
+    if (UpdateCheck::CurlTransport::GetStatistics().redirect_targets_failed != redirect_targets_failed + 1)
+    {
+        test.Fail("One failed redirect target should have been counted.");
+    }
+
+    // A redirect that must not be stored is followed every time.
+    test.Download("No-store download 1", "/download/600/b.json?cc=no-store", "b.json", false);
+    test.Download("No-store download 2", "/download/600/b.json?cc=no-store", "b.json", false);
+    test.ExpectServerCounts("No-store", 2, 2, 0);
+
+    // The max-age of the redirect response limits how long the target is used.
+    test.Download("Max-age download 1", "/download/600/c.json?cc=max-age%3D2", "c.json", false);
+    test.Download("Max-age download 2", "/download/600/c.json?cc=max-age%3D2", "c.json", true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(3000));
+    test.Download("Max-age download 3", "/download/600/c.json?cc=max-age%3D2", "c.json", false);
+    test.ExpectServerCounts("Max-age", 2, 3, 0);
+
+    // A signed URL is used until the margin before its expiry.
+    const int         lifetime_s  = kSignedUrlExpiryMarginS + 3;
+    const std::string signed_path = "/download/" + std::to_string(lifetime_s) + "/d.json";
+    test.Download("Signed URL download 1", signed_path, "d.json", false);
+    test.Download("Signed URL download 2", signed_path, "d.json", true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(4000));
+    test.Download("Signed URL download 3", signed_path, "d.json", false);
+    test.ExpectServerCounts("Signed URL", 2, 3, 0);
+
+    return test.IsPassed() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
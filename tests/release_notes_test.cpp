@@ -0,0 +1,272 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that release notes URLs from a version file cannot run commands or read local files.
+///
+/// Usage: release_notes_test [server URL]
+///
+/// Without a server, a release notes URL that tries to run a command must be
+/// rejected or passed on as it is, and a version file that was loaded from a
+/// local file may refer to local release notes. With the URL of
+/// tests/standin/notes_server.py, a version file that was downloaded must not
+/// be able to refer to local release notes. The files of the test are written
+/// to the current directory.
+//==============================================================================
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "update_check_api.h"
+
+/// The file that the commands of the injected URLs would create.
+static const char* kInjectedFilename = "./release_notes_test_injected";
+
+/// The local version file, and the local release notes that it refers to.
+static const char* kManifestFilename = "release_notes_test.json";
+static const char* kNotesFilename    = "release_notes_test.md";
+
+/// The release notes of the local file.
+static const char* kLocalNotes = "# Local release notes\n";
+
+/// The release notes that the stand-in serves at /notes.md.
+static const char* kServerNotes = "# Release notes\n\nFixed a crash.\n";
+
+/// @brief Check whether a file exists.
+///
+/// @param [in] filename The path of the file.
+///
+/// @return true if the file exists; false otherwise.
+static bool FileExists(const char* filename)
+{
+    return std::ifstream(filename).good();
+}
+
+/// @brief Encode a string for the query of a URL.
+///
+/// @param [in] text The string.
+///
+/// @return The encoded string.
+static std::string EncodeQueryValue(const std::string& text)
+{
+    std::string encoded;
+    char        escape[4];
+
+    for (char c : text)
+    {
+        if (isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '.' || c == '_' || c == '/')
+        {
+            encoded += c;
+        }
+        else
+        {
+            snprintf(escape, sizeof(escape), "%%%02X", static_cast<unsigned char>(c));
+            encoded += escape;
+        }
+    }
+
+    return encoded;
+}
+
+/// @brief Fetch release notes from URLs that run a command when they are passed through a shell, and check that the command did not run.
+///
+/// @return true if the fetches failed and no command ran; false otherwise.
+static bool CheckInjectedUrls()
+{
+    const std::string urls[] = {
+        std::string("https://127.0.0.1:1/notes$(touch ") + kInjectedFilename + ").md",
+        std::string("https://127.0.0.1:1/notes$(touch$IFS") + kInjectedFilename + ").md",
+        std::string("https://127.0.0.1:1/notes`touch$IFS") + kInjectedFilename + "`.md",
+        std::string("https://127.0.0.1:1/notes\"$(touch$IFS") + kInjectedFilename + ")\".md",
+    };
+
+    bool is_passed = true;
+    for (const std::string& url : urls)
+    {
+        std::remove(kInjectedFilename);
+
+        std::string release_notes;
+        std::string error_message;
+        const bool  was_fetched = UpdateCheck::FetchReleaseNotes(url, release_notes, error_message);
+        printf("%s: %s\n", url.c_str(), was_fetched ? "fetched" : error_message.c_str());
+
+        if (was_fetched || FileExists(kInjectedFilename))
+        {
+            fprintf(stderr, "%s: the release notes URL ran a command.\n", url.c_str());
+            is_passed = false;
+        }
+
+        // The reason of the failure comes first, and is separated from the message that follows it.
+        const size_t summary_offset = error_message.rfind("Failed to load the release notes.");
+        if (summary_offset == std::string::npos || summary_offset == 0 || error_message[summary_offset - 1] != ' ')
+        {
+            fprintf(stderr, "%s: the error messages are not separated: %s\n", url.c_str(), error_message.c_str());
+            is_passed = false;
+        }
+    }
+
+    std::remove(kInjectedFilename);
+    return is_passed;
+}
+
+/// @brief Check a version file with both overloads of CheckForUpdates(), and check the release notes URL that the release has.
+///
+/// @param [in] label               A description of the version file.
+/// @param [in] latest_releases_url The directory or URL of the version file.
+/// @param [in] json_filename       The name of the version file.
+/// @param [in] release_notes_url   The release notes URL that the release must have.
+///
+/// @return true if both checks found the release with the expected release notes URL; false otherwise.
+static bool CheckReleaseNotesUrl(const char* label, const std::string& latest_releases_url, const std::string& json_filename, const std::string& release_notes_url)
+{
+    UpdateCheck::VersionInfo current_version = {};
+    UpdateCheck::UpdateInfo  update_info;
+    std::string              error_message;
+    bool                     is_passed = true;
+
+    if (!UpdateCheck::CheckForUpdates(current_version, latest_releases_url, json_filename, update_info, error_message) || update_info.releases.size() != 1)
+    {
+        fprintf(stderr, "%s: the check failed: %s\n", label, error_message.c_str());
+        return false;
+    }
+
+    if (update_info.releases[0].release_notes_url != release_notes_url)
+    {
+        fprintf(stderr, "%s: the release notes URL is \"%s\" instead of \"%s\".\n", label, update_info.releases[0].release_notes_url.c_str(), release_notes_url.c_str());
+        is_passed = false;
+    }
+
+    // The streaming check passes each release on before the check is complete.
+    std::vector<std::string> callback_urls;
+    UpdateCheck::UpdateInfo  streamed_update_info;
+    if (!UpdateCheck::CheckForUpdates(
+            current_version,
+            latest_releases_url,
+            json_filename,
+            [&callback_urls](const UpdateCheck::ReleaseInfo& release_info) {
+                callback_urls.push_back(release_info.release_notes_url);
+                return true;
+            },
+            streamed_update_info,
+            error_message) ||
+        streamed_update_info.releases.size() != 1)
+    {
+        fprintf(stderr, "%s: the streaming check failed: %s\n", label, error_message.c_str());
+        return false;
+    }
+
+    if (streamed_update_info.releases[0].release_notes_url != release_notes_url || callback_urls.size() != 1 || callback_urls[0] != release_notes_url)
+    {
+        fprintf(stderr, "%s: the streaming check did not report the release notes URL \"%s\".\n", label, release_notes_url.c_str());
+        is_passed = false;
+    }
+
+    printf("%s: the release notes URL is \"%s\".\n", label, update_info.releases[0].release_notes_url.c_str());
+    return is_passed;
+}
+
+/// @brief Fetch release notes, and check their text.
+///
+/// @param [in] label             A description of the release notes.
+/// @param [in] release_notes_url The release notes URL.
+/// @param [in] expected_notes    The text that the release notes must have.
+///
+/// @return true if the release notes were fetched and have the expected text; false otherwise.
+static bool CheckFetchedNotes(const char* label, const std::string& release_notes_url, const std::string& expected_notes)
+{
+    std::string release_notes;
+    std::string error_message;
+
+    if (!UpdateCheck::FetchReleaseNotes(release_notes_url, release_notes, error_message) || release_notes != expected_notes)
+    {
+        fprintf(stderr, "%s: the release notes were not fetched: %s\n", label, error_message.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief Check that a version file that was loaded from a local file may refer to local release notes.
+///
+/// @return true if the local release notes were kept and fetched; false otherwise.
+static bool CheckLocalManifest()
+{
+    std::ofstream(kNotesFilename, std::ios::binary) << kLocalNotes;
+    std::ofstream(kManifestFilename, std::ios::binary)
+        << "{\"SchemaVersion\": \"1.6\", \"Releases\": [{"
+           "\"ReleaseVersion\": {\"Major\": 9, \"Minor\": 0, \"Patch\": 0, \"Build\": 1}, \"ReleaseDate\": \"2026-10-19\", \"ReleaseType\": \"GA\", "
+           "\"ReleaseTitle\": \"Radeon Tool 9.0.0\", \"ReleasePlatforms\": [\"Windows\", \"Ubuntu\", \"RHEL\", \"Darwin\"], \"ReleaseTags\": [\"tool\"], "
+           "\"DownloadLinks\": [{\"URL\": \"https://github.com/GPUOpen-Tools/tool/releases/download/v9.0.0/Tool_9.0.0.zip\", \"PackageType\": \"ZIP\"}], "
+           "\"InfoPageLinks\": [{\"URL\": \"https://gpuopen.com/tool/\", \"Description\": \"Radeon Tool\"}], "
+           "\"ReleaseNotesURL\": \""
+        << kNotesFilename << "\"}]}";
+
+    bool is_passed = CheckReleaseNotesUrl("Local version file", ".", kManifestFilename, kNotesFilename);
+    is_passed      = CheckFetchedNotes("Local release notes", kNotesFilename, kLocalNotes) && is_passed;
+
+    std::remove(kManifestFilename);
+    std::remove(kNotesFilename);
+    return is_passed;
+}
+
+/// @brief Check that a version file that was downloaded cannot refer to local release notes, but keeps its http release notes.
+///
+/// @param [in] server_url The URL of the stand-in server.
+///
+/// @return true if the local release notes were cleared, and the http release notes kept and fetched; false otherwise.
+static bool CheckRemoteManifest(const std::string& server_url)
+{
+    std::ofstream(kNotesFilename, std::ios::binary) << kLocalNotes;
+
+    const std::string local_urls[] = {kNotesFilename, std::string("file://") + kNotesFilename, "httpfoo/../" + std::string(kNotesFilename)};
+
+    bool is_passed = true;
+    for (const std::string& local_url : local_urls)
+    {
+        is_passed = CheckReleaseNotesUrl(("Downloaded version file with " + local_url).c_str(), server_url, "manifest.json?notes=" + EncodeQueryValue(local_url), "") &&
+                    is_passed;
+    }
+
+    // Checking several products parses each downloaded version file the same way.
+    std::vector<UpdateCheck::ProductCheck> product_checks(1);
+    std::string                            error_message;
+    product_checks[0].product_version = UpdateCheck::VersionInfo();
+    product_checks[0].json_filename   = "manifest.json?notes=" + EncodeQueryValue(kNotesFilename);
+    if (!UpdateCheck::CheckForProductUpdates(server_url, product_checks, error_message) || product_checks[0].update_info.releases.size() != 1 ||
+        !product_checks[0].update_info.releases[0].release_notes_url.empty())
+    {
+        fprintf(stderr, "Product check: the local release notes URL was kept: %s%s\n", error_message.c_str(), product_checks[0].error_message.c_str());
+        is_passed = false;
+    }
+
+    const std::string notes_url = server_url + "/notes.md";
+    is_passed = CheckReleaseNotesUrl("Downloaded version file with http release notes", server_url, "manifest.json?notes=" + EncodeQueryValue(notes_url), notes_url) &&
+                is_passed;
+    is_passed = CheckFetchedNotes("Downloaded release notes", notes_url, kServerNotes) && is_passed;
+
+    std::remove(kNotesFilename);
+    return is_passed;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 2)
+    {
+        fprintf(stderr, "Usage: %s [server URL]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bool is_passed = CheckInjectedUrls();
+    is_passed      = CheckLocalManifest() && is_passed;
+
+    if (argc == 2)
+    {
+        is_passed = CheckRemoteManifest(argv[1]) && is_passed;
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,156 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that SmallVector stays consistent when an element constructor throws.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include "update_check_api_small_vector.h"
+
+/// The number of elements that each test run adds.
+static const int kElementCount = 9;
+
+/// The number of heap blocks that are currently allocated.
+static int live_allocation_count = 0;
+
+/// The number of elements that are currently alive.
+static int live_element_count = 0;
+
+/// The number of element constructions since the start of the current test run.
+static int construction_count = 0;
+
+/// The construction that throws, or -1 if none does.
+static int throwing_construction = -1;
+
+void* operator new(size_t size)
+{
+    void* memory = malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    ++live_allocation_count;
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    if (memory != nullptr)
+    {
+        --live_allocation_count;
+        free(memory);
+    }
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    operator delete(memory);
+}
+
+/// @brief An element whose constructors throw when they reach throwing_construction.
+///
+/// The move constructor is not noexcept, so SmallVector must copy these elements when it grows.
+struct ThrowingElement
+{
+    explicit ThrowingElement(int value)
+        : value(value)
+    {
+        Construct();
+    }
+
+    ThrowingElement(const ThrowingElement& other)
+        : value(other.value)
+    {
+        Construct();
+    }
+
+    ThrowingElement(ThrowingElement&& other)
+        : value(other.value)
+    {
+        Construct();
+    }
+
+    ~ThrowingElement()
+    {
+        --live_element_count;
+    }
+
+    void Construct()
+    {
+        if (construction_count++ == throwing_construction)
+        {
+            throw std::runtime_error("construction failed");
+        }
+
+        ++live_element_count;
+    }
+
+    int value;
+};
+
+int main()
+{
+    int failure_count = 0;
+
+    // Make a constructor throw at every point of kElementCount emplace_back() calls, including while the elements are moved to the heap.
+    for (int throwing_at = 0; throwing_at < 4 * kElementCount; ++throwing_at)
+    {
+        const int allocations_before = live_allocation_count;
+
+        {
+            UpdateCheck::SmallVector<ThrowingElement, 2> elements;
+            size_t                                       added_count = 0;
+
+            construction_count    = 0;
+            throwing_construction = throwing_at;
+            try
+            {
+                for (int i = 0; i < kElementCount; ++i)
+                {
+                    elements.emplace_back(i);
+                    added_count = elements.size();
+                }
+            }
+            catch (const std::runtime_error&)
+            {
+            }
+
+            throwing_construction = -1;
+
+            if (elements.size() != added_count || live_element_count != static_cast<int>(elements.size()))
+            {
+                fprintf(stderr, "Throwing at construction %d: %zu elements, %d alive, %zu expected.\n", throwing_at, elements.size(), live_element_count, added_count);
+                ++failure_count;
+            }
+
+            for (size_t i = 0; i < elements.size(); ++i)
+            {
+                if (elements[i].value != static_cast<int>(i))
+                {
+                    fprintf(stderr, "Throwing at construction %d: element %zu is %d.\n", throwing_at, i, elements[i].value);
+                    ++failure_count;
+                }
+            }
+        }
+
+        if (live_element_count != 0 || live_allocation_count != allocations_before)
+        {
+            fprintf(stderr,
+                    "Throwing at construction %d: %d elements and %d heap blocks were leaked.\n",
+                    throwing_at,
+                    live_element_count,
+                    live_allocation_count - allocations_before);
+            ++failure_count;
+            live_element_count = 0;
+        }
+    }
+
+    return failure_count == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
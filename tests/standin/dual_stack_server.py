@@ -0,0 +1,52 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""A stand-in for a dual-stack server whose IPv6 address is unreachable.
+
+Usage: dual_stack_server.py
+
+The server answers over IPv4 on 127.0.0.1. The same port on ::1 accepts no
+connections: its accept queue is filled, so that further SYNs are dropped,
+as on a network where IPv6 is broken. Every response closes its connection,
+so that each check connects again.
+"""
+
+import socket
+
+import standin
+
+
+class DualStackHandler(standin.Handler):
+    def do_GET(self):
+        self.close_connection = True
+        self.send_body(200, '{"SchemaVersion": "1.6", "Releases": []}', headers=[("Connection", "close")])
+
+
+def listen_without_accepting(port):
+    """Listen on [::1]:port, and fill the accept queue so that the connections that follow time out."""
+    listener = socket.socket(socket.AF_INET6)
+    listener.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_V6ONLY, 1)
+    listener.bind(("::1", port))
+    listener.listen(0)
+
+    queued = []
+    for _ in range(4):
+        connection = socket.socket(socket.AF_INET6)
+        connection.setblocking(False)
+        try:
+            connection.connect(("::1", port))
+        except BlockingIOError:
+            pass
+        queued.append(connection)
+
+    return listener, queued
+
+
+if __name__ == "__main__":
+    server = standin.Server(DualStackHandler)
+    try:
+        blackhole = listen_without_accepting(server.server_address[1])
+    except OSError as error:
+        print("SKIP IPv6 is not available on the loopback interface: %s" % error, flush=True)
+    else:
+        standin.serve(server)
@@ -0,0 +1,96 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""A stand-in for the GitHub REST and GraphQL APIs, and for release asset downloads.
+
+Usage: graphql_server.py <JSON file>
+
+The repositories amd/p0 to amd/p39 have a latest release v<n> with the assets
+manifest.json and other.zip; amd/norelease has no release, and any other
+repository does not exist. GET /repos/<owner>/<repository>/releases/latest
+answers like the REST API, POST /graphql answers the aliased repository()
+selections of a query like the GraphQL API, and GET /dl/... answers with the
+given JSON file. GET /stats reports the counters "rest", "graphql",
+"repositories", "largest_query" and "downloads".
+"""
+
+import json
+import re
+import sys
+
+import standin
+
+REPOSITORIES = {("amd", "p%d" % i): {"tag": "v%d" % i, "assets": ["manifest.json", "other.zip"]} for i in range(40)}
+REPOSITORIES[("amd", "norelease")] = None
+
+
+class GraphqlHandler(standin.Handler):
+    def asset_url(self, owner, repository, tag, asset):
+        return "http://127.0.0.1:%d/dl/%s/%s/%s/%s" % (self.server.server_address[1], owner, repository, tag, asset)
+
+    def do_GET(self):
+        latest_release = re.match(r"^/repos/([^/]+)/([^/]+)/releases/latest$", self.path)
+
+        if self.path == "/stats":
+            self.send_statistics()
+        elif latest_release:
+            self.server.count("rest")
+            release = REPOSITORIES.get(latest_release.groups())
+            if release is None:
+                self.send_body(404, json.dumps({"message": "Not Found"}))
+            else:
+                owner, repository = latest_release.groups()
+                assets = [{"name": asset, "browser_download_url": self.asset_url(owner, repository, release["tag"], asset)} for asset in release["assets"]]
+                self.send_body(200, json.dumps({"tag_name": release["tag"], "assets": assets}))
+        elif self.path.startswith("/dl/"):
+            self.server.count("downloads")
+            self.send_body(200, self.server.json_file)
+        else:
+            self.send_body(404, json.dumps({"message": "Not Found"}))
+
+    def do_POST(self):
+        query = json.loads(self.rfile.read(int(self.headers["Content-Length"])))
+
+        if self.path != "/graphql":
+            self.send_body(404, json.dumps({"message": "Not Found"}))
+            return
+
+        self.server.count("graphql")
+        if not self.headers.get("Authorization", "").lower().startswith("bearer "):
+            self.send_body(401, json.dumps({"message": "This endpoint requires you to be authenticated."}))
+            return
+
+        variables = query["variables"]
+        aliases = re.findall(r"(r\d+):\s*repository", query["query"])
+        self.server.count("repositories", len(aliases))
+        with self.server.lock:
+            self.server.counters["largest_query"] = max(self.server.counters.get("largest_query", 0), len(aliases))
+
+        data = {}
+        errors = []
+        for alias in aliases:
+            key = (variables["o" + alias[1:]], variables["n" + alias[1:]])
+            asset_name = variables["a" + alias[1:]]
+            if key not in REPOSITORIES:
+                data[alias] = None
+                errors.append({"type": "NOT_FOUND",
+                               "path": [alias],
+                               "message": "Could not resolve to a Repository with the name '%s/%s'." % key})
+            elif REPOSITORIES[key] is None:
+                data[alias] = {"latestRelease": None}
+            else:
+                release = REPOSITORIES[key]
+                nodes = [{"downloadUrl": self.asset_url(key[0], key[1], release["tag"], asset)} for asset in release["assets"] if asset == asset_name]
+                data[alias] = {"latestRelease": {"tagName": release["tag"], "releaseAssets": {"nodes": nodes}}}
+
+        response = {"data": data}
+        if errors:
+            response["errors"] = errors
+        self.send_body(200, json.dumps(response))
+
+
+if __name__ == "__main__":
+    server = standin.Server(GraphqlHandler)
+    with open(sys.argv[1], "rb") as json_file:
+        server.json_file = json_file.read()
+    standin.serve(server)
@@ -0,0 +1,58 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""A stand-in for a server that publishes a version file and release notes.
+
+Usage: notes_server.py
+
+GET /manifest.json?notes=<URL> answers with a Schema 1.6 version file of one
+release for every platform, whose ReleaseNotesURL is the given URL, which a
+malicious server could set to a path on the client. GET /notes.md answers
+with the release notes. GET /stats reports the counters "manifests" and
+"notes".
+"""
+
+import json
+import urllib.parse
+
+import standin
+
+# The release notes that GET /notes.md answers with.
+RELEASE_NOTES = "# Release notes\n\nFixed a crash.\n"
+
+
+def make_manifest(release_notes_url):
+    """Make a version file of one release with the given release notes URL."""
+    release = {
+        "ReleaseVersion": {"Major": 9, "Minor": 0, "Patch": 0, "Build": 1},
+        "ReleaseDate": "2026-10-19",
+        "ReleaseType": "GA",
+        "ReleaseTitle": "Radeon Tool 9.0.0",
+        "ReleasePlatforms": ["Windows", "Ubuntu", "RHEL", "Darwin"],
+        "ReleaseTags": ["tool"],
+        "DownloadLinks": [{"URL": "https://github.com/GPUOpen-Tools/tool/releases/download/v9.0.0/Tool_9.0.0.zip", "PackageType": "ZIP"}],
+        "InfoPageLinks": [{"URL": "https://gpuopen.com/tool/", "Description": "Radeon Tool"}],
+        "ReleaseNotesURL": release_notes_url,
+    }
+    return json.dumps({"SchemaVersion": "1.6", "Releases": [release]}, indent=4)
+
+
+class NotesHandler(standin.Handler):
+    def do_GET(self):
+        url = urllib.parse.urlsplit(self.path)
+        query = urllib.parse.parse_qs(url.query)
+
+        if url.path == "/stats":
+            self.send_statistics()
+        elif url.path == "/manifest.json":
+            self.server.count("manifests")
+            self.send_body(200, make_manifest(query["notes"][0]))
+        elif url.path == "/notes.md":
+            self.server.count("notes")
+            self.send_body(200, RELEASE_NOTES, content_type="text/markdown")
+        else:
+            self.send_body(404, "")
+
+
+if __name__ == "__main__":
+    standin.serve(standin.Server(NotesHandler))
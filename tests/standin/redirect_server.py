@@ -0,0 +1,66 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""A stand-in for GitHub release asset downloads, which redirect to signed URLs that expire.
+
+Usage: redirect_server.py
+
+GET /download/<seconds>/<name>[?cc=<Cache-Control>] redirects to a signed URL
+/objects/<name>?se=... that is valid for the given number of seconds, with
+the Cache-Control header if one is given. GET /objects/... answers with the
+file, or with 403 once the signature expired or was revoked. GET /revoke
+revokes all signatures issued so far. GET /stats reports the counters
+"redirects", "objects" and "rejected".
+"""
+
+import calendar
+import time
+import urllib.parse
+
+import standin
+
+# The format of the expiry time of a signed URL, like the "se" parameter of Azure Blob Storage.
+EXPIRY_FORMAT = "%Y-%m-%dT%H:%M:%SZ"
+
+# Signatures issued before this time, in nanoseconds, are rejected.
+revoked_before = 0
+
+
+class RedirectHandler(standin.Handler):
+    def do_GET(self):
+        global revoked_before
+
+        url = urllib.parse.urlsplit(self.path)
+        query = urllib.parse.parse_qs(url.query)
+
+        if url.path == "/stats":
+            self.send_statistics()
+        elif url.path == "/revoke":
+            revoked_before = time.time_ns()
+            self.send_body(200, "")
+        elif url.path.startswith("/download/"):
+            self.server.count("redirects")
+            seconds, name = url.path[len("/download/"):].split("/", 1)
+            expiry = time.gmtime(time.time() + int(seconds))
+            signed_query = urllib.parse.urlencode({"sp": "r",
+                                                   "se": time.strftime(EXPIRY_FORMAT, expiry),
+                                                   "st": str(time.time_ns()),
+                                                   "sig": "stand-in"})
+            headers = [("Location", "/objects/%s?%s" % (name, signed_query))]
+            if "cc" in query:
+                headers.append(("Cache-Control", query["cc"][0]))
+            self.send_body(302, "", headers=headers)
+        elif url.path.startswith("/objects/"):
+            self.server.count("objects")
+            expiry = calendar.timegm(time.strptime(query["se"][0], EXPIRY_FORMAT))
+            if time.time() > expiry or int(query["st"][0]) < revoked_before:
+                self.server.count("rejected")
+                self.send_body(403, "<Error><Code>AuthenticationFailed</Code></Error>", content_type="application/xml")
+            else:
+                self.send_body(200, '{"SchemaVersion": "1.6", "Name": "%s"}' % url.path[len("/objects/"):])
+        else:
+            self.send_body(404, "")
+
+
+if __name__ == "__main__":
+    standin.serve(standin.Server(RedirectHandler))
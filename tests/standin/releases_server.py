@@ -0,0 +1,91 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""A stand-in for the paginated release list of the GitHub REST API.
+
+Usage: releases_server.py <JSON file>
+
+GET /repos/<owner>/<repository>/releases?per_page=<n>&page=<n> answers with a
+page of 450 releases, newest first, with the Link header of the GitHub API.
+The newest stable release is v1000.0.0 on page 1, followed by the beta
+prereleases v2.0.0-beta.5 (a draft), v2.0.0-beta.4 (without manifest.json)
+and v2.0.0-beta.3; the alpha prerelease rgp-v2.0-Alpha1 is release 320. Page 2
+of the repository "limited" answers with the 403 of an exceeded rate limit.
+GET /dl/<tag>/<asset> answers with the given JSON file. GET /stats reports
+the counter "<repository>/page<n>" of each page that was requested, and
+"downloads".
+"""
+
+import json
+import re
+import sys
+import urllib.parse
+
+import standin
+
+# The number of releases of each repository.
+RELEASE_COUNT = 450
+
+
+def make_release(index, base_url):
+    """Make release number index of the list, where 0 is the newest."""
+    tag, is_prerelease, is_draft = "v%d.0.0" % (1000 - index), False, False
+    assets = ["manifest.json", "tool.zip", "tool.tar.gz", "notes.txt"]
+    if index == 1:
+        tag, is_prerelease, is_draft = "v2.0.0-beta.5", True, True
+    elif index == 2:
+        tag, is_prerelease, assets = "v2.0.0-beta.4", True, ["tool.zip"]
+    elif index == 3:
+        tag, is_prerelease = "v2.0.0-beta.3", True
+    elif index == 320:
+        tag, is_prerelease = "rgp-v2.0-Alpha1", True
+    return {"url": base_url + "/releases/%d" % index,
+            "tag_name": tag,
+            "name": "Release " + tag,
+            "draft": is_draft,
+            "prerelease": is_prerelease,
+            "body": "Release notes. " * 50,
+            "assets": [{"name": asset, "size": 1234, "browser_download_url": "%s/dl/%s/%s" % (base_url, tag, asset)} for asset in assets]}
+
+
+class ReleasesHandler(standin.Handler):
+    def do_GET(self):
+        url = urllib.parse.urlsplit(self.path)
+        query = dict(urllib.parse.parse_qsl(url.query))
+        releases = re.match(r"^/repos/([^/]+)/([^/]+)/releases$", url.path)
+
+        if url.path == "/stats":
+            self.send_statistics()
+        elif url.path.startswith("/dl/"):
+            self.server.count("downloads")
+            self.send_body(200, self.server.json_file)
+        elif releases:
+            per_page = int(query.get("per_page", 30))
+            page = int(query.get("page", 1))
+            self.server.count("%s/page%d" % (releases.group(2), page))
+
+            if releases.group(2) == "limited" and page == 2:
+                self.send_body(403, json.dumps({"message": "API rate limit exceeded for 127.0.0.1",
+                                                "documentation_url": "https://docs.github.com/rest/rate-limit"}))
+                return
+
+            page_url = "http://127.0.0.1:%d%s?per_page=%d&page=%%d" % (self.server.server_address[1], url.path, per_page)
+            last_page = max(1, (RELEASE_COUNT + per_page - 1) // per_page)
+            links = []
+            if page < last_page:
+                links.append('<%s>; rel="next"' % (page_url % (page + 1)))
+                links.append('<%s>; rel="last"' % (page_url % last_page))
+
+            first = (page - 1) * per_page
+            base_url = "http://127.0.0.1:%d" % self.server.server_address[1]
+            body = json.dumps([make_release(index, base_url) for index in range(first, min(first + per_page, RELEASE_COUNT))])
+            self.send_body(200, body, headers=[("Link", ", ".join(links))] if links else ())
+        else:
+            self.send_body(404, json.dumps({"message": "Not Found"}))
+
+
+if __name__ == "__main__":
+    server = standin.Server(ReleasesHandler)
+    with open(sys.argv[1], "rb") as json_file:
+        server.json_file = json_file.read()
+    standin.serve(server)
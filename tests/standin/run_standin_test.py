@@ -0,0 +1,52 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""Start a stand-in server, run a test against it, and stop the server.
+
+Usage: run_standin_test.py <server script> [server arguments...] -- <test> [test arguments...]
+
+The server prints "PORT <port>" as its first line of output; "{port}" in the
+test arguments is replaced with that port. The exit code is the one of the test.
+A server that cannot run on this machine prints "SKIP <reason>" instead, and
+the exit code is then SKIP_RETURN_CODE, which CTest reports as a skipped test.
+"""
+
+import subprocess
+import sys
+
+SKIP_RETURN_CODE = 77
+
+
+def main():
+    if "--" not in sys.argv:
+        print(__doc__, file=sys.stderr)
+        return 2
+
+    separator = sys.argv.index("--")
+    server_command = [sys.executable, "-B"] + sys.argv[1:separator]
+    test_command = sys.argv[separator + 1:]
+
+    server = subprocess.Popen(server_command, stdout=subprocess.PIPE, text=True)
+    try:
+        first_line = server.stdout.readline().split(None, 1)
+        if len(first_line) == 2 and first_line[0] == "SKIP":
+            print("Skipped: %s" % first_line[1].strip())
+            return SKIP_RETURN_CODE
+
+        if len(first_line) != 2 or first_line[0] != "PORT":
+            print("The stand-in server %s did not start." % server_command[2], file=sys.stderr)
+            return 1
+
+        port = first_line[1].strip()
+        test_command = [argument.replace("{port}", port) for argument in test_command]
+        return subprocess.call(test_command, timeout=120)
+    finally:
+        server.terminate()
+        try:
+            server.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            server.kill()
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,76 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""Helpers shared by the stand-in servers that the network tests run against.
+
+Each stand-in listens on a free port of the loopback interface, and prints
+"PORT <port>" as its first line of output, which run_standin_test.py reads.
+"""
+
+import http.server
+import json
+import sys
+import threading
+
+
+class Server(http.server.ThreadingHTTPServer):
+    """An HTTP server on a free port of 127.0.0.1 that serves each connection on a thread of its own."""
+
+    daemon_threads = True
+    request_queue_size = 128
+
+    def __init__(self, handler_class):
+        super().__init__(("127.0.0.1", 0), handler_class)
+        self.lock = threading.Lock()
+        self.counters = {}
+
+    def count(self, name, amount=1):
+        """Add to one of the counters that GET /stats reports."""
+        with self.lock:
+            self.counters[name] = self.counters.get(name, 0) + amount
+
+    def statistics(self):
+        """Get a copy of the counters."""
+        with self.lock:
+            return dict(self.counters)
+
+    def handle_error(self, request, client_address):
+        """Ignore connections that the client closed, like those of cancelled transfers, and report other errors."""
+        if not isinstance(sys.exc_info()[1], ConnectionError):
+            super().handle_error(request, client_address)
+
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    """A request handler that answers GET /stats with the counters of the server as a JSON object."""
+
+    protocol_version = "HTTP/1.1"
+
+    def log_message(self, format, *args):
+        pass
+
+    def send_body(self, status, body, content_type="application/json", headers=()):
+        """Send a complete response."""
+        if isinstance(body, str):
+            body = body.encode("utf-8")
+        self.send_response(status)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        for name, value in headers:
+            self.send_header(name, value)
+        self.end_headers()
+        if self.command != "HEAD":
+            self.wfile.write(body)
+
+    def send_statistics(self):
+        """Answer a request for the counters of the server."""
+        self.send_body(200, json.dumps(self.server.statistics()))
+
+
+def serve(server):
+    """Print the port of a server, and serve requests until the process is terminated."""
+    print("PORT %d" % server.server_address[1], flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    sys.exit(0)
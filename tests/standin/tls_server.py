@@ -0,0 +1,45 @@
+#=================================================================
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#=================================================================
+"""A stand-in HTTPS server that counts full and resumed TLS handshakes.
+
+Usage: tls_server.py <certificate file> <key file>
+
+GET /stats reports "full_handshakes" and "resumed_handshakes"; any other
+path is answered with a small JSON file.
+"""
+
+import ssl
+import sys
+
+import standin
+
+
+class TlsServer(standin.Server):
+    def __init__(self, handler_class, certificate_file, key_file):
+        super().__init__(handler_class)
+        self.context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        self.context.load_cert_chain(certificate_file, key_file)
+        self.context.set_alpn_protocols(["http/1.1"])
+
+    def get_request(self):
+        # The handshake is done on the thread of the connection, in TlsHandler.setup().
+        connection, address = self.socket.accept()
+        return self.context.wrap_socket(connection, server_side=True, do_handshake_on_connect=False), address
+
+
+class TlsHandler(standin.Handler):
+    def setup(self):
+        self.request.do_handshake()
+        self.server.count("resumed_handshakes" if self.request.session_reused else "full_handshakes")
+        super().setup()
+
+    def do_GET(self):
+        if self.path == "/stats":
+            self.send_statistics()
+        else:
+            self.send_body(200, '{"SchemaVersion": "1.6", "Releases": []}')
+
+
+if __name__ == "__main__":
+    standin.serve(TlsServer(TlsHandler, sys.argv[1], sys.argv[2]))
@@ -0,0 +1,102 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that later checks resume the TLS session of the first one.
+///
+/// Runs against tests/standin/tls_server.py, which counts full and resumed handshakes.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include "third_party/json-3.9.1/json.hpp"
+#include "update_check_api_curl_transport.h"
+
+/// The number of checks, each with a transport of its own, like separate runs of a periodic check.
+static const int kCheckCount = 4;
+
+/// @brief Download a file with a new transport.
+///
+/// @param [in]  options The options of the transport.
+/// @param [in]  url     The URL of the file.
+/// @param [out] result  The outcome of the transfer.
+///
+/// @return true if the file was downloaded; false otherwise.
+static bool FetchWithNewTransport(const UpdateCheck::TransportOptions& options, const std::string& url, UpdateCheck::TransferResult& result)
+{
+    UpdateCheck::CurlTransport   transport(options);
+    UpdateCheck::TransferRequest request;
+    request.url = url;
+
+    bool ret = transport.Fetch(request, result);
+    if (!ret)
+    {
+        fprintf(stderr, "Downloading %s failed: %s\n", url.c_str(), result.error_message.c_str());
+    }
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <server URL> <CA file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string server_url = argv[1];
+
+    // A session file that cannot be read must not keep the transport from working.
+    const std::string session_file = "tls_session_test_sessions.bin";
+    std::ofstream(session_file, std::ios::binary) << "not a TLS session file";
+
+    UpdateCheck::TransportOptions options;
+    options.ca_file          = argv[2];
+    options.tls_session_file = session_file;
+
+    for (int i = 0; i < kCheckCount; ++i)
+    {
+        UpdateCheck::TransferResult result;
+        if (!FetchWithNewTransport(options, server_url + "/version.json", result))
+        {
+            return EXIT_FAILURE;
+        }
+
+        printf("Check %d: TLS handshake %.1f ms.\n", i + 1, result.timing.tls_handshake - result.timing.connect);
+    }
+
+    bool is_passed = true;
+
+    UpdateCheck::TransportStatistics statistics = UpdateCheck::CurlTransport::GetStatistics();
+    if (statistics.tls_handshakes != kCheckCount)
+    {
+        fprintf(stderr, "%llu TLS handshakes were counted instead of %d.\n", static_cast<unsigned long long>(statistics.tls_handshakes), kCheckCount);
+        is_passed = false;
+    }
+
+    // The request for the statistics of the server is a handshake of its own.
+    UpdateCheck::TransferResult server_statistics;
+    if (!FetchWithNewTransport(options, server_url + "/stats", server_statistics))
+    {
+        return EXIT_FAILURE;
+    }
+
+    nlohmann::json server_counters    = nlohmann::json::parse(server_statistics.body.Data(), server_statistics.body.Data() + server_statistics.body.Size());
+    const int      full_handshakes    = server_counters.value("full_handshakes", 0);
+    const int      resumed_handshakes = server_counters.value("resumed_handshakes", 0);
+    printf("The server saw %d full and %d resumed handshakes.\n", full_handshakes, resumed_handshakes);
+
+    if (full_handshakes != 1 || resumed_handshakes != kCheckCount)
+    {
+        fprintf(stderr, "Only the first check should have done a full handshake.\n");
+        is_passed = false;
+    }
+
+    remove(session_file.c_str());
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,216 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that a reused UpdateInfo keeps the memory of its releases across checks, without hoarding it.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "update_check_api.h"
+
+/// The number of allocations that a check of an unchanged Schema 1.6 manifest may still make
+/// once update_info has been filled. These are the file read and the JSON parse itself; the
+/// releases, their strings and their lists must all reuse the memory of the previous check.
+static const size_t kMaxSteadyStateAllocations = 64;
+
+/// The same for the streaming check, which also builds a new parser and its buffers for every check.
+static const size_t kMaxStreamingSteadyStateAllocations = 128;
+
+/// The number of checks to run after the first one.
+static const int kSteadyStateCheckCount = 4;
+
+/// True while allocations are being counted.
+static bool is_counting_allocations = false;
+
+/// The number of allocations since counting was last started.
+static size_t allocation_count = 0;
+
+void* operator new(size_t size)
+{
+    if (is_counting_allocations)
+    {
+        ++allocation_count;
+    }
+
+    void* memory = malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    free(memory);
+}
+
+/// @brief A version file, and the way that it is checked.
+struct ReuseCase
+{
+    /// A description of the case.
+    const char* label;
+
+    /// The name of the version file in the test data directory.
+    const char* json_filename;
+
+    /// True to check with the overload of CheckForUpdates() that parses the version file while it is read.
+    bool is_streaming;
+
+    /// The number of allocations that a check may make once update_info has been filled, or 0 for no limit. Older schemas are parsed into a DOM first.
+    size_t max_allocations;
+};
+
+static const ReuseCase kReuseCases[] = {
+    {"Schema 1.6", "releases_1_6.json", false, kMaxSteadyStateAllocations},
+    {"Schema 1.6, streamed", "releases_1_6.json", true, kMaxStreamingSteadyStateAllocations},
+    {"Schema 1.5", "releases_1_5.json", false, 0},
+    {"Schema 1.5, streamed", "releases_1_5.json", true, 0},
+};
+
+/// @brief Check a test manifest and count the allocations that the check makes.
+///
+/// @param [in]  data_directory The directory that contains the test manifests.
+/// @param [in]  reuse_case     The manifest, and the way that it is checked.
+/// @param [out] update_info    The results of the check.
+/// @param [out] allocations    The number of allocations made by the check.
+///
+/// @return true if the check succeeded, false otherwise.
+static bool CheckAndCountAllocations(const std::string& data_directory, const ReuseCase& reuse_case, UpdateCheck::UpdateInfo& update_info, size_t& allocations)
+{
+    UpdateCheck::VersionInfo     current_version = {};
+    UpdateCheck::ReleaseCallback release_callback;
+    std::string                  error_message;
+    bool                         ret = false;
+
+    allocation_count        = 0;
+    is_counting_allocations = true;
+    if (reuse_case.is_streaming)
+    {
+        ret = UpdateCheck::CheckForUpdates(current_version, data_directory, reuse_case.json_filename, release_callback, update_info, error_message);
+    }
+    else
+    {
+        ret = UpdateCheck::CheckForUpdates(current_version, data_directory, reuse_case.json_filename, update_info, error_message);
+    }
+
+    is_counting_allocations = false;
+    allocations             = allocation_count;
+
+    if (!ret)
+    {
+        fprintf(stderr, "%s: the check failed: %s\n", reuse_case.label, error_message.c_str());
+    }
+
+    return ret;
+}
+
+/// @brief Check a test manifest repeatedly with the same UpdateInfo, and check that the memory of the releases is reused but not hoarded.
+///
+/// @param [in] data_directory The directory that contains the test manifests.
+/// @param [in] reuse_case     The manifest, and the way that it is checked.
+///
+/// @return true if the case passed, false otherwise.
+static bool RunReuseCase(const std::string& data_directory, const ReuseCase& reuse_case)
+{
+    UpdateCheck::UpdateInfo update_info;
+    size_t                  first_allocations = 0;
+    if (!CheckAndCountAllocations(data_directory, reuse_case, update_info, first_allocations))
+    {
+        return false;
+    }
+
+    const size_t release_count  = update_info.releases.size();
+    const size_t recycled_count = update_info.recycled_releases.size();
+    printf("%s, check 1: %zu releases, %zu recycled, %zu allocations.\n", reuse_case.label, release_count, recycled_count, first_allocations);
+
+    if (release_count == 0 || !update_info.is_update_available)
+    {
+        fprintf(stderr, "%s: the first check did not find the releases of the test manifest.\n", reuse_case.label);
+        return false;
+    }
+
+    bool is_passed = true;
+    for (int i = 0; i < kSteadyStateCheckCount; ++i)
+    {
+        size_t allocations = 0;
+        if (!CheckAndCountAllocations(data_directory, reuse_case, update_info, allocations))
+        {
+            return false;
+        }
+
+        printf("%s, check %d: %zu releases, %zu recycled, %zu allocations.\n",
+               reuse_case.label,
+               i + 2,
+               update_info.releases.size(),
+               update_info.recycled_releases.size(),
+               allocations);
+
+        if (update_info.releases.size() != release_count)
+        {
+            fprintf(stderr, "%s, check %d: found %zu releases instead of %zu.\n", reuse_case.label, i + 2, update_info.releases.size(), release_count);
+            is_passed = false;
+        }
+
+        // The releases of the other platforms are recycled by every check; no more than that may pile up.
+        if (update_info.recycled_releases.size() != recycled_count)
+        {
+            fprintf(stderr,
+                    "%s, check %d: %zu releases are recycled instead of %zu.\n",
+                    reuse_case.label,
+                    i + 2,
+                    update_info.recycled_releases.size(),
+                    recycled_count);
+            is_passed = false;
+        }
+
+        if (reuse_case.max_allocations != 0 && (allocations > reuse_case.max_allocations || allocations >= first_allocations))
+        {
+            fprintf(stderr, "%s, check %d: made %zu allocations; at most %zu were expected.\n", reuse_case.label, i + 2, allocations, reuse_case.max_allocations);
+            is_passed = false;
+        }
+    }
+
+    // A recycled release must not keep the version file that it was parsed from alive.
+    update_info.Reset();
+    for (const UpdateCheck::ReleaseInfo& release_info : update_info.recycled_releases)
+    {
+        if (release_info.manifest_buffer != nullptr)
+        {
+            fprintf(stderr, "%s: a recycled release still refers to its version file.\n", reuse_case.label);
+            is_passed = false;
+            break;
+        }
+    }
+
+    return is_passed;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <test data directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string data_directory = argv[1];
+
+    bool is_passed = true;
+    for (const ReuseCase& reuse_case : kReuseCases)
+    {
+        is_passed = RunReuseCase(data_directory, reuse_case) && is_passed;
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
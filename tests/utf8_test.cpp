@@ -0,0 +1,111 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks the UTF-8 validation at every position of the vectorized blocks.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+
+#include "update_check_api_utf8.h"
+
+/// The size of the text that each sequence is placed in; large enough for several blocks of 16 bytes.
+static const size_t kTextSize = 80;
+
+/// @brief A byte sequence and whether it is well-formed UTF-8.
+struct Utf8Case
+{
+    const char* bytes;
+    bool        is_valid;
+};
+
+static const Utf8Case kUtf8Cases[] = {
+    {"\xC2\xA9", true},                   // U+00A9
+    {"\xDF\xBF", true},                   // U+07FF
+    {"\xE0\xA0\x80", true},               // U+0800
+    {"\xE2\x82\xAC", true},               // U+20AC
+    {"\xED\x9F\xBF", true},               // U+D7FF, just below the surrogates.
+    {"\xEE\x80\x80", true},               // U+E000, just above the surrogates.
+    {"\xEF\xBF\xBF", true},               // U+FFFF
+    {"\xF0\x90\x80\x80", true},           // U+10000
+    {"\xF0\x9F\x98\x80", true},           // U+1F600
+    {"\xF4\x8F\xBF\xBF", true},           // U+10FFFF
+    {"\xC2\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", true},
+    {"\x80", false},                      // A continuation byte without a lead byte.
+    {"\xBF\x80", false},                  // Two continuation bytes without a lead byte.
+    {"\xC0\x80", false},                  // Overlong U+0000.
+    {"\xC1\xBF", false},                  // Overlong U+007F.
+    {"\xE0\x9F\xBF", false},              // Overlong U+07FF.
+    {"\xF0\x8F\xBF\xBF", false},          // Overlong U+FFFF.
+    {"\xED\xA0\x80", false},              // The surrogate U+D800.
+    {"\xED\xBF\xBF", false},              // The surrogate U+DFFF.
+    {"\xF4\x90\x80\x80", false},          // U+110000, above the largest code point.
+    {"\xF5\x80\x80\x80", false},          // A lead byte that is never valid.
+    {"\xF8\x88\x80\x80\x80", false},      // A five byte sequence.
+    {"\xFF", false},                      // A byte that is never valid.
+    {"\xC2", false},                      // A lead byte without its continuation byte.
+    {"\xE2\x82", false},                  // A three byte sequence that is cut short.
+    {"\xF0\x9F\x98", false},              // A four byte sequence that is cut short.
+    {"\xE2\x82\xAC\x80", false},          // A continuation byte too many.
+    {"\xF0\x9F\x98\x80\x80", false},      // A continuation byte too many.
+    {"\xC2\xC2\xA9", false},              // A lead byte followed by another lead byte.
+};
+
+/// @brief Validate a text in chunks of the given size.
+///
+/// @param [in] text       The text to validate.
+/// @param [in] chunk_size The number of bytes to pass to each call of Update().
+///
+/// @return true if the text is valid UTF-8; false otherwise.
+static bool IsValidInChunks(const std::string& text, size_t chunk_size)
+{
+    UpdateCheckApiUtils::Utf8Validator validator;
+
+    for (size_t offset = 0; offset < text.size(); offset += chunk_size)
+    {
+        size_t size = (text.size() - offset < chunk_size) ? text.size() - offset : chunk_size;
+        validator.Update(text.data() + offset, size);
+    }
+
+    return validator.IsComplete();
+}
+
+int main()
+{
+    int failure_count = 0;
+
+    for (size_t i = 0; i < sizeof(kUtf8Cases) / sizeof(kUtf8Cases[0]); ++i)
+    {
+        const Utf8Case&   utf8_case = kUtf8Cases[i];
+        const std::string sequence  = utf8_case.bytes;
+
+        // Place the sequence at every offset, so that it crosses each block boundary, and at the very end of the text.
+        for (size_t offset = 0; offset + sequence.size() <= kTextSize; ++offset)
+        {
+            std::string text(kTextSize, 'a');
+            text.replace(offset, sequence.size(), sequence);
+
+            bool is_valid = UpdateCheckApiUtils::IsValidUtf8(text.data(), text.size());
+
+            for (size_t chunk_size : {1, 7, 16, 33})
+            {
+                if (IsValidInChunks(text, chunk_size) != is_valid)
+                {
+                    fprintf(stderr, "Case %zu at offset %zu: validating in chunks of %zu bytes disagrees.\n", i, offset, chunk_size);
+                    ++failure_count;
+                }
+            }
+
+            if (is_valid != utf8_case.is_valid)
+            {
+                fprintf(stderr, "Case %zu at offset %zu: expected %s.\n", i, offset, utf8_case.is_valid ? "valid" : "invalid");
+                ++failure_count;
+            }
+        }
+    }
+
+    return failure_count == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}